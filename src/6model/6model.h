@@ -212,6 +212,12 @@ struct MVMSTable {
      * above). */
     MVMuint16 mode_flags;
 
+    /* Bumped whenever the method cache, type check cache or the modes
+     * above change, so anything that caches the outcome of a lookup
+     * against this type (such as specialized bytecode) can tell that
+     * it went stale. */
+    MVMuint32 cache_version;
+
     /* An ID solely for use in caches that last a VM instance. Thus it
      * should never, ever be serialized and you should NEVER make a
      * type directory based upon this ID. Otherwise you'll create memory
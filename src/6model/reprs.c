@@ -206,6 +206,7 @@ void MVM_repr_initialize_registry(MVMThreadContext *tc) {
     register_core_repr(DLLSym);
     register_core_repr(MultiCache);
     register_core_repr(Continuation);
+    register_core_repr(ConcBlockingQueue);
 
     tc->instance->num_reprs = MVM_REPR_CORE_COUNT;
 }
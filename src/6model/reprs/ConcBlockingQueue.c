@@ -0,0 +1,294 @@
+#include "moar.h"
+
+/* This representation's function pointer table. */
+static const MVMREPROps this_repr;
+
+/* Creates a new type object of this representation, and associates it with
+ * the given HOW. */
+static MVMObject * type_object_for(MVMThreadContext *tc, MVMObject *HOW) {
+    MVMSTable *st = MVM_gc_allocate_stable(tc, &this_repr, HOW);
+
+    MVMROOT(tc, st, {
+        MVMObject *obj = MVM_gc_allocate_type_object(tc, st);
+        MVM_ASSIGN_REF(tc, &(st->header), st->WHAT, obj);
+        st->size = sizeof(MVMConcBlockingQueue);
+    });
+
+    return st->WHAT;
+}
+
+/* Creates a new instance based on the type object. */
+static MVMObject * allocate(MVMThreadContext *tc, MVMSTable *st) {
+    return MVM_gc_allocate_object(tc, st);
+}
+
+/* Sets up the shared part of the queue. */
+static void initialize(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data) {
+    MVMConcBlockingQueueBody   *body   = (MVMConcBlockingQueueBody *)data;
+    MVMConcBlockingQueueShared *shared = calloc(1, sizeof(MVMConcBlockingQueueShared));
+    uv_mutex_init(&shared->mutex);
+    uv_cond_init(&shared->cond);
+    shared->head      = calloc(1, sizeof(MVMConcBlockingQueueNode));
+    shared->tail      = (AO_t)shared->head;
+    shared->ref_count = 1;
+    body->shared = shared;
+}
+
+/* Copies the body of one object to another. */
+static void copy_to(MVMThreadContext *tc, MVMSTable *st, void *src, MVMObject *dest_root, void *dest) {
+    MVM_exception_throw_adhoc(tc, "Cannot copy object with representation ConcBlockingQueue");
+}
+
+/* Called by the VM to mark any GCable items. Completions hold no objects of
+ * their own (their task is marked by the event loop), so only pushed values
+ * need marking. The event loop thread may be pushing while we do this, and
+ * may have swung the tail to its node without linking it yet, with nodes
+ * pushed by VM threads after it; so we walk until the tail we saw first,
+ * waiting for any link that is still to be made. Nodes added after that
+ * came from the event loop and hold no objects. */
+static void gc_mark(MVMThreadContext *tc, MVMSTable *st, void *data, MVMGCWorklist *worklist) {
+    MVMConcBlockingQueueShared *shared = ((MVMConcBlockingQueueBody *)data)->shared;
+    MVMConcBlockingQueueNode   *node, *tail;
+    if (!shared)
+        return;
+    uv_mutex_lock(&shared->mutex);
+    tail = (MVMConcBlockingQueueNode *)MVM_load(&shared->tail);
+    node = shared->head;
+    while (node != tail) {
+        MVMConcBlockingQueueNode *next;
+        while (!(next = (MVMConcBlockingQueueNode *)MVM_load(&node->next)))
+            MVM_platform_thread_yield();
+        node = next;
+        MVM_gc_worklist_add(tc, worklist, &node->value);
+    }
+    uv_mutex_unlock(&shared->mutex);
+}
+
+/* Called by the VM in order to free memory associated with this object. */
+static void gc_free(MVMThreadContext *tc, MVMObject *obj) {
+    MVMConcBlockingQueue *cbq = (MVMConcBlockingQueue *)obj;
+    if (cbq->body.shared) {
+        MVM_concblockingqueue_release(tc, cbq->body.shared);
+        cbq->body.shared = NULL;
+    }
+}
+
+/* Gets the storage specification for this representation. */
+static MVMStorageSpec get_storage_spec(MVMThreadContext *tc, MVMSTable *st) {
+    MVMStorageSpec spec;
+    spec.inlineable      = MVM_STORAGE_SPEC_REFERENCE;
+    spec.boxed_primitive = MVM_STORAGE_SPEC_BP_NONE;
+    spec.can_box         = 0;
+    return spec;
+}
+
+/* Compose the representation. */
+static void compose(MVMThreadContext *tc, MVMSTable *st, MVMObject *info) {
+    /* Nothing to do for this REPR. */
+}
+
+/* Gets the shared part of a queue object. */
+static MVMConcBlockingQueueShared * get_shared(MVMThreadContext *tc, void *data) {
+    MVMConcBlockingQueueShared *shared = ((MVMConcBlockingQueueBody *)data)->shared;
+    if (!shared)
+        MVM_exception_throw_adhoc(tc, "ConcBlockingQueue was not initialized");
+    return shared;
+}
+
+/* Appends a node to the queue, waking a consumer if any is waiting. The
+ * count of waiters is bumped before a consumer checks for a node, and read
+ * here after the node is linked, so either the consumer sees the node or we
+ * see the consumer, whose mutex we then take to be sure it is waiting. */
+static void enqueue(MVMConcBlockingQueueShared *shared, MVMConcBlockingQueueNode *node) {
+    MVMConcBlockingQueueNode *prev;
+    node->next = 0;
+    MVM_incr(&shared->elems);
+    do {
+        prev = (MVMConcBlockingQueueNode *)MVM_load(&shared->tail);
+    } while (!MVM_trycas(&shared->tail, prev, node));
+    MVM_store(&prev->next, node);
+    if (MVM_load(&shared->waiters)) {
+        uv_mutex_lock(&shared->mutex);
+        uv_cond_signal(&shared->cond);
+        uv_mutex_unlock(&shared->mutex);
+    }
+}
+
+/* Takes what is in the first node of the queue, if there is one; the node
+ * becomes the new dummy head. Must hold the mutex. */
+static MVMint32 try_dequeue(MVMConcBlockingQueueShared *shared, MVMObject **value,
+        MVMAsyncCompletion **completion) {
+    MVMConcBlockingQueueNode *head = shared->head;
+    MVMConcBlockingQueueNode *next = (MVMConcBlockingQueueNode *)MVM_load(&head->next);
+    if (!next)
+        return 0;
+    *value           = next->value;
+    *completion      = next->completion;
+    next->value      = NULL;
+    next->completion = NULL;
+    shared->head     = next;
+    MVM_decr(&shared->elems);
+    free(head);
+    return 1;
+}
+
+/* Turns what was taken from the queue into an object. */
+static MVMObject * dequeued_object(MVMThreadContext *tc, MVMObject *value,
+        MVMAsyncCompletion *completion) {
+    return completion
+        ? MVM_io_eventloop_completion_to_object(tc, completion)
+        : value;
+}
+
+static void push(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMRegister value, MVMuint16 kind) {
+    MVMConcBlockingQueueNode *node;
+    if (kind != MVM_reg_obj)
+        MVM_exception_throw_adhoc(tc, "ConcBlockingQueue can only hold objects");
+    node        = calloc(1, sizeof(MVMConcBlockingQueueNode));
+    node->value = value.o;
+    MVM_gc_write_barrier(tc, &(root->header), (MVMCollectable *)value.o);
+    enqueue(get_shared(tc, data), node);
+}
+
+/* Takes the item at the head of the queue, waiting for one if it's empty.
+ * While waiting, the thread is marked blocked so that GC can go on without
+ * it; the queue object may be moved meanwhile, so only the shared part is
+ * used past this point. */
+static void shift(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMRegister *value, MVMuint16 kind) {
+    MVMConcBlockingQueueShared *shared     = get_shared(tc, data);
+    MVMObject                  *taken      = NULL;
+    MVMAsyncCompletion         *completion = NULL;
+    MVMint32                    held       = 0;
+    if (kind != MVM_reg_obj)
+        MVM_exception_throw_adhoc(tc, "ConcBlockingQueue can only hold objects");
+
+    uv_mutex_lock(&shared->mutex);
+    while (!try_dequeue(shared, &taken, &completion)) {
+        /* Hold a reference, in case the object is collected while we
+         * wait on it. Another thread may beat us to what is pushed while
+         * we rejoin the VM, so check again after. */
+        if (!held) {
+            MVM_incr(&shared->ref_count);
+            held = 1;
+        }
+        uv_mutex_unlock(&shared->mutex);
+        MVM_gc_mark_thread_blocked(tc);
+        uv_mutex_lock(&shared->mutex);
+        MVM_incr(&shared->waiters);
+        while (!MVM_load(&shared->head->next))
+            uv_cond_wait(&shared->cond, &shared->mutex);
+        MVM_decr(&shared->waiters);
+        uv_mutex_unlock(&shared->mutex);
+        MVM_gc_mark_thread_unblocked(tc);
+        uv_mutex_lock(&shared->mutex);
+    }
+    uv_mutex_unlock(&shared->mutex);
+    if (held)
+        MVM_concblockingqueue_release(tc, shared);
+
+    value->o = dequeued_object(tc, taken, completion);
+}
+
+static MVMuint64 elems(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data) {
+    return (MVMuint64)MVM_load(&get_shared(tc, data)->elems);
+}
+
+/* Initializes the representation. */
+const MVMREPROps * MVMConcBlockingQueue_initialize(MVMThreadContext *tc) {
+    return &this_repr;
+}
+
+static const MVMREPROps this_repr = {
+    type_object_for,
+    allocate,
+    initialize,
+    copy_to,
+    MVM_REPR_DEFAULT_ATTR_FUNCS,
+    MVM_REPR_DEFAULT_BOX_FUNCS,
+    {
+        MVM_REPR_DEFAULT_AT_POS,
+        MVM_REPR_DEFAULT_BIND_POS,
+        MVM_REPR_DEFAULT_SET_ELEMS,
+        MVM_REPR_DEFAULT_EXISTS_POS,
+        push,
+        MVM_REPR_DEFAULT_POP,
+        MVM_REPR_DEFAULT_UNSHIFT,
+        shift,
+        MVM_REPR_DEFAULT_SPLICE,
+        MVM_REPR_DEFAULT_GET_ELEM_STORAGE_SPEC
+    },    /* pos_funcs */
+    MVM_REPR_DEFAULT_ASS_FUNCS,
+    elems,
+    get_storage_spec,
+    NULL, /* change_type */
+    NULL, /* serialize */
+    NULL, /* deserialize */
+    NULL, /* serialize_repr_data */
+    NULL, /* deserialize_repr_data */
+    NULL, /* deserialize_stable_size */
+    gc_mark,
+    gc_free,
+    NULL, /* gc_cleanup */
+    NULL, /* gc_mark_repr_data */
+    NULL, /* gc_free_repr_data */
+    compose,
+    "ConcBlockingQueue", /* name */
+    MVM_REPR_ID_ConcBlockingQueue,
+    0, /* refs_frames */
+};
+
+/* Gets the shared part of a queue object, taking a reference to it, so that
+ * completions can be posted to it from outside of the VM. */
+MVMConcBlockingQueueShared * MVM_concblockingqueue_shared(MVMThreadContext *tc, MVMObject *queue) {
+    MVMConcBlockingQueueShared *shared;
+    if (REPR(queue)->ID != MVM_REPR_ID_ConcBlockingQueue || !IS_CONCRETE(queue))
+        MVM_exception_throw_adhoc(tc, "Expected a concrete ConcBlockingQueue");
+    shared = get_shared(tc, OBJECT_BODY(queue));
+    MVM_incr(&shared->ref_count);
+    return shared;
+}
+
+/* Takes the item at the head of a queue if there is one, without waiting;
+ * returns NULL if the queue is empty. */
+MVMObject * MVM_concblockingqueue_poll(MVMThreadContext *tc, MVMObject *queue) {
+    MVMConcBlockingQueueShared *shared;
+    MVMObject                  *taken      = NULL;
+    MVMAsyncCompletion         *completion = NULL;
+    MVMint32                    found;
+    if (REPR(queue)->ID != MVM_REPR_ID_ConcBlockingQueue || !IS_CONCRETE(queue))
+        MVM_exception_throw_adhoc(tc, "queuepoll requires a concrete ConcBlockingQueue");
+    shared = get_shared(tc, OBJECT_BODY(queue));
+
+    /* Only take the mutex if there may be something to take. */
+    if (!MVM_load(&shared->elems))
+        return NULL;
+    uv_mutex_lock(&shared->mutex);
+    found = try_dequeue(shared, &taken, &completion);
+    uv_mutex_unlock(&shared->mutex);
+    return found ? dequeued_object(tc, taken, completion) : NULL;
+}
+
+/* Posts a completion to a queue. May be called from any thread. */
+void MVM_concblockingqueue_post(MVMConcBlockingQueueShared *shared, MVMAsyncCompletion *completion) {
+    MVMConcBlockingQueueNode *node = calloc(1, sizeof(MVMConcBlockingQueueNode));
+    node->completion = completion;
+    enqueue(shared, node);
+}
+
+/* Lets go of a reference to a queue, freeing it if it was the last. Any
+ * completions still in it are dropped. */
+void MVM_concblockingqueue_release(MVMThreadContext *tc, MVMConcBlockingQueueShared *shared) {
+    if (MVM_decr(&shared->ref_count) == 1) {
+        MVMConcBlockingQueueNode *node = shared->head;
+        while (node) {
+            MVMConcBlockingQueueNode *next = (MVMConcBlockingQueueNode *)node->next;
+            if (node->completion)
+                MVM_io_eventloop_completion_free(tc, node->completion);
+            free(node);
+            node = next;
+        }
+        uv_cond_destroy(&shared->cond);
+        uv_mutex_destroy(&shared->mutex);
+        free(shared);
+    }
+}
@@ -0,0 +1,57 @@
+/* A queue that many threads may push to and shift from, where a shift from
+ * an empty queue blocks until something is pushed, and a poll returns null.
+ * Besides objects pushed by VM threads, it takes completions posted by the
+ * event loop thread (see io/eventloop.c), which can't allocate objects; a
+ * completion is turned into an object by the thread that shifts it. The
+ * queue proper lives outside of the object, since the event loop may still
+ * post to it after the object is collected.
+ *
+ * Pushing is lock-free: a producer swings the tail to its node, then links
+ * the node it replaced to it. The head is a dummy node whose value has been
+ * taken already; the next node is the first in the queue. Consumers take
+ * turns under a mutex, which is also what waiting consumers sleep on. A
+ * consumer only frees a node once the node after it is linked, so it never
+ * frees one a producer still has to link. */
+
+/* A node in the queue, holding either an object or a completion. */
+struct MVMConcBlockingQueueNode {
+    MVMObject          *value;
+    MVMAsyncCompletion *completion;
+    AO_t                next;
+};
+
+/* The queue itself, shared between the object and any tasks posting to it;
+ * freed when the last of those lets go of it. */
+struct MVMConcBlockingQueueShared {
+    /* The dummy node at the head, only touched by consumers holding the
+     * mutex, and the last node, swung by producers. */
+    MVMConcBlockingQueueNode *head;
+    AO_t                      tail;
+
+    /* Number of items in the queue, and of consumers waiting on it. */
+    AO_t elems;
+    AO_t waiters;
+
+    uv_mutex_t mutex;
+    uv_cond_t  cond;
+    AO_t       ref_count;
+};
+
+struct MVMConcBlockingQueueBody {
+    MVMConcBlockingQueueShared *shared;
+};
+
+struct MVMConcBlockingQueue {
+    MVMObject common;
+    MVMConcBlockingQueueBody body;
+};
+
+/* Function for REPR setup. */
+const MVMREPROps * MVMConcBlockingQueue_initialize(MVMThreadContext *tc);
+
+MVMObject * MVM_concblockingqueue_poll(MVMThreadContext *tc, MVMObject *queue);
+
+/* Functions for posting completions from outside of the VM. */
+MVMConcBlockingQueueShared * MVM_concblockingqueue_shared(MVMThreadContext *tc, MVMObject *queue);
+void MVM_concblockingqueue_post(MVMConcBlockingQueueShared *shared, MVMAsyncCompletion *completion);
+void MVM_concblockingqueue_release(MVMThreadContext *tc, MVMConcBlockingQueueShared *shared);
@@ -1,8 +1,7 @@
 /* Representation used by HashAttrStore. */
 struct MVMHashAttrStoreBody {
-    /* The head of the hash, or null if the hash is empty.
-     * The UT_HASH macros update this pointer directly. */
-    MVMHashEntry *hash_head;
+    /* The attributes, stored the same way as in a VMHash. */
+    MVMHashBody hash;
 };
 struct MVMHashAttrStore {
     MVMObject common;
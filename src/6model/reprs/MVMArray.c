@@ -1,4 +1,5 @@
 #include "moar.h"
+#include "platform/mmap.h"
 
 /* This representation's function pointer table. */
 static const MVMREPROps this_repr;
@@ -40,9 +41,10 @@ static void copy_to(MVMThreadContext *tc, MVMSTable *st, void *src, MVMObject *d
     MVMArrayREPRData *repr_data = (MVMArrayREPRData *)st->REPR_data;
     MVMArrayBody     *src_body  = (MVMArrayBody *)src;
     MVMArrayBody     *dest_body = (MVMArrayBody *)dest;
-    dest_body->elems = src_body->elems;
-    dest_body->ssize = src_body->elems;
-    dest_body->start = 0;
+    dest_body->elems   = src_body->elems;
+    dest_body->ssize   = src_body->elems;
+    dest_body->start   = 0;
+    dest_body->mapping = NULL;
     if (dest_body->elems > 0) {
         size_t  mem_size     = dest_body->ssize * repr_data->elem_size;
         size_t  start_pos    = src_body->start * repr_data->elem_size;
@@ -87,9 +89,23 @@ static void gc_mark(MVMThreadContext *tc, MVMSTable *st, void *data, MVMGCWorkli
 /* Called by the VM in order to free memory associated with this object. */
 static void gc_free(MVMThreadContext *tc, MVMObject *obj) {
     MVMArray *arr = (MVMArray *)obj;
-    MVM_checked_free_null(arr->body.slots.any);
+    if (arr->body.mapping) {
+        MVM_array_free_mapping(tc, arr->body.mapping);
+        arr->body.mapping   = NULL;
+        arr->body.slots.any = NULL;
+    }
+    else {
+        MVM_checked_free_null(arr->body.slots.any);
+    }
 }
 
+/* Arrays whose slots are a memory-mapped file can be read and have elements
+ * popped and shifted off, but nothing else. */
+#define ENSURE_WRITABLE(tc, body, what) do { \
+    if ((body)->mapping) \
+        MVM_exception_throw_adhoc((tc), "MVMArray: Cannot %s a memory-mapped array", (what)); \
+} while (0)
+
 /* Marks the representation data in an STable.*/
 static void gc_mark_repr_data(MVMThreadContext *tc, MVMSTable *st, MVMGCWorklist *worklist) {
     MVMArrayREPRData *repr_data = (MVMArrayREPRData *)st->REPR_data;
@@ -343,6 +359,8 @@ static void bind_pos(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void
     MVMArrayREPRData *repr_data = (MVMArrayREPRData *)st->REPR_data;
     MVMArrayBody     *body      = (MVMArrayBody *)data;
 
+    ENSURE_WRITABLE(tc, body, "bind to");
+
     /* Handle negative indexes and resizing if needed. */
     if (index < 0) {
         index += body->elems;
@@ -427,6 +445,7 @@ static MVMuint64 elems(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, voi
 static void set_elems(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMuint64 count) {
     MVMArrayREPRData *repr_data = (MVMArrayREPRData *)st->REPR_data;
     MVMArrayBody     *body      = (MVMArrayBody *)data;
+    ENSURE_WRITABLE(tc, body, "resize");
     set_size_internal(tc, body, count, repr_data);
 }
 
@@ -448,6 +467,7 @@ MVMint64 exists_pos(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *
 static void push(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMRegister value, MVMuint16 kind) {
     MVMArrayBody     *body      = (MVMArrayBody *)data;
     MVMArrayREPRData *repr_data = (MVMArrayREPRData *)st->REPR_data;
+    ENSURE_WRITABLE(tc, body, "push to");
     set_size_internal(tc, body, body->elems + 1, repr_data);
     switch (repr_data->slot_type) {
         case MVM_ARRAY_OBJ:
@@ -594,6 +614,8 @@ static void unshift(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *
     MVMArrayREPRData *repr_data = (MVMArrayREPRData *)st->REPR_data;
     MVMArrayBody     *body      = (MVMArrayBody *)data;
 
+    ENSURE_WRITABLE(tc, body, "unshift to");
+
     /* If we don't have room at the beginning of the slots,
      * make some room (8 slots) for unshifting */
     if (body->start < 1) {
@@ -772,6 +794,8 @@ static void splice(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *d
     MVMint64 start;
     MVMint64 tail;
 
+    ENSURE_WRITABLE(tc, body, "splice");
+
     /* start from end? */
     if (offset < 0) {
         offset += elems0;
@@ -1221,3 +1245,24 @@ static const MVMREPROps this_repr = {
     MVM_REPR_ID_MVMArray,
     0, /* refs_frames */
 };
+
+/* Makes an array's slots the window onto a file a memory mapping was made
+ * for, letting go of any mapping it had before. The array must be a native
+ * array of 8-bit integers, with no slots of its own. */
+void MVM_array_set_mapping(MVMThreadContext *tc, MVMObject *arr, MVMArrayMapping *mapping, MVMuint64 length) {
+    MVMArrayBody *body = &((MVMArray *)arr)->body;
+    if (body->mapping)
+        MVM_array_free_mapping(tc, body->mapping);
+    body->mapping  = mapping;
+    body->slots.u8 = (MVMuint8 *)mapping->block;
+    body->start    = mapping->start;
+    body->ssize    = mapping->start + length;
+    body->elems    = length;
+}
+
+/* Unmaps and frees a mapping. */
+void MVM_array_free_mapping(MVMThreadContext *tc, MVMArrayMapping *mapping) {
+    if (mapping->block)
+        MVM_platform_unmap_file(mapping->block, mapping->handle, mapping->size);
+    free(mapping);
+}
@@ -26,6 +26,23 @@ struct MVMArrayBody {
         MVMuint8   *u8;
         void       *any;
     } slots;
+
+    /* If the slots are a read-only window onto a memory-mapped file rather
+     * than memory of our own, the mapping; NULL otherwise. */
+    MVMArrayMapping *mapping;
+};
+
+/* A memory mapping an array's slots are in. */
+struct MVMArrayMapping {
+    /* Start and size of the mapped block, and the platform's handle for the
+     * mapping. */
+    void   *block;
+    size_t  size;
+    void   *handle;
+
+    /* Where the part of the file that was asked for starts in the block;
+     * mappings must start on a boundary the platform dictates. */
+    size_t  start;
 };
 struct MVMArray {
     MVMObject common;
@@ -49,6 +66,10 @@ struct MVMArray {
 /* Function for REPR setup. */
 const MVMREPROps * MVMArray_initialize(MVMThreadContext *tc);
 
+/* Functions for arrays backed by a memory mapping. */
+void MVM_array_set_mapping(MVMThreadContext *tc, MVMObject *arr, MVMArrayMapping *mapping, MVMuint64 length);
+void MVM_array_free_mapping(MVMThreadContext *tc, MVMArrayMapping *mapping);
+
 /* Array REPR data specifies the type of array elements we have. */
 struct MVMArrayREPRData {
     /* The size of each element. */
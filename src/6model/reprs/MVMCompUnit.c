@@ -78,6 +78,7 @@ static void gc_free(MVMThreadContext *tc, MVMObject *obj) {
     MVM_checked_free_null(body->callsites);
     MVM_checked_free_null(body->extops);
     MVM_checked_free_null(body->strings);
+    MVM_checked_free_null(body->string_heap_fast_table);
     MVM_checked_free_null(body->scs);
     MVM_checked_free_null(body->scs_to_resolve);
     body->hll_config = NULL;
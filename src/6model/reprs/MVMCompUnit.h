@@ -41,10 +41,17 @@ struct MVMCompUnitBody {
     MVMExtOpRecord *extops;
     MVMuint16       num_extops;
 
-    /* The string heap and number of strings. */
+    /* The string heap and number of strings. Strings are only decoded
+     * when first used (see MVM_cu_string); until then, their entry is
+     * NULL. */
     MVMString **strings;
     MVMuint32   num_strings;
 
+    /* Where the encoded string heap starts, and the offset into it of every
+     * MVM_STRING_FAST_TABLE_SPAN'th string. */
+    MVMuint8  *string_heap_start;
+    MVMuint32 *string_heap_fast_table;
+
     /* Serialized data, if any. */
     char     *serialized;
     MVMint32  serialized_size;
@@ -72,6 +79,13 @@ struct MVMCompUnit {
     MVMCompUnitBody body;
 };
 
+/* Gets a string from a compilation unit's string heap, decoding it if this
+ * is the first time it's been asked for. Never triggers GC. */
+MVM_STATIC_INLINE MVMString * MVM_cu_string(MVMThreadContext *tc, MVMCompUnit *cu, MVMuint32 idx) {
+    MVMString *s = cu->body.strings[idx];
+    return s ? s : MVM_bytecode_obtain_string(tc, cu, idx);
+}
+
 struct MVMLoadedCompUnitName {
     /* Loaded filename. */
     MVMString *filename;
@@ -22,61 +22,230 @@ static MVMObject * allocate(MVMThreadContext *tc, MVMSTable *st) {
     return MVM_gc_allocate_object(tc, st);
 }
 
+/* Metadata bytes in the index. Occupied slots have the top bit set, along
+ * with the top 7 bits of the hash code of the entry they point at. */
+#define META_EMPTY      0
+#define META_DELETED    1
+#define META_TAG(hash)  (0x80 | ((hash) >> 25))
+
+#define INDEX_SLOTS(body) ((MVMuint32 *)((body)->index + (body)->index_size))
+
+/* Gets the hash code of a key, flattening it if needed. The hash code is
+ * the one uthash would use, so that it can be cached on the string and
+ * shared with uthash-based lookups. */
+static MVMuint32 hash_key(MVMThreadContext *tc, MVMString *key) {
+    if (!key->body.cached_hash_code) {
+        void     *kdata;
+        size_t    klen;
+        unsigned  hashv, bkt;
+        MVM_HASH_EXTRACT_KEY(tc, &kdata, &klen, (MVMObject *)key, "Hash keys must be concrete strings")
+        HASH_JEN(kdata, klen, 1, hashv, bkt);
+        (void)bkt; /* only wanted by uthash itself */
+        key->body.cached_hash_code = hashv;
+    }
+    return key->body.cached_hash_code;
+}
+
+/* Compares two keys that have been flattened. Like uthash, this compares
+ * their storage, so strings of differing widths never match. */
+static MVMint64 keys_equal(MVMString *a, MVMString *b) {
+    if (a == b)
+        return 1;
+    if (a->body.graphs != b->body.graphs || STR_FLAGS(a) != STR_FLAGS(b))
+        return 0;
+    return memcmp(a->body.storage, b->body.storage,
+        a->body.graphs * (IS_WIDE(a) ? sizeof(MVMCodepoint32) : sizeof(MVMCodepoint8))) == 0;
+}
+
+/* Finds the entry for a key. Returns its position in the entries, or -1
+ * if there is none; if the hash has an index, *slot_out is set to the
+ * index slot pointing at it. */
+static MVMint64 lookup(MVMThreadContext *tc, MVMHashBody *body, MVMString *key,
+        MVMuint32 hash, MVMuint32 *slot_out) {
+    if (!body->index) {
+        MVMuint32 i;
+        for (i = 0; i < body->num_entries; i++) {
+            MVMHashEntry *entry = &body->entries[i];
+            if (entry->hash == hash && entry->key && keys_equal((MVMString *)entry->key, key))
+                return i;
+        }
+        return -1;
+    }
+    else {
+        MVMuint8  *meta  = body->index;
+        MVMuint32 *slots = INDEX_SLOTS(body);
+        MVMuint32  mask  = body->index_size - 1;
+        MVMuint32  slot  = hash & mask;
+        MVMuint8   tag   = META_TAG(hash);
+        while (meta[slot] != META_EMPTY) {
+            if (meta[slot] == tag) {
+                MVMHashEntry *entry = &body->entries[slots[slot]];
+                if (entry->hash == hash && keys_equal((MVMString *)entry->key, key)) {
+                    *slot_out = slot;
+                    return slots[slot];
+                }
+            }
+            slot = (slot + 1) & mask;
+        }
+        return -1;
+    }
+}
+
+/* Adds an entry to the index. The key must not already be in the hash. */
+static void index_insert(MVMHashBody *body, MVMuint32 hash, MVMuint32 pos) {
+    MVMuint8  *meta  = body->index;
+    MVMuint32 *slots = INDEX_SLOTS(body);
+    MVMuint32  mask  = body->index_size - 1;
+    MVMuint32  slot  = hash & mask;
+    while (meta[slot] & 0x80)
+        slot = (slot + 1) & mask;
+    if (meta[slot] == META_EMPTY)
+        body->index_used++;
+    meta[slot]  = META_TAG(hash);
+    slots[slot] = pos;
+}
+
+/* Resizes the entries to the given size, squeezing out holes, and builds
+ * an index for them if the hash is big enough to need one. Entries never
+ * outnumber 7/8 of the index slots, so probing always finds an empty one.
+ * Squeezing out holes moves entries, so iterators part way through the
+ * hash are left at positions that now hold other entries (see MVMIter.h).
+ * This only happens when a key is added. */
+static void resize(MVMThreadContext *tc, MVMHashBody *body, MVMuint32 alloc_entries) {
+    MVMuint32 from, to = 0;
+    for (from = 0; from < body->num_entries; from++)
+        if (body->entries[from].key)
+            body->entries[to++] = body->entries[from];
+    body->num_entries   = to;
+    body->alloc_entries = alloc_entries;
+    body->entries       = realloc(body->entries, alloc_entries * sizeof(MVMHashEntry));
+
+    MVM_checked_free_null(body->index);
+    body->index_size = 0;
+    body->index_used = 0;
+    if (alloc_entries > MVM_HASH_MAX_LINEAR) {
+        MVMuint32 size = 16;
+        while (size / 8 * 7 < alloc_entries)
+            size *= 2;
+        body->index      = malloc(size * (1 + sizeof(MVMuint32)));
+        body->index_size = size;
+        memset(body->index, META_EMPTY, size);
+        for (from = 0; from < body->num_entries; from++)
+            index_insert(body, body->entries[from].hash, from);
+    }
+}
+
+/* Looks up a key, returning its entry or NULL if there is none. */
+MVMHashEntry * MVM_hash_find(MVMThreadContext *tc, MVMHashBody *body, MVMString *key) {
+    MVMuint32 hash = hash_key(tc, key), slot;
+    MVMint64  pos  = lookup(tc, body, key, hash, &slot);
+    return pos >= 0 ? &body->entries[pos] : NULL;
+}
+
+/* Binds a value to a key, adding an entry for it if needed. */
+void MVM_hash_bind(MVMThreadContext *tc, MVMObject *root, MVMHashBody *body, MVMString *key, MVMObject *value) {
+    MVMuint32     hash = hash_key(tc, key), slot;
+    MVMint64      pos  = lookup(tc, body, key, hash, &slot);
+    MVMHashEntry *entry;
+    if (pos < 0) {
+        /* Out of room: grow, unless squeezing out holes frees up enough. */
+        if (body->num_entries == body->alloc_entries)
+            resize(tc, body, body->alloc_entries == 0 ? 4 :
+                body->num_items < body->alloc_entries / 2 ? body->alloc_entries :
+                body->alloc_entries * 2);
+        pos   = body->num_entries++;
+        entry = &body->entries[pos];
+        entry->key   = NULL;
+        entry->value = NULL;
+        entry->hash  = hash;
+        if (body->index)
+            index_insert(body, hash, pos);
+        body->num_items++;
+    }
+    entry = &body->entries[pos];
+    MVM_ASSIGN_REF(tc, &(root->header), entry->key, (MVMObject *)key);
+    MVM_ASSIGN_REF(tc, &(root->header), entry->value, value);
+}
+
+/* Deletes a key, if present. */
+void MVM_hash_delete(MVMThreadContext *tc, MVMHashBody *body, MVMString *key) {
+    MVMuint32 hash = hash_key(tc, key), slot;
+    MVMint64  pos  = lookup(tc, body, key, hash, &slot);
+    if (pos >= 0) {
+        body->entries[pos].key   = NULL;
+        body->entries[pos].value = NULL;
+        if (body->index)
+            body->index[slot] = META_DELETED;
+        body->num_items--;
+    }
+}
+
+/* Copies a hash body; the entries and index can be taken over as is. */
+void MVM_hash_copy(MVMThreadContext *tc, MVMObject *dest_root, MVMHashBody *dest, MVMHashBody *src) {
+    MVMuint32 i;
+    *dest = *src;
+    if (src->alloc_entries) {
+        dest->entries = malloc(src->alloc_entries * sizeof(MVMHashEntry));
+        memcpy(dest->entries, src->entries, src->num_entries * sizeof(MVMHashEntry));
+    }
+    if (src->index) {
+        dest->index = malloc(src->index_size * (1 + sizeof(MVMuint32)));
+        memcpy(dest->index, src->index, src->index_size * (1 + sizeof(MVMuint32)));
+    }
+    for (i = 0; i < dest->num_entries; i++) {
+        MVMHashEntry *entry = &dest->entries[i];
+        if (entry->key) {
+            MVM_ASSIGN_REF(tc, &(dest_root->header), entry->key, entry->key);
+            MVM_ASSIGN_REF(tc, &(dest_root->header), entry->value, entry->value);
+        }
+    }
+}
+
+/* Adds the keys and values of a hash body to the GC worklist. */
+void MVM_hash_gc_mark(MVMThreadContext *tc, MVMHashBody *body, MVMGCWorklist *worklist) {
+    MVMuint32 i;
+    for (i = 0; i < body->num_entries; i++) {
+        MVM_gc_worklist_add(tc, worklist, &body->entries[i].key);
+        MVM_gc_worklist_add(tc, worklist, &body->entries[i].value);
+    }
+}
+
+/* Frees the memory held by a hash body. */
+void MVM_hash_free(MVMThreadContext *tc, MVMHashBody *body) {
+    MVM_checked_free_null(body->entries);
+    MVM_checked_free_null(body->index);
+    body->num_entries = body->alloc_entries = body->num_items = 0;
+    body->index_size  = body->index_used    = 0;
+}
+
 /* Initialize a new instance. */
 static void initialize(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data) {
-    MVMHashBody *body = (MVMHashBody *)data;
-
-    /* this must be initialized to NULL */
-    body->hash_head = NULL;
+    /* The body was zeroed on allocation, which is an empty hash. */
 }
 
-static void extract_key(MVMThreadContext *tc, void **kdata, size_t *klen, MVMObject *key) {
-    MVM_HASH_EXTRACT_KEY(tc, kdata, klen, key, "MVMHash representation requires MVMString keys")
+static MVMString * check_key(MVMThreadContext *tc, MVMObject *key) {
+    if (REPR(key)->ID != MVM_REPR_ID_MVMString || !IS_CONCRETE(key))
+        MVM_exception_throw_adhoc(tc, "MVMHash representation requires MVMString keys");
+    return (MVMString *)key;
 }
 
 /* Copies the body of one object to another. */
 static void copy_to(MVMThreadContext *tc, MVMSTable *st, void *src, MVMObject *dest_root, void *dest) {
-    MVMHashBody *src_body  = (MVMHashBody *)src;
-    MVMHashBody *dest_body = (MVMHashBody *)dest;
-    MVMHashEntry *current, *tmp;
-
-    /* NOTE: if we really wanted to, we could avoid rehashing... */
-    HASH_ITER(hash_handle, src_body->hash_head, current, tmp) {
-        size_t klen;
-        void *kdata;
-        MVMHashEntry *new_entry = malloc(sizeof(MVMHashEntry));
-        MVM_ASSIGN_REF(tc, &(dest_root->header), new_entry->key, current->key);
-        MVM_ASSIGN_REF(tc, &(dest_root->header), new_entry->value, current->value);
-        extract_key(tc, &kdata, &klen, new_entry->key);
-
-        HASH_ADD_KEYPTR(hash_handle, dest_body->hash_head, kdata, klen, new_entry);
-    }
+    MVM_hash_copy(tc, dest_root, (MVMHashBody *)dest, (MVMHashBody *)src);
 }
 
 /* Adds held objects to the GC worklist. */
 static void gc_mark(MVMThreadContext *tc, MVMSTable *st, void *data, MVMGCWorklist *worklist) {
-    MVMHashBody *body = (MVMHashBody *)data;
-    MVMHashEntry *current, *tmp;
-
-    HASH_ITER(hash_handle, body->hash_head, current, tmp) {
-        MVM_gc_worklist_add(tc, worklist, &current->key);
-        MVM_gc_worklist_add(tc, worklist, &current->value);
-    }
+    MVM_hash_gc_mark(tc, (MVMHashBody *)data, worklist);
 }
 
 /* Called by the VM in order to free memory associated with this object. */
 static void gc_free(MVMThreadContext *tc, MVMObject *obj) {
-    MVMHash *h = (MVMHash *)obj;
-    MVM_HASH_DESTROY(hash_handle, MVMHashEntry, h->body.hash_head);
+    MVM_hash_free(tc, &((MVMHash *)obj)->body);
 }
 
 static void at_key(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMObject *key, MVMRegister *result, MVMuint16 kind) {
-    MVMHashBody *body = (MVMHashBody *)data;
-    void *kdata;
-    MVMHashEntry *entry;
-    size_t klen;
-    extract_key(tc, &kdata, &klen, key);
-    HASH_FIND(hash_handle, body->hash_head, kdata, klen, entry);
+    MVMHashEntry *entry = MVM_hash_find(tc, (MVMHashBody *)data, check_key(tc, key));
     if (kind == MVM_reg_obj)
         result->o = entry != NULL ? entry->value : NULL;
     else
@@ -85,59 +254,23 @@ static void at_key(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *d
 }
 
 static void bind_key(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMObject *key, MVMRegister value, MVMuint16 kind) {
-    MVMHashBody *body = (MVMHashBody *)data;
-    void *kdata;
-    MVMHashEntry *entry;
-    size_t klen;
-
-    extract_key(tc, &kdata, &klen, key);
-
-    /* first check whether we can must update the old entry. */
-    HASH_FIND(hash_handle, body->hash_head, kdata, klen, entry);
-    if (!entry) {
-        entry = malloc(sizeof(MVMHashEntry));
-        HASH_ADD_KEYPTR(hash_handle, body->hash_head, kdata, klen, entry);
-    }
-    else
-        entry->hash_handle.key = (void *)kdata;
-    MVM_ASSIGN_REF(tc, &(root->header), entry->key, key);
-    if (kind == MVM_reg_obj) {
-        MVM_ASSIGN_REF(tc, &(root->header), entry->value, value.o);
-    }
-    else {
+    MVMString *key_str = check_key(tc, key);
+    if (kind != MVM_reg_obj)
         MVM_exception_throw_adhoc(tc,
             "MVMHash representation does not support native type storage");
-    }
+    MVM_hash_bind(tc, root, (MVMHashBody *)data, key_str, value.o);
 }
 
 static MVMuint64 elems(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data) {
-    MVMHashBody *body = (MVMHashBody *)data;
-    return HASH_CNT(hash_handle, body->hash_head);
+    return ((MVMHashBody *)data)->num_items;
 }
 
 static MVMint64 exists_key(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMObject *key) {
-    MVMHashBody *body = (MVMHashBody *)data;
-    void *kdata;
-    MVMHashEntry *entry;
-    size_t klen;
-    extract_key(tc, &kdata, &klen, key);
-
-    HASH_FIND(hash_handle, body->hash_head, kdata, klen, entry);
-    return entry != NULL;
+    return MVM_hash_find(tc, (MVMHashBody *)data, check_key(tc, key)) != NULL;
 }
 
 static void delete_key(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMObject *key) {
-    MVMHashBody *body = (MVMHashBody *)data;
-    MVMHashEntry *old_entry;
-    size_t klen;
-    void *kdata;
-    extract_key(tc, &kdata, &klen, key);
-
-    HASH_FIND(hash_handle, body->hash_head, kdata, klen, old_entry);
-    if (old_entry) {
-        HASH_DELETE(hash_handle, body->hash_head, old_entry);
-        free(old_entry);
-    }
+    MVM_hash_delete(tc, (MVMHashBody *)data, check_key(tc, key));
 }
 
 static MVMStorageSpec get_value_storage_spec(MVMThreadContext *tc, MVMSTable *st) {
@@ -1,30 +1,73 @@
-/* Representation used by VM-level hashes. */
+/* Representation used by VM-level hashes.
+ *
+ * Entries live inline in a single array, in the order they were added,
+ * which is also the order in which they are iterated. Deleting an entry
+ * leaves a hole (an entry with a NULL key) until the array is next
+ * resized. Small hashes are searched linearly, comparing the cached hash
+ * codes first; larger ones have an open-addressing index of power-of-two
+ * size, with linear probing. The index holds a metadata byte per slot
+ * (empty, deleted, or the top bits of the hash code of the entry it points
+ * at) followed by the 32-bit entry indices. */
+
+/* Hashes with at most this many entries allocated have no index. */
+#define MVM_HASH_MAX_LINEAR 8
 
 struct MVMHashEntry {
-    /* key object (must be MVMString REPR) */
+    /* key object (must be MVMString REPR); NULL if deleted */
     MVMObject *key;
 
     /* value object */
     MVMObject *value;
 
-    /* the uthash hash handle inline struct. */
-    UT_hash_handle hash_handle;
+    /* the hash code of the key */
+    MVMuint32 hash;
 };
 
 struct MVMHashBody {
+    /* The entries, in insertion order. */
+    MVMHashEntry *entries;
+
+    /* The index, or NULL for small hashes. */
+    MVMuint8 *index;
 
-    /* uthash updates this pointer directly. */
-    MVMHashEntry *hash_head;
+    /* Number of entries used (including holes) and allocated. */
+    MVMuint32 num_entries;
+    MVMuint32 alloc_entries;
 
+    /* Number of live entries. */
+    MVMuint32 num_items;
+
+    /* Number of index slots, and how many of them are not empty. */
+    MVMuint32 index_size;
+    MVMuint32 index_used;
 };
 struct MVMHash {
     MVMObject common;
     MVMHashBody body;
 };
 
+/* Gets the position of the first live entry at or after the given one, or
+ * num_entries if there is none. */
+MVM_STATIC_INLINE MVMuint32 MVM_hash_next_entry(MVMHashBody *body, MVMuint32 pos) {
+    while (pos < body->num_entries && !body->entries[pos].key)
+        pos++;
+    return pos;
+}
+
 /* Function for REPR setup. */
 const MVMREPROps * MVMHash_initialize(MVMThreadContext *tc);
 
+/* Operations on hash bodies, also used by HashAttrStore. */
+MVMHashEntry * MVM_hash_find(MVMThreadContext *tc, MVMHashBody *body, MVMString *key);
+void MVM_hash_bind(MVMThreadContext *tc, MVMObject *root, MVMHashBody *body, MVMString *key, MVMObject *value);
+void MVM_hash_delete(MVMThreadContext *tc, MVMHashBody *body, MVMString *key);
+void MVM_hash_copy(MVMThreadContext *tc, MVMObject *dest_root, MVMHashBody *dest, MVMHashBody *src);
+void MVM_hash_gc_mark(MVMThreadContext *tc, MVMHashBody *body, MVMGCWorklist *worklist);
+void MVM_hash_free(MVMThreadContext *tc, MVMHashBody *body);
+
+/* The following macros work with uthash-based hashes keyed on strings, as
+ * used for lexical names and other VM-internal lookups. */
+
 #define MVM_HASH_ACTION(tc, hash, name, entry, action, member, size) \
     action(hash_handle, hash, \
         name->body.int32s, NUM_GRAPHS(name) * sizeof(size), entry); \
@@ -107,22 +107,16 @@ static void shift(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *da
                 MVM_exception_throw_adhoc(tc, "Wrong register kind in iteration");
             }
             return;
-        case MVM_ITER_MODE_HASH:
-            if (!body->hash_state.curr) {
-                if (body->hash_state.next) {
-                    body->hash_state.curr = body->hash_state.next;
-                    body->hash_state.next = body->hash_state.next->hash_handle.next;
-                }
-                else {
-                    MVM_exception_throw_adhoc(tc, "Iteration past end of iterator");
-                }
-            }
-            else {
-                body->hash_state.curr = body->hash_state.curr->hash_handle.next;
-                body->hash_state.next = body->hash_state.curr->hash_handle.next;
-            }
+        case MVM_ITER_MODE_HASH: {
+            MVMHashBody *hash = &((MVMHash *)target)->body;
+            MVMuint32    next = MVM_hash_next_entry(hash, body->hash_state.next);
+            if (next >= hash->num_entries)
+                MVM_exception_throw_adhoc(tc, "Iteration past end of iterator");
+            body->hash_state.curr = next;
+            body->hash_state.next = next + 1;
             value->o = root;
             return;
+        }
         default:
             MVM_exception_throw_adhoc(tc, "Unknown iteration mode");
     }
@@ -216,7 +210,8 @@ MVMObject * MVM_iter(MVMThreadContext *tc, MVMObject *target) {
             iterator = (MVMIter *)MVM_repr_alloc_init(tc,
                 MVM_hll_current(tc)->hash_iterator_type);
             iterator->body.mode = MVM_ITER_MODE_HASH;
-            iterator->body.hash_state.next = ((MVMHash *)target)->body.hash_head;
+            iterator->body.hash_state.next = 0;
+            iterator->body.hash_state.curr = MVM_ITER_HASH_NONE;
             MVM_ASSIGN_REF(tc, &(iterator->common.header), iterator->body.target, target);
         }
         else if (REPR(target)->ID == MVM_REPR_ID_MVMContext) {
@@ -255,21 +250,31 @@ MVMint64 MVM_iter_istrue(MVMThreadContext *tc, MVMIter *iter) {
         case MVM_ITER_MODE_ARRAY_STR:
             return iter->body.array_state.index + 1 < iter->body.array_state.limit ? 1 : 0;
             break;
-        case MVM_ITER_MODE_HASH:
-            return iter->body.hash_state.next != NULL ? 1 : 0;
+        case MVM_ITER_MODE_HASH: {
+            MVMHashBody *hash = &((MVMHash *)iter->body.target)->body;
+            return MVM_hash_next_entry(hash, iter->body.hash_state.next) < hash->num_entries ? 1 : 0;
+        }
             break;
         default:
             MVM_exception_throw_adhoc(tc, "Invalid iteration mode used");
     }
 }
 
+/* Gets the hash entry a hash iterator is at. If it was deleted since the
+ * iterator got there, we treat that like being past the end. */
+static MVMHashEntry * current_hash_entry(MVMThreadContext *tc, MVMIter *iterator) {
+    MVMHashBody *hash = &((MVMHash *)iterator->body.target)->body;
+    MVMuint32    curr = iterator->body.hash_state.curr;
+    if (curr >= hash->num_entries || !hash->entries[curr].key)
+        MVM_exception_throw_adhoc(tc, "You have not advanced to the first item of the hash iterator, or have gone past the end");
+    return &hash->entries[curr];
+}
+
 MVMString * MVM_iterkey_s(MVMThreadContext *tc, MVMIter *iterator) {
     if (REPR(iterator)->ID != MVM_REPR_ID_MVMIter
             || iterator->body.mode != MVM_ITER_MODE_HASH)
         MVM_exception_throw_adhoc(tc, "This is not a hash iterator");
-    if (!iterator->body.hash_state.curr)
-        MVM_exception_throw_adhoc(tc, "You have not advanced to the first item of the hash iterator, or have gone past the end");
-    return (MVMString *)iterator->body.hash_state.curr->key;
+    return (MVMString *)current_hash_entry(tc, iterator)->key;
 }
 
 MVMObject * MVM_iterval(MVMThreadContext *tc, MVMIter *iterator) {
@@ -286,9 +291,7 @@ MVMObject * MVM_iterval(MVMThreadContext *tc, MVMIter *iterator) {
         REPR(target)->pos_funcs.at_pos(tc, STABLE(target), target, OBJECT_BODY(target), body->array_state.index, &result, MVM_reg_obj);
     }
     else if (iterator->body.mode == MVM_ITER_MODE_HASH) {
-        if (!iterator->body.hash_state.curr)
-        MVM_exception_throw_adhoc(tc, "You have not advanced to the first item of the hash iterator, or have gone past the end");
-        result.o = iterator->body.hash_state.curr->value;
+        result.o = current_hash_entry(tc, iterator)->value;
     }
     else {
         MVM_exception_throw_adhoc(tc, "Unknown iterator mode in iterval");
@@ -6,6 +6,8 @@
 #define MVM_ITER_MODE_ARRAY_STR     3
 #define MVM_ITER_MODE_HASH          4
 
+#define MVM_ITER_HASH_NONE          0xFFFFFFFF
+
 struct MVMIterBody {
     /* whether hash or array */
     MVMuint32 mode;
@@ -16,8 +18,13 @@ struct MVMIterBody {
     /* next hash item to give or next array index */
     union {
         struct {
-            MVMHashEntry *next;
-            MVMHashEntry *curr;
+            /* Positions in the hash's entries; curr is MVM_ITER_HASH_NONE
+             * until the first shift. Deleting keys leaves these be, but
+             * adding one may make the hash squeeze out the holes deleted
+             * keys left, moving entries back; the positions then stay in
+             * bounds, but the iteration may skip or repeat entries. */
+            MVMuint32 next;
+            MVMuint32 curr;
         } hash_state;
         struct {
             MVMint64 index;
@@ -3,6 +3,15 @@
 /* This representation's function pointer table. */
 static const MVMREPROps this_repr;
 
+/* Put in each slot of a table once it has been replaced by a bigger one, so
+ * that threads still adding to it know to go and look for the new one. */
+#define RETIRED_SLOT ((AO_t)1)
+#define IS_ENTRY(e)  ((AO_t)(e) > RETIRED_SLOT)
+
+/* Number of positional arguments we can build a key for without having to
+ * allocate memory for it. */
+#define KEY_BUFFER_SIZE 16
+
 /* Creates a new type object of this representation, and associates it with
  * the given HOW. */
 static MVMObject * type_object_for(MVMThreadContext *tc, MVMObject *HOW) {
@@ -29,24 +38,34 @@ static void copy_to(MVMThreadContext *tc, MVMSTable *st, void *src, MVMObject *d
 
 /* Called by the VM to mark any GCable items. */
 static void gc_mark(MVMThreadContext *tc, MVMSTable *st, void *data, MVMGCWorklist *worklist) {
-    MVMMultiCacheBody *mc = (MVMMultiCacheBody *)data;
-    MVMint64 i, j;
+    MVMMultiCacheBody  *mc    = (MVMMultiCacheBody *)data;
+    MVMMultiCacheTable *table = (MVMMultiCacheTable *)MVM_load(&mc->table);
 
     MVM_gc_worklist_add(tc, worklist, &mc->zero_arity);
 
-    for (i = 0; i < MVM_MULTICACHE_MAX_ARITY; i++)
-        for (j = 0; j < mc->arity_caches[i].num_entries; j++)
-            MVM_gc_worklist_add(tc, worklist, &mc->arity_caches[i].results[j]);
+    if (table) {
+        MVMuint32 i, num_slots = table->num_buckets * MVM_MULTICACHE_BUCKET_SIZE;
+        for (i = 0; i < num_slots; i++) {
+            MVMMultiCacheEntry *entry = (MVMMultiCacheEntry *)table->slots[i];
+            if (IS_ENTRY(entry))
+                MVM_gc_worklist_add(tc, worklist, &entry->result);
+        }
+    }
 }
 
 /* Called by the VM in order to free memory associated with this object. */
 static void gc_free(MVMThreadContext *tc, MVMObject *obj) {
-    MVMMultiCache *mc = (MVMMultiCache *)obj;
-    MVMint64 i;
-    for (i = 0; i < MVM_MULTICACHE_MAX_ARITY; i++) {
-        MVM_checked_free_null(mc->body.arity_caches[i].type_ids);
-        MVM_checked_free_null(mc->body.arity_caches[i].named_ok);
-        MVM_checked_free_null(mc->body.arity_caches[i].results);
+    MVMMultiCache      *mc    = (MVMMultiCache *)obj;
+    MVMMultiCacheTable *table = (MVMMultiCacheTable *)MVM_load(&mc->body.table);
+    if (table) {
+        MVMuint32 i, num_slots = table->num_buckets * MVM_MULTICACHE_BUCKET_SIZE;
+        for (i = 0; i < num_slots; i++) {
+            MVMMultiCacheEntry *entry = (MVMMultiCacheEntry *)table->slots[i];
+            if (IS_ENTRY(entry))
+                free(entry);
+        }
+        free(table);
+        mc->body.table = 0;
     }
 }
 
@@ -97,13 +116,198 @@ static const MVMREPROps this_repr = {
     0, /* refs_frames */
 };
 
+/* Works out the key for each positional argument of a call, which is the
+ * type cache ID and concreteness of the (decontainerized) object passed, or
+ * the kind of a native argument. Returns zero if the arguments can't be
+ * cached on. */
+static MVMint32 make_key(MVMThreadContext *tc, MVMCallsite *cs, MVMArgProcContext *apc,
+                         MVMuint16 num_args, MVMuint64 *arg_tup) {
+    MVMuint16 i;
+    for (i = 0; i < num_args; i++) {
+        MVMuint8 arg_type = cs->arg_flags[i] & MVM_CALLSITE_ARG_MASK;
+        if (arg_type == MVM_CALLSITE_ARG_OBJ) {
+            MVMObject *arg = MVM_args_get_pos_obj(tc, apc, i, 1).arg.o;
+            if (arg) {
+                MVMContainerSpec const *contspec = STABLE(arg)->container_spec;
+                if (contspec) {
+                    if (contspec->fetch_never_invokes) {
+                        MVMRegister r;
+                        contspec->fetch(tc, arg, &r);
+                        arg = r.o;
+                    }
+                    else {
+                        return 0;
+                    }
+                }
+                if (!arg)
+                    return 0;
+                arg_tup[i] = STABLE(arg)->type_cache_id | (IS_CONCRETE(arg) ? 1 : 0);
+            }
+            else {
+                return 0;
+            }
+        }
+        else {
+            arg_tup[i] = (arg_type << 1) | 1;
+        }
+    }
+    return 1;
+}
+
+/* Hashes a key. Type cache IDs only differ above their lowest few bits, so
+ * the high bits are folded back down to pick buckets with. */
+static MVMuint64 hash_key(MVMuint64 *arg_tup, MVMuint16 num_args, MVMuint8 named_ok) {
+    MVMuint64 hash = 14695981039346656037ULL ^ (((MVMuint64)num_args << 1) | named_ok);
+    MVMuint16 i;
+    for (i = 0; i < num_args; i++) {
+        hash ^= arg_tup[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash ^ (hash >> 32) ^ (hash >> 15);
+}
+
+/* Checks if an entry has the given key. */
+static MVMint32 entry_matches(MVMMultiCacheEntry *entry, MVMuint64 hash, MVMuint64 *arg_tup,
+                              MVMuint16 num_args, MVMuint8 named_ok) {
+    return entry->hash == hash && entry->num_args == num_args &&
+        entry->named_ok == named_ok &&
+        memcmp(entry->arg_tup, arg_tup, num_args * sizeof(MVMuint64)) == 0;
+}
+
+/* Allocates a table with the given number of buckets, all empty. */
+static MVMMultiCacheTable * table_create(MVMuint32 num_buckets) {
+    size_t num_slots = num_buckets * MVM_MULTICACHE_BUCKET_SIZE;
+    MVMMultiCacheTable *table = calloc(1, sizeof(MVMMultiCacheTable) + (num_slots - 1) * sizeof(AO_t));
+    table->num_buckets = num_buckets;
+    return table;
+}
+
+/* Size of an entry able to hold a key of the given number of
+ * positionals. */
+static size_t entry_size(MVMuint16 num_args) {
+    return sizeof(MVMMultiCacheEntry) + (num_args ? num_args - 1 : 0) * sizeof(MVMuint64);
+}
+
+/* Replaces a cache's table with one twice its size. The entries are copied,
+ * so that the old table and everything in it can be freed as a whole once
+ * no other thread can be looking at it. */
+static void grow(MVMThreadContext *tc, MVMMultiCacheBody *cache, MVMMultiCacheTable *old) {
+    MVMMultiCacheTable *new_table = table_create(old->num_buckets * 2);
+    MVMuint32 mask      = new_table->num_buckets - 1;
+    MVMuint32 num_slots = old->num_buckets * MVM_MULTICACHE_BUCKET_SIZE;
+    MVMuint32 i, j;
+
+    /* Each new bucket takes entries from just one old one, so always has
+     * room for them. */
+    for (i = 0; i < num_slots; i++) {
+        MVMMultiCacheEntry *entry = (MVMMultiCacheEntry *)MVM_load(&old->slots[i]);
+        if (IS_ENTRY(entry)) {
+            size_t  size = entry_size(entry->num_args);
+            AO_t   *slot = &new_table->slots[(entry->hash & mask) * MVM_MULTICACHE_BUCKET_SIZE];
+            MVMMultiCacheEntry *copy = malloc(size);
+            memcpy(copy, entry, size);
+            for (j = 0; j < MVM_MULTICACHE_BUCKET_SIZE; j++) {
+                if (!slot[j]) {
+                    slot[j] = (AO_t)copy;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (MVM_trycas(&cache->table, old, new_table)) {
+        /* Retire the old table. Its slots are swapped for a marker, so that
+         * a thread adding to it concurrently fails and starts over. */
+        for (i = 0; i < num_slots; i++) {
+            AO_t entry;
+            do {
+                entry = MVM_load(&old->slots[i]);
+            } while (!MVM_trycas(&old->slots[i], entry, RETIRED_SLOT));
+            if (IS_ENTRY(entry))
+                MVM_gc_free_at_safepoint(tc, (void *)entry);
+        }
+        MVM_gc_free_at_safepoint(tc, old);
+    }
+    else {
+        /* Another thread got there first; throw away our copy. */
+        num_slots = new_table->num_buckets * MVM_MULTICACHE_BUCKET_SIZE;
+        for (i = 0; i < num_slots; i++)
+            if (new_table->slots[i])
+                free((void *)new_table->slots[i]);
+        free(new_table);
+    }
+}
+
+/* Puts an entry into a cache, growing its table or evicting the least
+ * recently used entry from the bucket it hashes to if that is full. */
+static void insert(MVMThreadContext *tc, MVMMultiCacheBody *cache, MVMMultiCacheEntry *entry) {
+    while (1) {
+        MVMMultiCacheTable *table = (MVMMultiCacheTable *)MVM_load(&cache->table);
+        AO_t               *slots;
+        MVMMultiCacheEntry *victim   = NULL;
+        MVMuint32           victim_i = 0, i;
+        MVMint32            retry    = 0;
+
+        /* Create the table if there isn't one yet. */
+        if (!table) {
+            table = table_create(MVM_MULTICACHE_MIN_BUCKETS);
+            if (!MVM_trycas(&cache->table, 0, table)) {
+                free(table);
+                continue;
+            }
+        }
+
+        /* Look for a free slot in the bucket, noting the least recently
+         * used entry as we go. */
+        slots = &table->slots[(entry->hash & (table->num_buckets - 1)) * MVM_MULTICACHE_BUCKET_SIZE];
+        for (i = 0; i < MVM_MULTICACHE_BUCKET_SIZE; i++) {
+            MVMMultiCacheEntry *cur = (MVMMultiCacheEntry *)MVM_load(&slots[i]);
+            if (!cur) {
+                if (MVM_trycas(&slots[i], 0, entry))
+                    return;
+                retry = 1;
+                break;
+            }
+            if ((AO_t)cur == RETIRED_SLOT) {
+                retry = 1;
+                break;
+            }
+            if (entry_matches(cur, entry->hash, entry->arg_tup, entry->num_args, entry->named_ok)) {
+                /* Another thread already cached this. */
+                free(entry);
+                return;
+            }
+            if (!victim || (MVMint32)(cur->last_used - victim->last_used) < 0) {
+                victim   = cur;
+                victim_i = i;
+            }
+        }
+        if (retry)
+            continue;
+
+        /* The bucket is full. Grow the table if we still may; otherwise,
+         * evict. If we lose a race to evict, just don't cache this. */
+        if (table->num_buckets < MVM_MULTICACHE_MAX_BUCKETS) {
+            grow(tc, cache, table);
+            continue;
+        }
+        if (MVM_trycas(&slots[victim_i], victim, entry))
+            MVM_gc_free_at_safepoint(tc, victim);
+        else
+            free(entry);
+        return;
+    }
+}
+
 MVMObject * MVM_multi_cache_add(MVMThreadContext *tc, MVMObject *cache_obj, MVMObject *capture, MVMObject *result) {
-    MVMMultiCacheBody *cache;
-    MVMCallsite       *cs;
-    MVMArgProcContext *apc;
-    MVMuint16          num_args, i, entries, ins_type;
-    MVMuint8           has_nameds;
-    MVMuint64          arg_tup[MVM_MULTICACHE_MAX_ARITY];
+    MVMMultiCacheBody  *cache;
+    MVMMultiCacheEntry *entry;
+    MVMCallsite        *cs;
+    MVMArgProcContext  *apc;
+    MVMuint16           num_args;
+    MVMuint8            has_nameds;
+    MVMuint64           key_buf[KEY_BUFFER_SIZE];
+    MVMuint64          *arg_tup;
 
     /* Allocate a cache if needed. */
     if (!cache_obj || !IS_CONCRETE(cache_obj) || REPR(cache_obj)->ID != MVM_REPR_ID_MVMMultiCache) {
@@ -135,58 +339,26 @@ MVMObject * MVM_multi_cache_add(MVMThreadContext *tc, MVMObject *cache_obj, MVMO
         return cache_obj;
     }
 
-    /* If there's more args than the maximum, we can't cache it. */
-    if (num_args > MVM_MULTICACHE_MAX_ARITY)
-        return cache_obj;
-
-    /* If the cache is saturated, don't do anything (we could instead do a random
-     * replacement). */
-    entries = cache->arity_caches[num_args - 1].num_entries;
-    if (entries == MVM_MULTICACHE_MAX_ENTRIES)
-        return cache_obj;
-
     /* Create arg tuple. */
-    for (i = 0; i < num_args; i++) {
-        MVMuint8 arg_type = cs->arg_flags[i] & MVM_CALLSITE_ARG_MASK;
-        if (arg_type == MVM_CALLSITE_ARG_OBJ) {
-            MVMObject *arg = MVM_args_get_pos_obj(tc, apc, i, 1).arg.o;
-            if (arg) {
-                MVMContainerSpec const *contspec = STABLE(arg)->container_spec;
-                if (contspec) {
-                    if (contspec->fetch_never_invokes) {
-                        MVMRegister r;
-                        contspec->fetch(tc, arg, &r);
-                        arg = r.o;
-                    }
-                    else {
-                        return cache_obj;
-                    }
-                }
-                arg_tup[i] = STABLE(arg)->type_cache_id | (IS_CONCRETE(arg) ? 1 : 0);
-            }
-            else {
-                return cache_obj;
-            }
-        }
-        else {
-            arg_tup[i] = (arg_type << 1) | 1;
-        }
-    }
-
-    /* If there's no entries yet, need to do some allocation. */
-    if (entries == 0) {
-        cache->arity_caches[num_args - 1].type_ids = malloc(num_args * sizeof(MVMuint64) * MVM_MULTICACHE_MAX_ENTRIES);
-        cache->arity_caches[num_args - 1].named_ok = malloc(sizeof(MVMuint8) * MVM_MULTICACHE_MAX_ENTRIES);
-        cache->arity_caches[num_args - 1].results  = malloc(sizeof(MVMObject *) * MVM_MULTICACHE_MAX_ENTRIES);
+    arg_tup = num_args > KEY_BUFFER_SIZE ? malloc(num_args * sizeof(MVMuint64)) : key_buf;
+    if (!make_key(tc, cs, apc, num_args, arg_tup)) {
+        if (arg_tup != key_buf)
+            free(arg_tup);
+        return cache_obj;
     }
 
-    /* Add entry. */
-    ins_type = entries * num_args;
-    for (i = 0; i < num_args; i++)
-        cache->arity_caches[num_args - 1].type_ids[ins_type + i] = arg_tup[i];
-    MVM_ASSIGN_REF(tc, &(cache_obj->header), cache->arity_caches[num_args - 1].results[entries], result);
-    cache->arity_caches[num_args - 1].named_ok[entries] = has_nameds;
-    cache->arity_caches[num_args - 1].num_entries = entries + 1;
+    /* Build the entry and add it. */
+    entry            = malloc(entry_size(num_args));
+    entry->hash      = hash_key(arg_tup, num_args, has_nameds);
+    entry->result    = result;
+    entry->last_used = cache->clock;
+    entry->num_args  = num_args;
+    entry->named_ok  = has_nameds;
+    memcpy(entry->arg_tup, arg_tup, num_args * sizeof(MVMuint64));
+    if (arg_tup != key_buf)
+        free(arg_tup);
+    MVM_gc_write_barrier(tc, &(cache_obj->header), (MVMCollectable *)result);
+    insert(tc, cache, entry);
 
     /* Hand back the created/updated cache. */
     return cache_obj;
@@ -194,12 +366,17 @@ MVMObject * MVM_multi_cache_add(MVMThreadContext *tc, MVMObject *cache_obj, MVMO
 
 /* Does a lookup in a multi-dispatch cache. */
 MVMObject * MVM_multi_cache_find(MVMThreadContext *tc, MVMObject *cache_obj, MVMObject *capture) {
-    MVMMultiCacheBody *cache;
-    MVMCallsite       *cs;
-    MVMArgProcContext *apc;
-    MVMuint16          num_args, i, j, entries, t_pos;
-    MVMuint8           has_nameds;
-    MVMuint64          arg_tup[MVM_MULTICACHE_MAX_ARITY];
+    MVMMultiCacheBody  *cache;
+    MVMMultiCacheTable *table;
+    MVMCallsite        *cs;
+    MVMArgProcContext  *apc;
+    MVMuint16           num_args, i;
+    MVMuint8            has_nameds;
+    MVMuint64           key_buf[KEY_BUFFER_SIZE];
+    MVMuint64          *arg_tup;
+    MVMuint64           hash;
+    AO_t               *slots;
+    MVMObject          *result = NULL;
 
     /* If no cache, no result. */
     if (!cache_obj || !IS_CONCRETE(cache_obj) || REPR(cache_obj)->ID != MVM_REPR_ID_MVMMultiCache)
@@ -221,59 +398,46 @@ MVMObject * MVM_multi_cache_find(MVMThreadContext *tc, MVMObject *cache_obj, MVM
     }
 
     /* If it's zero-arity, return result right off. */
-    if (num_args == 0 && !has_nameds)
+    if (num_args == 0 && !has_nameds) {
+        if (cache->zero_arity)
+            cache->hits++;
+        else
+            cache->misses++;
         return cache->zero_arity;
+    }
 
-    /* If there's more args than the maximum, won't be in the cache. */
-    if (num_args > MVM_MULTICACHE_MAX_ARITY)
+    /* If nothing was cached yet, there's no point making a key. */
+    table = (MVMMultiCacheTable *)MVM_load(&cache->table);
+    if (!table || num_args == 0) {
+        cache->misses++;
         return NULL;
-
-    /* Create arg tuple. */
-    for (i = 0; i < num_args; i++) {
-        MVMuint8 arg_type = cs->arg_flags[i] & MVM_CALLSITE_ARG_MASK;
-        if (arg_type == MVM_CALLSITE_ARG_OBJ) {
-            MVMObject *arg = MVM_args_get_pos_obj(tc, apc, i, 1).arg.o;
-            if (arg) {
-                MVMContainerSpec const *contspec = STABLE(arg)->container_spec;
-                if (contspec) {
-                    if (contspec->fetch_never_invokes) {
-                        MVMRegister r;
-                        contspec->fetch(tc, arg, &r);
-                        arg = r.o;
-                    }
-                    else {
-                        return NULL;
-                    }
-                }
-                arg_tup[i] = STABLE(arg)->type_cache_id | (IS_CONCRETE(arg) ? 1 : 0);
-            }
-            else {
-                return NULL;
-            }
-        }
-        else {
-            arg_tup[i] = (arg_type << 1) | 1;
-        }
     }
 
-    /* Look through entries. */
-    entries = cache->arity_caches[num_args - 1].num_entries;
-    t_pos = 0;
-    for (i = 0; i < entries; i++) {
-        MVMint64 match = 1;
-        for (j = 0; j < num_args; j++) {
-            if (cache->arity_caches[num_args - 1].type_ids[t_pos + j] != arg_tup[j]) {
-                match = 0;
-                break;
-            }
-        }
-        if (match) {
-            MVMuint8 match_nameds = cache->arity_caches[num_args - 1].named_ok[i];
-            if (has_nameds == match_nameds)
-                return cache->arity_caches[num_args - 1].results[i];
+    /* Create arg tuple. */
+    arg_tup = num_args > KEY_BUFFER_SIZE ? malloc(num_args * sizeof(MVMuint64)) : key_buf;
+    if (!make_key(tc, cs, apc, num_args, arg_tup))
+        goto done;
+    hash = hash_key(arg_tup, num_args, has_nameds);
+
+    /* Look through the bucket the key hashes to. The table may have been
+     * replaced while making the key, so load it again. */
+    table = (MVMMultiCacheTable *)MVM_load(&cache->table);
+    slots = &table->slots[(hash & (table->num_buckets - 1)) * MVM_MULTICACHE_BUCKET_SIZE];
+    for (i = 0; i < MVM_MULTICACHE_BUCKET_SIZE; i++) {
+        MVMMultiCacheEntry *entry = (MVMMultiCacheEntry *)MVM_load(&slots[i]);
+        if (IS_ENTRY(entry) && entry_matches(entry, hash, arg_tup, num_args, has_nameds)) {
+            entry->last_used = ++cache->clock;
+            result = entry->result;
+            break;
         }
-        t_pos += num_args;
     }
 
-    return NULL;
+  done:
+    if (arg_tup != key_buf)
+        free(arg_tup);
+    if (result)
+        cache->hits++;
+    else
+        cache->misses++;
+    return result;
 }
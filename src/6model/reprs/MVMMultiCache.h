@@ -1,27 +1,58 @@
-/* Maximum positional arity we cache up to. (Good to make it a power of 2.) */
-#define MVM_MULTICACHE_MAX_ARITY    4
+/* The multi-dispatch cache is a set-associative hash table. Each entry is
+ * keyed on the types of the positional arguments (their type cache IDs,
+ * along with whether they are concrete), or for native arguments, their
+ * kinds, and on whether named arguments were passed. There is no limit on
+ * the number of positionals. An entry hashes to a bucket of a few slots;
+ * when a bucket is full, the table is grown, until it reaches its maximum
+ * size, after which the least recently used entry in the bucket is evicted.
+ *
+ * Lookups take no locks. Entries are never changed once they are in the
+ * table (bar the last used stamp), so one being replaced, or a table being
+ * replaced by a bigger one, may be in use by another thread; such memory is
+ * freed at the next GC safe point. */
 
-/* Maximum entries we cache per arity. (Good to make it a power of 2.) */
-#define MVM_MULTICACHE_MAX_ENTRIES  16
+/* Number of slots in a bucket. */
+#define MVM_MULTICACHE_BUCKET_SIZE  4
 
-/* The cached info that we keep per arity. */
-struct MVMMultiArityCache {
-    /* The number of entries in the cache. */
-    MVMuint8 num_entries;
+/* Number of buckets a table starts out with, and the most it may grow to.
+ * (Both must be powers of 2.) */
+#define MVM_MULTICACHE_MIN_BUCKETS  4
+#define MVM_MULTICACHE_MAX_BUCKETS  256
+
+/* An entry in the cache. */
+struct MVMMultiCacheEntry {
+    /* Hash of the key. */
+    MVMuint64 hash;
+
+    /* The result we return from the cache. */
+    MVMObject *result;
+
+    /* Value of the cache's clock when the entry was last hit; used to pick
+     * the entry to evict. Updated without synchronization. */
+    MVMuint32 last_used;
+
+    /* The number of positional arguments. */
+    MVMuint16 num_args;
 
-    /* This is a bunch of type IDs. We allocate it arity * MAX_ENTRIES
-     * big and go through it in arity sized chunks. */
-    MVMint64 *type_ids;
-    
     /* Whether the entry is allowed to have named arguments. Doesn't say
      * anything about which ones, though. Something that is ambivalent
-     * about named arguments to the degree it doesn't care about them 
+     * about named arguments to the degree it doesn't care about them
      * even tie-breaking (like NQP) can just throw such entries into the
      * cache. Things that do care should not make such cache entries. */
-    MVMuint8 *named_ok;
+    MVMuint8 named_ok;
 
-    /* The results we return from the cache. */
-    MVMObject **results;
+    /* The key for each positional argument; allocated num_args long. */
+    MVMuint64 arg_tup[1];
+};
+
+/* A hash table of cache entries. */
+struct MVMMultiCacheTable {
+    /* Number of buckets in the table. */
+    MVMuint32 num_buckets;
+
+    /* The slots, MVM_MULTICACHE_BUCKET_SIZE per bucket, each holding an
+     * MVMMultiCacheEntry pointer or 0. Allocated along with the table. */
+    AO_t slots[1];
 };
 
 /* Body of a multi-dispatch cache. */
@@ -29,8 +60,17 @@ struct MVMMultiCacheBody {
     /* Zero-arity cached result. */
     MVMObject *zero_arity;
 
-    /* The per-arity cache. */
-    MVMMultiArityCache arity_caches[MVM_MULTICACHE_MAX_ARITY];
+    /* The current table (an MVMMultiCacheTable pointer), or 0 if nothing
+     * was cached yet. */
+    AO_t table;
+
+    /* Ticks on each lookup hit, to stamp entries with. */
+    MVMuint32 clock;
+
+    /* Number of lookups that found or did not find a result. These are
+     * not updated atomically, so are approximate under contention. */
+    MVMuint64 hits;
+    MVMuint64 misses;
 };
 
 struct MVMMultiCache {
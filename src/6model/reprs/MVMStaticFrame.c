@@ -130,6 +130,19 @@ static void gc_mark(MVMThreadContext *tc, MVMSTable *st, void *data, MVMGCWorkli
             if (type_map[i] == MVM_reg_str || type_map[i] == MVM_reg_obj)
                 MVM_gc_worklist_add(tc, worklist, &body->static_env[i].o);
     }
+
+    /* specialization sites */
+    MVM_spesh_gc_mark(tc, body, worklist);
+
+    /* argument binding plans */
+    MVM_args_plans_gc_mark(tc, body, worklist);
+
+    /* lexical lookup cache */
+    if (body->lexical_cache) {
+        MVMuint32 i, n = (MVMuint32)MVM_load(&body->lexical_cache_entries);
+        for (i = 0; i < n; i++)
+            MVM_gc_worklist_add(tc, worklist, &body->lexical_cache[i].target);
+    }
 }
 
 /* Called by the VM in order to free memory associated with this object. */
@@ -143,6 +156,13 @@ static void gc_free(MVMThreadContext *tc, MVMObject *obj) {
     MVM_checked_free_null(body->lexical_types);
     MVM_checked_free_null(body->lexical_names_list);
     MVM_HASH_DESTROY(hash_handle, MVMLexicalRegistry, body->lexical_names);
+    MVM_checked_free_null(body->lexical_cache);
+    MVM_args_plans_destroy(tc, body);
+    MVM_spesh_destroy(tc, body);
+    if (body->jit_code) {
+        MVM_jit_destroy(tc, body->jit_code);
+        body->jit_code = NULL;
+    }
 }
 
 /* Gets the storage specification for this representation. */
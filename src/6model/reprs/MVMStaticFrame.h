@@ -72,6 +72,32 @@ struct MVMStaticFrameBody {
 
     /* Does the frame have an exit handler we need to run? */
     MVMuint8 has_exit_handler;
+
+    /* Specialization state (see src/spesh/spesh.h) and the number of
+     * times the frame has been invoked so far. */
+    AO_t spesh_state;
+    MVMuint32 spesh_invocations;
+
+    /* Specialized copy of the bytecode, if any, and the sites in it that
+     * log types and get specialized. */
+    MVMuint8 *spesh_bytecode;
+    MVMSpeshSite *spesh_sites;
+    MVMuint32 num_spesh_sites;
+
+    /* Machine code compiled from the frame by the JIT, if any. */
+    MVMJitCode *jit_code;
+
+    /* Where name-based lexical lookups starting in this frame found what
+     * they looked for (allocated on first use), the number of entries in
+     * use, and which is the next to be replaced once all are. */
+    MVMLexicalCacheEntry *lexical_cache;
+    AO_t                  lexical_cache_entries;
+    AO_t                  lexical_cache_next;
+
+    /* Binding plans for calls to this frame (see src/core/args.h), and
+     * the number made. */
+    AO_t args_plans;
+    AO_t num_args_plans;
 };
 struct MVMStaticFrame {
     MVMObject common;
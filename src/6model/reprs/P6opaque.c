@@ -469,6 +469,94 @@ static MVMint64 hint_for(MVMThreadContext *tc, MVMSTable *st, MVMObject *class_k
     return slot >= 0 ? slot : MVM_NO_HINT;
 }
 
+/* Resolves an attribute to the byte offset of its storage within the body,
+ * for use by specialized bytecode. Returns -1 if the attribute cannot be
+ * accessed directly with the given kind (not a P6opaque, no such attribute,
+ * or a flattened attribute that needs boxing or some other REPR to access
+ * it), in which case the usual get_attribute/bind_attribute must be used. */
+MVMint64 MVM_p6opaque_attr_offset(MVMThreadContext *tc, MVMSTable *st,
+        MVMObject *class_handle, MVMString *name, MVMuint16 kind) {
+    MVMP6opaqueREPRData *repr_data = (MVMP6opaqueREPRData *)st->REPR_data;
+    MVMSTable *attr_st;
+    MVMint64 slot;
+
+    if (st->REPR != &this_repr || !repr_data)
+        return -1;
+    slot = try_get_slot(tc, repr_data, class_handle, name);
+    if (slot < 0)
+        return -1;
+
+    attr_st = repr_data->flattened_stables[slot];
+    switch (kind) {
+        case MVM_reg_obj:
+            if (attr_st)
+                return -1;
+            break;
+        case MVM_reg_int64:
+            if (!attr_st || attr_st->REPR->ID != MVM_REPR_ID_P6int)
+                return -1;
+            break;
+        case MVM_reg_num64:
+            if (!attr_st || attr_st->REPR->ID != MVM_REPR_ID_P6num)
+                return -1;
+            break;
+        case MVM_reg_str:
+            if (!attr_st || attr_st->REPR->ID != MVM_REPR_ID_P6str)
+                return -1;
+            break;
+        default:
+            return -1;
+    }
+    return repr_data->attribute_offsets[slot];
+}
+
+/* Reads an attribute at an offset obtained from MVM_p6opaque_attr_offset.
+ * Returns zero if an object attribute was never initialized, so that the
+ * caller can fall back to get_attribute to do any auto-vivification. */
+MVMint64 MVM_p6opaque_get_at_offset(MVMThreadContext *tc, MVMObject *root,
+        MVMint64 offset, MVMRegister *result_reg, MVMuint16 kind) {
+    void *data = real_data(OBJECT_BODY(root));
+    switch (kind) {
+        case MVM_reg_obj: {
+            MVMObject *result = get_obj_at_offset_direct(data, offset);
+            if (!result)
+                return 0;
+            result_reg->o = result == ass_null ? NULL : result;
+            break;
+        }
+        case MVM_reg_int64:
+            result_reg->i64 = get_int_at_offset(data, offset);
+            break;
+        case MVM_reg_num64:
+            result_reg->n64 = get_num_at_offset(data, offset);
+            break;
+        case MVM_reg_str:
+            result_reg->s = get_str_at_offset(data, offset);
+            break;
+    }
+    return 1;
+}
+
+/* Binds an attribute at an offset obtained from MVM_p6opaque_attr_offset. */
+void MVM_p6opaque_bind_at_offset(MVMThreadContext *tc, MVMObject *root,
+        MVMint64 offset, MVMRegister value_reg, MVMuint16 kind) {
+    void *data = real_data(OBJECT_BODY(root));
+    switch (kind) {
+        case MVM_reg_obj:
+            set_obj_at_offset(tc, root, data, offset, value_reg.o);
+            break;
+        case MVM_reg_int64:
+            set_int_at_offset(data, offset, value_reg.i64);
+            break;
+        case MVM_reg_num64:
+            set_num_at_offset(data, offset, value_reg.n64);
+            break;
+        case MVM_reg_str:
+            set_str_at_offset(tc, root, data, offset, value_reg.s);
+            break;
+    }
+}
+
 /* Used with boxing. Sets an integer value, for representations that can hold
  * one. */
 static void set_int(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMint64 value) {
@@ -1124,9 +1212,12 @@ void change_type(MVMThreadContext *tc, MVMObject *obj, MVMObject *new_type) {
         memset((char *)new + (STABLE(obj)->size - sizeof(MVMObject)),
             0, new_size - (STABLE(obj)->size - sizeof(MVMObject)));
 
-        /* Copy existing to new.
-         * XXX Need more care here, as may have to re-barrier pointers. */
+        /* Copy existing to new. Any nursery pointers among what we copy
+         * may only have had their slots in the old body remembered, so make
+         * sure the whole object is visited by the next nursery GC. */
         memcpy(new, old, STABLE(obj)->size - sizeof(MVMObject));
+        if (obj->header.flags & MVM_CF_SECOND_GEN)
+            MVM_gc_write_barrier_hit(tc, &(obj->header));
 
         /* Pointer switch, taking care of existing body issues. */
         if (body->replaced) {
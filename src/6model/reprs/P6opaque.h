@@ -99,3 +99,11 @@ struct MVMP6opaqueREPRData {
 
 /* Function for REPR setup. */
 const MVMREPROps * MVMP6opaque_initialize(MVMThreadContext *tc);
+
+/* Direct attribute access by offset, used by specialized bytecode. */
+MVMint64 MVM_p6opaque_attr_offset(MVMThreadContext *tc, MVMSTable *st,
+    MVMObject *class_handle, MVMString *name, MVMuint16 kind);
+MVMint64 MVM_p6opaque_get_at_offset(MVMThreadContext *tc, MVMObject *root,
+    MVMint64 offset, MVMRegister *result_reg, MVMuint16 kind);
+void MVM_p6opaque_bind_at_offset(MVMThreadContext *tc, MVMObject *root,
+    MVMint64 offset, MVMRegister value_reg, MVMuint16 kind);
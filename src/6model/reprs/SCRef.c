@@ -71,6 +71,9 @@ static void gc_mark(MVMThreadContext *tc, MVMSTable *st, void *data, MVMGCWorkli
         MVM_gc_worklist_add(tc, worklist, &sc->root_stables[i]);
 
     MVM_gc_worklist_add(tc, worklist, &sc->sc);
+
+    if (sc->sr)
+        MVM_serialization_gc_mark_reader(tc, sc->sr, worklist);
 }
 
 /* Called by the VM in order to free memory associated with this object. */
@@ -85,6 +88,10 @@ static void gc_free(MVMThreadContext *tc, MVMObject *obj) {
     HASH_DELETE(hash_handle, tc->instance->sc_weakhash, sc->body);
     uv_mutex_unlock(&tc->instance->mutex_sc_weakhash);
 
+    /* Free the reader kept for deserializing on demand, if any. */
+    if (sc->body->sr)
+        MVM_serialization_free_reader(tc, sc->body->sr);
+
     /* Free manually managed STable list memory and body. */
     MVM_checked_free_null(sc->body->root_stables);
     MVM_checked_free_null(sc->body);
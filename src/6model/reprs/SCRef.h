@@ -34,6 +34,11 @@ struct MVMSerializationContextBody {
      * mapping an object to its owner. */
     MVMObject *owned_objects;
 
+    /* If the SC was deserialized, the reader holding on to the serialized
+     * data, so that the objects and STables in it can be deserialized when
+     * they are first asked for. */
+    MVMSerializationReader *sr;
+
     /* Backlink to the (memory-managed) SC itself. If
      * this is null, it is unresolved. */
     MVMSerializationContext *sc;
@@ -117,12 +117,23 @@ MVMSerializationContext * MVM_sc_get_sc(MVMThreadContext *tc, MVMCompUnit *cu, M
     return sc;
 }
 
-/* Given an SC and an index, fetch the object stored there. */
+/* Checks if a thread other than this one is deserializing, in which case
+ * things it has stubbed may show up in SC root sets before they are fully
+ * deserialized. */
+static MVMint32 deserializing_elsewhere(MVMThreadContext *tc) {
+    MVMThreadContext *owner = (MVMThreadContext *)MVM_load(&tc->instance->deserialize_owner);
+    return owner && owner != tc;
+}
+
+/* Given an SC and an index, fetch the object stored there, deserializing it
+ * first if needed. */
 MVMObject * MVM_sc_get_object(MVMThreadContext *tc, MVMSerializationContext *sc, MVMint64 idx) {
     MVMObject **roots = sc->body->root_objects;
     MVMint64    count = sc->body->num_objects;
     if (idx >= 0 && idx < count)
-        return roots[idx];
+        return roots[idx] && !deserializing_elsewhere(tc)
+            ? roots[idx]
+            : MVM_serialization_demand_object(tc, sc, idx);
     else
         MVM_exception_throw_adhoc(tc,
             "No object at index %d", idx);
@@ -165,10 +176,17 @@ void MVM_sc_set_object(MVMThreadContext *tc, MVMSerializationContext *sc, MVMint
     }
 }
 
-/* Given an SC and an index, fetch the STable stored there. */
+/* Given an SC and an index, fetch the STable stored there, deserializing it
+ * first if needed. */
 MVMSTable * MVM_sc_get_stable(MVMThreadContext *tc, MVMSerializationContext *sc, MVMint64 idx) {
-    if (idx >= 0 && idx < sc->body->num_stables && sc->body->root_stables[idx])
-        return sc->body->root_stables[idx];
+    MVMSTable *st = NULL;
+    if (idx >= 0 && idx < sc->body->num_stables) {
+        st = sc->body->root_stables[idx];
+        if (!st || deserializing_elsewhere(tc))
+            st = MVM_serialization_demand_stable(tc, sc, idx);
+    }
+    if (st)
+        return st;
     else
         MVM_exception_throw_adhoc(tc,
             "No STable at index %d", idx);
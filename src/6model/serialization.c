@@ -102,63 +102,75 @@ static char * base64_encode(const void *buf, size_t size)
     return str;
 }
 
-/* Base64 decoding */
-static int POS(char c)
-{
-    /* XXX TODO: investigate whether enumerating all 256 cases of
-     * this in a switch/case can help the compiler turn it into a
-     * jump table instead of a bunch of comparisons (if it doesn't
-     * already, of course!)... */
-    if (c>='A' && c<='Z') return c - 'A';
-    if (c>='a' && c<='z') return c - 'a' + 26;
-    if (c>='0' && c<='9') return c - '0' + 52;
-    if (c == '+') return 62;
-    if (c == '/') return 63;
-    if (c == '=') return -1;
-    return -2;
-}
-static void * base64_decode(const char *s, size_t *data_len)
-{
-    const char *p;
-    unsigned char *q, *data;
-    /* XXX TODO: investigate whether putting these n[4] into 4
-     * separate locals helps the compiler optimize them better.. */
-    int n[4];
+/* Base64 decoding. Maps each character to the 6 bits it encodes; -1 is the
+ * padding character and -2 is anything that isn't valid. */
+static const signed char base64_values[256] = {
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 62, -2, -2, -2, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -2, -2, -2, -1, -2, -2,
+    -2,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -2, -2, -2, -2, -2,
+    -2, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -2, -2, -2, -2, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2
+};
+
+/* Decodes a base64-encoded string, reading it straight out of the storage
+ * of the flat strings it is made up of, so it is left as it is. Returns
+ * NULL if it isn't valid base64. */
+static char * base64_decode_string(MVMThreadContext *tc, MVMString *s, size_t *data_len) {
+    MVMStringIndex  len = NUM_GRAPHS(s);
+    MVMStringIndex  pos = 0;
+    MVMStrandIter   iter;
+    unsigned char  *data, *q;
+    int             n[4] = { 0, 0, 0, 0 };
 
-    size_t len = strlen(s);
     if (len % 4)
         return NULL;
-    data = (unsigned char*) malloc(len/4*3);
-    q = (unsigned char*) data;
-
-    for (p = s; *p; ) {
-        n[0] = POS(*p++);
-        n[1] = POS(*p++);
-        n[2] = POS(*p++);
-        n[3] = POS(*p++);
-
-        /* XXX TODO: investigate jump table possibility here too,
-         * or at least collapse some of the branches... */
-        if (n[0] == -2
-         || n[1] == -2
-         || n[2] == -2
-         || n[3] == -2
-         || n[0] == -1
-         || n[1] == -1
-         || (n[2] == -1 && n[3] != -1))
-            return NULL;
+    data = (unsigned char *)malloc(MAX(len / 4 * 3, 1));
+    q    = data;
+
+    MVM_string_strand_iter_init(tc, &iter, s, 0, len);
+    while (MVM_string_strand_iter_next(tc, &iter)) {
+        MVMString      *piece = iter.string;
+        MVMStringIndex  i;
+        for (i = iter.start; i < iter.start + iter.length; i++, pos++) {
+            int       j = pos % 4;
+            MVMuint32 c = IS_8BIT(piece)
+                ? piece->body.uint8s[i]
+                : (MVMuint32)piece->body.int32s[i];
+            n[j] = c < 256 ? base64_values[c] : -2;
+            if (j < 3)
+                continue;
+
+            /* Padding may only end the last group of four. */
+            if (n[0] < 0 || n[1] < 0 || n[2] == -2 || n[3] == -2
+                    || (n[2] == -1 && n[3] != -1)
+                    || (n[3] == -1 && pos + 1 < len)) {
+                free(data);
+                return NULL;
+            }
 
-        q[0] = (n[0] << 2) + (n[1] >> 4);
-        if (n[2] != -1)
-            q[1] = ((n[1] & 15) << 4) + (n[2] >> 2);
-        if (n[3] != -1)
-            q[2] = ((n[2] & 3) << 6) + n[3];
-        q += 3;
+            q[0] = (n[0] << 2) + (n[1] >> 4);
+            if (n[2] != -1)
+                q[1] = ((n[1] & 15) << 4) + (n[2] >> 2);
+            if (n[3] != -1)
+                q[2] = ((n[2] & 3) << 6) + n[3];
+            q += 3;
+        }
     }
 
-    *data_len = q-data - (n[2]==-1) - (n[3]==-1);
+    *data_len = q - data - (n[2] == -1) - (n[3] == -1);
 
-    return data;
+    return (char *)data;
 }
 
 
@@ -1168,40 +1180,40 @@ MVMString * MVM_serialization_serialize(MVMThreadContext *tc, MVMSerializationCo
 /* Reads an int64 from a buffer. */
 static MVMint64 read_int64(char *buffer, size_t offset) {
     MVMint64 value;
+    memcpy(&value, buffer + offset, 8);
 #ifdef MVM_BIGENDIAN
-    switch_endian(buffer + offset, 8);
+    switch_endian((char *)&value, 8);
 #endif
-    memcpy(&value, buffer + offset, 8);
     return value;
 }
 
 /* Reads an int32 from a buffer. */
 static MVMint32 read_int32(char *buffer, size_t offset) {
     MVMint32 value;
+    memcpy(&value, buffer + offset, 4);
 #ifdef MVM_BIGENDIAN
-    switch_endian(buffer + offset, 4);
+    switch_endian((char *)&value, 4);
 #endif
-    memcpy(&value, buffer + offset, 4);
     return value;
 }
 
 /* Reads an int16 from a buffer. */
 static MVMint16 read_int16(char *buffer, size_t offset) {
     MVMint16 value;
+    memcpy(&value, buffer + offset, 2);
 #ifdef MVM_BIGENDIAN
-    switch_endian(buffer + offset, 2);
+    switch_endian((char *)&value, 2);
 #endif
-    memcpy(&value, buffer + offset, 2);
     return value;
 }
 
 /* Reads double from a buffer. */
 static MVMnum64 read_double(char *buffer, size_t offset) {
     MVMnum64 value;
+    memcpy(&value, buffer + offset, 8);
 #ifdef MVM_BIGENDIAN
-    switch_endian(buffer + offset, 8);
+    switch_endian((char *)&value, 8);
 #endif
-    memcpy(&value, buffer + offset, 8);
     return value;
 }
 
@@ -1238,6 +1250,74 @@ static size_t read_varint9(MVMuint8 *buffer, size_t offset, int64_t *value) {
     return inner_offset;
 }
 
+/* Takes the deserialization lock, unless the current thread already holds
+ * it. While it is held, we allocate directly in generation 2. This is
+ * because the objects are almost certainly going to be long lived, but also
+ * because if we know that we won't end up moving the objects we are working
+ * on during deserialization, it's a bunch easier to have those partially
+ * constructed objects floating around. Another thread may be deserializing
+ * for a while, so we mark ourselves blocked for GC while waiting; callers
+ * must root any objects they hold across taking the lock. */
+static void deserialize_lock(MVMThreadContext *tc) {
+    MVMInstance *instance = tc->instance;
+    if ((MVMThreadContext *)MVM_load(&instance->deserialize_owner) != tc) {
+        MVM_gc_mark_thread_blocked(tc);
+        uv_mutex_lock(&instance->mutex_deserialize);
+        MVM_gc_mark_thread_unblocked(tc);
+        MVM_store(&instance->deserialize_owner, tc);
+        instance->deserialize_allocate_in = tc->allocate_in;
+        tc->allocate_in = MVMAllocate_Gen2;
+    }
+    instance->deserialize_depth++;
+}
+
+/* Releases the deserialization lock, if this was the outermost taking of it. */
+static void deserialize_unlock(MVMThreadContext *tc) {
+    MVMInstance *instance = tc->instance;
+    if (--instance->deserialize_depth == 0) {
+        tc->allocate_in = instance->deserialize_allocate_in;
+        MVM_store(&instance->deserialize_owner, NULL);
+        uv_mutex_unlock(&instance->mutex_deserialize);
+    }
+}
+
+/* Gives up on all deserialization in progress and releases the lock. Work
+ * may have been in progress for several SCs, so we clear the lists of all
+ * of those, and take anything stubbed by that work back out of their root
+ * sets, so it is deserialized afresh if asked for again rather than being
+ * handed out half done. */
+static void deserialize_abandon(MVMThreadContext *tc) {
+    MVMInstance *instance = tc->instance;
+    MVMSerializationContextBody *scb, *tmp;
+    uv_mutex_lock(&instance->mutex_sc_weakhash);
+    HASH_ITER(hash_handle, instance->sc_weakhash, scb, tmp) {
+        MVMSerializationReader *sr = scb->sr;
+        if (sr) {
+            MVMuint32 i;
+            for (i = 0; i < sr->stubbed_stables.num_indexes; i++)
+                scb->root_stables[sr->stubbed_stables.indexes[i]] = NULL;
+            for (i = 0; i < sr->stubbed_objects.num_indexes; i++)
+                scb->root_objects[sr->stubbed_objects.indexes[i]] = NULL;
+            sr->working                     = 0;
+            sr->wl_stables.num_indexes      = 0;
+            sr->wl_objects.num_indexes      = 0;
+            sr->stubbed_stables.num_indexes = 0;
+            sr->stubbed_objects.num_indexes = 0;
+        }
+    }
+    uv_mutex_unlock(&instance->mutex_sc_weakhash);
+    instance->deserialize_depth = 1;
+    deserialize_unlock(tc);
+}
+
+/* Called as an exception is thrown, so that if it is thrown from somewhere
+ * in deserialization, the lock is not left held by a thread that will never
+ * get back to releasing it. */
+void MVM_serialization_abandon_if_owner(MVMThreadContext *tc) {
+    if ((MVMThreadContext *)MVM_load(&tc->instance->deserialize_owner) == tc)
+        deserialize_abandon(tc);
+}
+
 /* If deserialization should fail, cleans up before throwing an exception. */
 MVM_NO_RETURN
 static void fail_deserialize(MVMThreadContext *tc, MVMSerializationReader *reader,
@@ -1246,12 +1326,13 @@ MVM_NO_RETURN
 static void fail_deserialize(MVMThreadContext *tc, MVMSerializationReader *reader,
         const char *messageFormat, ...) {
     va_list args;
-    if (!(*tc->interp_cu)->body.serialized && reader->data)
-        free(reader->data);
-    if (reader->contexts)
+    if (reader->contexts) {
         free(reader->contexts);
-    free(reader);
-    MVM_gc_allocate_gen2_default_clear(tc);
+        reader->contexts = NULL;
+    }
+    if (reader->root.sc->body->sr != reader)
+        MVM_serialization_free_reader(tc, reader);
+    deserialize_abandon(tc);
     va_start(args, messageFormat);
     MVM_exception_throw_adhoc_va(tc, messageFormat, args);
     va_end(args);
@@ -1575,10 +1656,8 @@ static void check_and_dissect_input(MVMThreadContext *tc,
     char   *prov_pos;
     char   *data_end;
     if (data_str) {
-        /* Grab data from string. */
-        char *data_b64 = (char *)MVM_string_ascii_encode(tc, data_str, NULL);
-        data = (char *)base64_decode(data_b64, &data_len);
-        free(data_b64);
+        /* Decode data from string. */
+        data = base64_decode_string(tc, data_str, &data_len);
     }
     else {
         /* Try to get it from the current compilation unit. */
@@ -1587,6 +1666,7 @@ static void check_and_dissect_input(MVMThreadContext *tc,
         fail_deserialize(tc, reader,
             "Failed to find deserialization data in compilation unit");
         data_len = (*tc->interp_cu)->body.serialized_size;
+        reader->data_cu = *tc->interp_cu;
     }
     prov_pos = data;
     data_end = data + data_len;
@@ -1742,87 +1822,100 @@ static void resolve_dependencies(MVMThreadContext *tc, MVMSerializationReader *r
     }
 }
 
-/* Allocates STables that we need to deserialize, associating each one
- * with its REPR. */
-static void stub_stables(MVMThreadContext *tc, MVMSerializationReader *reader) {
-    MVMuint32  num_sts  = reader->root.num_stables;
-    MVMuint32  i;
-    for (i = 0; i < num_sts; i++) {
-        /* Calculate location of STable's table row. */
-        char *st_table_row = reader->root.stables_table + i * STABLES_TABLE_ENTRY_SIZE;
-
-        /* Check we don't already have the STable (due to repossession). */
-        MVMSTable *st = MVM_sc_try_get_stable(tc, reader->root.sc, i);
-        if (!st) {
-            /* Read in and look up representation. */
-            const MVMREPROps *repr = MVM_repr_get_by_name(tc,
-                read_string_from_heap(tc, reader, read_int32(st_table_row, 0)));
-
-            /* Allocate and store stub STable. */
-            st = MVM_gc_allocate_stable(tc, repr, NULL);
-            MVM_sc_set_stable(tc, reader->root.sc, i, st);
-        }
-
-        /* Set the STable's SC. */
-        MVM_sc_set_stable_sc(tc, st, reader->root.sc);
+/* Adds an index to a deserialization worklist. */
+static void worklist_add_index(MVMThreadContext *tc, MVMDeserializeWorklist *wl, MVMuint32 index) {
+    if (wl->num_indexes == wl->alloc_indexes) {
+        wl->alloc_indexes = wl->alloc_indexes ? wl->alloc_indexes * 2 : 32;
+        wl->indexes = realloc(wl->indexes, wl->alloc_indexes * sizeof(MVMuint32));
     }
+    wl->indexes[wl->num_indexes++] = index;
 }
 
-/* Goes through all STables and gets them to calculate their sizes, setting
- * the STable size field. */
-static void set_stable_sizes(MVMThreadContext *tc, MVMSerializationReader *reader) {
-    MVMuint32  num_sts  = reader->root.num_stables;
-    MVMuint32  i;
-    for (i = 0; i < num_sts; i++) {
-        /* Grab STable. */
-        MVMSTable *st = MVM_sc_get_stable(tc, reader->root.sc, i);
+/* Takes an index from a deserialization worklist. */
+static MVMuint32 worklist_take_index(MVMThreadContext *tc, MVMDeserializeWorklist *wl) {
+    return wl->indexes[--wl->num_indexes];
+}
 
-        /* Set STable read position, and set current read buffer to the
-         * location of the REPR data. */
-        char *st_table_row = reader->root.stables_table + i * STABLES_TABLE_ENTRY_SIZE;
-        reader->stables_data_offset = read_int32(st_table_row, 8);
+/* Stubs an STable, allocating it and associating it with its REPR unless it's
+ * already there (due to repossession), then has the REPR calculate its size
+ * and queues it to be deserialized. Objects of the type can be allocated as
+ * soon as this is done. */
+static void stub_stable(MVMThreadContext *tc, MVMSerializationReader *reader, MVMuint32 i) {
+    /* Calculate location of STable's table row. */
+    char *st_table_row = reader->root.stables_table + i * STABLES_TABLE_ENTRY_SIZE;
 
-        reader->cur_read_buffer     = &(reader->root.stables_data);
-        reader->cur_read_offset     = &(reader->stables_data_offset);
-        reader->cur_read_end        = &(reader->stables_data_end);
+    /* We may be part way through reading something else, so save the read
+     * position to restore afterwards. */
+    char     **orig_read_buffer = reader->cur_read_buffer;
+    MVMint32  *orig_read_offset = reader->cur_read_offset;
+    char     **orig_read_end    = reader->cur_read_end;
+    MVMint32   orig_st_offset   = reader->stables_data_offset;
 
-        if (st->REPR->deserialize_stable_size)
-            st->REPR->deserialize_stable_size(tc, st, reader);
-        else
-            fail_deserialize(tc, reader, "Missing deserialize_stable_size");
-        if (st->size == 0)
-            fail_deserialize(tc, reader, "STable with size zero after deserialization");
+    /* Check we don't already have the STable (due to repossession). */
+    MVMSTable *st = reader->root.sc->body->root_stables[i];
+    if (!st) {
+        /* Read in and look up representation. */
+        const MVMREPROps *repr = MVM_repr_get_by_name(tc,
+            read_string_from_heap(tc, reader, read_int32(st_table_row, 0)));
+
+        /* Allocate and store stub STable. */
+        st = MVM_gc_allocate_stable(tc, repr, NULL);
+        MVM_sc_set_stable(tc, reader->root.sc, i, st);
     }
-}
 
-/* Stubs all the objects we need to deserialize, setting their REPR and type
- * object flag. */
-static void stub_objects(MVMThreadContext *tc, MVMSerializationReader *reader) {
-    MVMuint32  num_objs = reader->root.num_objects;
-    MVMuint32  i;
-    for (i = 0; i < num_objs; i++) {
-        /* Calculate location of object's table row. */
-        char *obj_table_row = reader->root.objects_table + i * OBJECTS_TABLE_ENTRY_SIZE;
+    /* Set the STable's SC. */
+    MVM_sc_set_stable_sc(tc, st, reader->root.sc);
+
+    /* Set STable read position, and set current read buffer to the
+     * location of the REPR data. */
+    reader->stables_data_offset = read_int32(st_table_row, 8);
+    reader->cur_read_buffer     = &(reader->root.stables_data);
+    reader->cur_read_offset     = &(reader->stables_data_offset);
+    reader->cur_read_end        = &(reader->stables_data_end);
 
+    if (st->REPR->deserialize_stable_size)
+        st->REPR->deserialize_stable_size(tc, st, reader);
+    else
+        fail_deserialize(tc, reader, "Missing deserialize_stable_size");
+    if (st->size == 0)
+        fail_deserialize(tc, reader, "STable with size zero after deserialization");
+
+    /* Restore the read position. */
+    reader->cur_read_buffer     = orig_read_buffer;
+    reader->cur_read_offset     = orig_read_offset;
+    reader->cur_read_end        = orig_read_end;
+    reader->stables_data_offset = orig_st_offset;
+
+    worklist_add_index(tc, &(reader->wl_stables), i);
+    worklist_add_index(tc, &(reader->stubbed_stables), i);
+}
+
+/* Stubs an object, setting its REPR and type object flag, unless it's
+ * already there (due to repossession), and queues it to be deserialized. */
+static void stub_object(MVMThreadContext *tc, MVMSerializationReader *reader, MVMuint32 i) {
+    /* Calculate location of object's table row. */
+    char *obj_table_row = reader->root.objects_table + i * OBJECTS_TABLE_ENTRY_SIZE;
+
+    /* Allocate and store stub object, unless it's already there due to a
+     * repossession. */
+    MVMObject *obj = reader->root.sc->body->root_objects[i];
+    if (!obj) {
         /* Resolve the STable. */
         MVMSTable *st = lookup_stable(tc, reader,
             read_int32(obj_table_row, 0),   /* The SC in the dependencies table, + 1 */
             read_int32(obj_table_row, 4));  /* The index in that SC */
+        if ((read_int32(obj_table_row, 12) & 1))
+            obj = st->REPR->allocate(tc, st);
+        else
+            obj = MVM_gc_allocate_type_object(tc, st);
+        MVM_sc_set_object(tc, reader->root.sc, i, obj);
+    }
 
-        /* Allocate and store stub object, unless it's already there due to a
-         * repossession. */
-        MVMObject *obj = MVM_sc_try_get_object(tc, reader->root.sc, i);
-        if (!obj) {
-            if ((read_int32(obj_table_row, 12) & 1))
-                obj = st->REPR->allocate(tc, st);
-            else
-                obj = MVM_gc_allocate_type_object(tc, st);
-            MVM_sc_set_object(tc, reader->root.sc, i, obj);
-        }
+    /* Set the object's SC. */
+    MVM_sc_set_obj_sc(tc, obj, reader->root.sc);
 
-        /* Set the object's SC. */
-        MVM_sc_set_obj_sc(tc, obj, reader->root.sc);
-    }
+    worklist_add_index(tc, &(reader->wl_objects), i);
+    worklist_add_index(tc, &(reader->stubbed_objects), i);
 }
 
 /* Deserializes a closure, though without attaching outer (that comes in a
@@ -1907,7 +2000,8 @@ static void attach_closure_outer(MVMThreadContext *tc, MVMSerializationReader *r
     char      *row = reader->root.closures_table + i * CLOSURES_TABLE_ENTRY_SIZE;
     MVMuint32  idx = read_int32(row, 8);
     if (idx)
-        ((MVMCode *)closure)->body.outer = MVM_frame_inc_ref(tc, reader->contexts[idx - 1]);
+        ((MVMCode *)closure)->body.outer = MVM_frame_inc_ref(tc,
+            MVM_frame_share(tc, reader->contexts[idx - 1]));
 }
 
 /* Attaches a context's outer pointer. */
@@ -1915,7 +2009,8 @@ static void attach_context_outer(MVMThreadContext *tc, MVMSerializationReader *r
     char      *row = reader->root.contexts_table + i * CONTEXTS_TABLE_ENTRY_SIZE;
     MVMuint32  idx = read_int32(row, 12);
     if (idx)
-        context->outer = MVM_frame_inc_ref(tc, reader->contexts[idx - 1]);
+        context->outer = MVM_frame_inc_ref(tc,
+            MVM_frame_share(tc, reader->contexts[idx - 1]));
 }
 
 /* Deserializes a single STable, along with its REPR data. */
@@ -1953,6 +2048,10 @@ static void deserialize_stable(MVMThreadContext *tc, MVMSerializationReader *rea
     /* Mode flags. */
     st->mode_flags = read_int_func(tc, reader);
 
+    /* The STable may be getting replaced (repossession), so invalidate
+     * anything cached against its previous state. */
+    st->cache_version++;
+
     /* Boolification spec. */
     if (read_int_func(tc, reader)) {
         st->boolification_spec = (MVMBoolificationSpec *)malloc(sizeof(MVMBoolificationSpec));
@@ -2070,16 +2169,73 @@ static void repossess(MVMThreadContext *tc, MVMSerializationReader *reader, MVMi
     }
 }
 
+/* Works through the STables and objects that have been stubbed, fully
+ * deserializing them. Doing so may stub more of them, which then also get
+ * deserialized. STables go first, since objects need their REPR data. Once
+ * done, everything stubbed so far is complete. */
+static void work_loop(MVMThreadContext *tc, MVMSerializationReader *reader) {
+    MVMSerializationContextBody *scb = reader->root.sc->body;
+    while (reader->wl_stables.num_indexes || reader->wl_objects.num_indexes) {
+        while (reader->wl_stables.num_indexes) {
+            MVMuint32 i = worklist_take_index(tc, &(reader->wl_stables));
+            deserialize_stable(tc, reader, i, scb->root_stables[i]);
+        }
+        while (reader->wl_objects.num_indexes && !reader->wl_stables.num_indexes) {
+            MVMuint32 i = worklist_take_index(tc, &(reader->wl_objects));
+            deserialize_object(tc, reader, i, scb->root_objects[i]);
+        }
+    }
+    reader->stubbed_stables.num_indexes = 0;
+    reader->stubbed_objects.num_indexes = 0;
+}
+
+/* Makes sure the SC's root sets have a slot for everything in the serialized
+ * data; those left empty are deserialized when first asked for. */
+static void reserve_roots(MVMThreadContext *tc, MVMSerializationReader *reader) {
+    MVMSerializationContextBody *scb = reader->root.sc->body;
+    MVMuint64 num_objects = reader->root.num_objects;
+    MVMuint64 num_stables = reader->root.num_stables;
+    if (scb->alloc_objects < num_objects) {
+        scb->root_objects = realloc(scb->root_objects, num_objects * sizeof(MVMObject *));
+        memset(scb->root_objects + scb->alloc_objects, 0,
+            (num_objects - scb->alloc_objects) * sizeof(MVMObject *));
+        scb->alloc_objects = num_objects;
+    }
+    if (scb->num_objects < num_objects)
+        scb->num_objects = num_objects;
+    if (scb->alloc_stables < num_stables) {
+        scb->root_stables = realloc(scb->root_stables, num_stables * sizeof(MVMSTable *));
+        memset(scb->root_stables + scb->alloc_stables, 0,
+            (num_stables - scb->alloc_stables) * sizeof(MVMSTable *));
+        scb->alloc_stables = num_stables;
+    }
+    if (scb->num_stables < num_stables)
+        scb->num_stables = num_stables;
+}
+
 /* Takes serialized data, an empty SerializationContext to deserialize it into,
  * a strings heap and the set of static code refs for the compilation unit.
- * Deserializes the data into the required objects and STables. */
+ * Sets things up so that the objects and STables in it are deserialized as
+ * they are first asked for. Repossessions, closures and contexts are done
+ * right away, along with anything they reference. */
 void MVM_serialization_deserialize(MVMThreadContext *tc, MVMSerializationContext *sc,
         MVMObject *string_heap, MVMObject *codes_static,
         MVMObject *repo_conflicts, MVMString *data) {
+    MVMSerializationReader *reader;
     MVMint32 scodes, i;
 
+    /* Take the lock before anything else refers to the objects we were
+     * given, as GC may move them while we wait for it. */
+    MVM_gc_root_temp_push(tc, (MVMCollectable **)&sc);
+    MVM_gc_root_temp_push(tc, (MVMCollectable **)&string_heap);
+    MVM_gc_root_temp_push(tc, (MVMCollectable **)&codes_static);
+    MVM_gc_root_temp_push(tc, (MVMCollectable **)&repo_conflicts);
+    MVM_gc_root_temp_push(tc, (MVMCollectable **)&data);
+    deserialize_lock(tc);
+    MVM_gc_root_temp_pop_n(tc, 5);
+
     /* Allocate and set up reader. */
-    MVMSerializationReader *reader = calloc(1, sizeof(MVMSerializationReader));
+    reader = calloc(1, sizeof(MVMSerializationReader));
     reader->root.sc          = sc;
     reader->root.string_heap = string_heap;
 
@@ -2110,34 +2266,35 @@ void MVM_serialization_deserialize(MVMThreadContext *tc, MVMSerializationContext
         MVM_sc_set_obj_sc(tc, scr, sc);
     }
 
-    /* During deserialization, we allocate directly in generation 2. This
-     * is because these objects are almost certainly going to be long lived,
-     * but also because if we know that we won't end up moving the objects
-     * we are working on during a deserialization run, it's a bunch easier
-     * to have those partially constructed objects floating around. */
-    MVM_gc_allocate_gen2_default_set(tc);
-
     /* Read header and dissect the data into its parts. */
     check_and_dissect_input(tc, reader, data);
 
     /* Resolve the SCs in the dependencies table. */
     resolve_dependencies(tc, reader);
 
+    /* The SC holds on to the reader from here on, so it can deserialize
+     * things on demand; that has to wait until we're done here, though. */
+    reserve_roots(tc, reader);
+    sc->body->sr = reader;
+    reader->working = 1;
+    MVM_gc_write_barrier(tc, &(sc->common.header), (MVMCollectable *)string_heap);
+    MVM_gc_write_barrier(tc, &(sc->common.header), (MVMCollectable *)reader->data_cu);
+
     /* If we're repossessing objects and STables from other SCs, then first
-      * get those raw objects into our root set. */
-     for (i = 0; i < reader->root.num_repos; i++)
+      * get those raw objects into our root set, then stub them so they will
+      * be deserialized over. */
+    for (i = 0; i < reader->root.num_repos; i++)
         repossess(tc, reader, i);
-
-    /* Stub allocate all STables, and then have the appropriate REPRs do
-     * the required size calculations. */
-    stub_stables(tc, reader);
-    set_stable_sizes(tc, reader);
-
-    /* Stub allocate all objects. */
-    stub_objects(tc, reader);
+    for (i = 0; i < reader->root.num_repos; i++) {
+        char *table_row = reader->root.repos_table + i * REPOS_TABLE_ENTRY_SIZE;
+        if (read_int32(table_row, 0) == 0)
+            stub_object(tc, reader, read_int32(table_row, 4));
+        else
+            stub_stable(tc, reader, read_int32(table_row, 4));
+    }
 
     /* Deserialize closures, deserialize contexts, then attach outers. */
-    reader->contexts = malloc(reader->root.num_contexts * sizeof(MVMFrame *));
+    reader->contexts = malloc(MAX(reader->root.num_contexts, 1) * sizeof(MVMFrame *));
     for (i = 0; i < reader->root.num_closures; i++)
         deserialize_closure(tc, reader, i);
     for (i = 0; i < reader->root.num_contexts; i++)
@@ -2148,27 +2305,98 @@ void MVM_serialization_deserialize(MVMThreadContext *tc, MVMSerializationContext
     for (i = 0; i < reader->root.num_contexts; i++)
         attach_context_outer(tc, reader, i, reader->contexts[i]);
 
-    /* Fully deserialize STables, along with their representation data. */
-    for (i = 0; i < reader->root.num_stables; i++)
-        deserialize_stable(tc, reader, i, MVM_sc_get_stable(tc, sc, i));
-
-    /* Finish deserializing objects. */
-    for (i = 0; i < reader->root.num_objects; i++)
-        deserialize_object(tc, reader, i, MVM_sc_get_object(tc, sc, i));
-
-    /* Clear up afterwards. */
-    if ((*tc->interp_cu)->body.serialized) {
-        (*tc->interp_cu)->body.serialized = NULL;
-        (*tc->interp_cu)->body.serialized_size = 0;
-    }
-    else if (reader->data)
-        free(reader->data);
-    if (reader->contexts)
-        free(reader->contexts);
-    free(reader);
-
-    /* Restore normal GC allocation. */
-    MVM_gc_allocate_gen2_default_clear(tc);
+    /* Deserialize everything that got stubbed along the way. */
+    work_loop(tc, reader);
+    reader->working = 0;
+
+    /* Clear up things only needed while loading. */
+    if (reader->data_cu) {
+        reader->data_cu->body.serialized = NULL;
+        reader->data_cu->body.serialized_size = 0;
+    }
+    free(reader->contexts);
+    reader->contexts            = NULL;
+    reader->repo_conflicts_list = NULL;
+
+    deserialize_unlock(tc);
+}
+
+/* Deserializes the object at the specified index in an SC, if that didn't
+ * already happen, and returns it. Anything else that needs deserializing to
+ * complete it is done before we return, unless we're here while already
+ * deserializing from the same SC, in which case it is left to that. */
+MVMObject * MVM_serialization_demand_object(MVMThreadContext *tc, MVMSerializationContext *sc, MVMint64 idx) {
+    MVMSerializationReader *sr;
+    MVMObject *obj;
+
+    /* Obtain lock and check we didn't lose a race to deserialize it. */
+    MVMROOT(tc, sc, {
+        deserialize_lock(tc);
+    });
+    sr  = sc->body->sr;
+    obj = sc->body->root_objects[idx];
+    if (!obj && sr && idx < sr->root.num_objects) {
+        sr->root.sc = sc;
+        sr->working++;
+        stub_object(tc, sr, idx);
+        if (sr->working == 1)
+            work_loop(tc, sr);
+        sr->working--;
+        obj = sc->body->root_objects[idx];
+    }
+    deserialize_unlock(tc);
+
+    return obj;
+}
+
+/* Deserializes the STable at the specified index in an SC, if that didn't
+ * already happen, and returns it; see MVM_serialization_demand_object. */
+MVMSTable * MVM_serialization_demand_stable(MVMThreadContext *tc, MVMSerializationContext *sc, MVMint64 idx) {
+    MVMSerializationReader *sr;
+    MVMSTable *st;
+
+    /* Obtain lock and check we didn't lose a race to deserialize it. */
+    MVMROOT(tc, sc, {
+        deserialize_lock(tc);
+    });
+    sr = sc->body->sr;
+    st = sc->body->root_stables[idx];
+    if (!st && sr && idx < sr->root.num_stables) {
+        sr->root.sc = sc;
+        sr->working++;
+        stub_stable(tc, sr, idx);
+        if (sr->working == 1)
+            work_loop(tc, sr);
+        sr->working--;
+        st = sc->body->root_stables[idx];
+    }
+    deserialize_unlock(tc);
+
+    return st;
+}
+
+/* Marks the things a reader held on to by an SC refers to. */
+void MVM_serialization_gc_mark_reader(MVMThreadContext *tc, MVMSerializationReader *sr, MVMGCWorklist *worklist) {
+    MVMint32 i;
+    MVM_gc_worklist_add(tc, worklist, &sr->root.string_heap);
+    MVM_gc_worklist_add(tc, worklist, &sr->codes_list);
+    MVM_gc_worklist_add(tc, worklist, &sr->repo_conflicts_list);
+    MVM_gc_worklist_add(tc, worklist, &sr->data_cu);
+    for (i = 0; i < sr->root.num_dependencies; i++)
+        MVM_gc_worklist_add(tc, worklist, &sr->root.dependent_scs[i]);
+}
+
+/* Frees a reader, along with the data if it owns it. */
+void MVM_serialization_free_reader(MVMThreadContext *tc, MVMSerializationReader *sr) {
+    if (!sr->data_cu && sr->data)
+        free(sr->data);
+    MVM_checked_free_null(sr->root.dependent_scs);
+    MVM_checked_free_null(sr->contexts);
+    MVM_checked_free_null(sr->wl_stables.indexes);
+    MVM_checked_free_null(sr->wl_objects.indexes);
+    MVM_checked_free_null(sr->stubbed_stables.indexes);
+    MVM_checked_free_null(sr->stubbed_objects.indexes);
+    free(sr);
 }
 
 /*
@@ -48,6 +48,14 @@ struct MVMSerializationRoot {
     MVMObject *string_heap;
 };
 
+/* A list of indexes of STables or objects that have been stubbed, but are
+ * yet to be deserialized. */
+struct MVMDeserializeWorklist {
+    MVMuint32 *indexes;
+    MVMuint32  num_indexes;
+    MVMuint32  alloc_indexes;
+};
+
 /* Represents the serialization reader and the various functions available
  * on it. */
 struct MVMSerializationReader {
@@ -94,8 +102,24 @@ struct MVMSerializationReader {
     /* The current object we're deserializing. */
     MVMObject *current_object;
 
-    /* The data, which we'll want to free after deserialization. */
-    char *data;
+    /* STables and objects stubbed but not yet deserialized, and how many
+     * deserialization requests for this SC are in progress; the first one
+     * works through the lists, the rest just add to them. */
+    MVMDeserializeWorklist wl_stables;
+    MVMDeserializeWorklist wl_objects;
+    MVMuint32              working;
+
+    /* STables and objects stubbed since the work lists were last worked
+     * through to the end; if deserialization is abandoned, these are taken
+     * out of the SC's root sets again, since they may be incomplete. */
+    MVMDeserializeWorklist stubbed_stables;
+    MVMDeserializeWorklist stubbed_objects;
+
+    /* The data, which we hold on to for as long as the SC might want things
+     * deserialized from it. If it belongs to a compilation unit, that is
+     * kept alive; otherwise, we free it along with the reader. */
+    char        *data;
+    MVMCompUnit *data_cu;
 };
 
 /* Represents the serialization writer and the various functions available
@@ -156,6 +180,11 @@ struct MVMSerializationWriter {
 void MVM_serialization_deserialize(MVMThreadContext *tc, MVMSerializationContext *sc,
     MVMObject *string_heap, MVMObject *codes_static, MVMObject *repo_conflicts,
     MVMString *data);
+MVMObject * MVM_serialization_demand_object(MVMThreadContext *tc, MVMSerializationContext *sc, MVMint64 idx);
+MVMSTable * MVM_serialization_demand_stable(MVMThreadContext *tc, MVMSerializationContext *sc, MVMint64 idx);
+void MVM_serialization_gc_mark_reader(MVMThreadContext *tc, MVMSerializationReader *sr, MVMGCWorklist *worklist);
+void MVM_serialization_free_reader(MVMThreadContext *tc, MVMSerializationReader *sr);
+void MVM_serialization_abandon_if_owner(MVMThreadContext *tc);
 MVMString * MVM_sha1(MVMThreadContext *tc, MVMString *str);
 MVMString * MVM_serialization_serialize(MVMThreadContext *tc, MVMSerializationContext *sc,
     MVMObject *empty_string_heap);
@@ -5,18 +5,29 @@ static MVMCallsiteEntry one_arg_flags[] = { MVM_CALLSITE_ARG_OBJ };
 static MVMCallsite     one_arg_callsite = { one_arg_flags, 1, 1, 0 };
 
 static void init_named_used(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMuint16 num) {
-    if (ctx->named_used && ctx->named_used_size >= num) { /* reuse the old one */
-        memset(ctx->named_used, 0, ctx->named_used_size * sizeof(MVMuint8));
+    ctx->named_used_size = num;
+    if (num <= MVM_ARGS_NAMED_USED_BITS) {
+        ctx->named_used_bits = 0;
+    }
+    else if (ctx->named_used && ctx->named_used_alloc >= num) { /* reuse the old one */
+        memset(ctx->named_used, 0, num * sizeof(MVMuint8));
     }
     else {
-        if (ctx->named_used) {
+        if (ctx->named_used)
             free(ctx->named_used);
-            ctx->named_used = NULL;
-        }
-        ctx->named_used_size = num;
-        ctx->named_used = ctx->named_used_size ? calloc(sizeof(MVMuint8), ctx->named_used_size) : NULL;
+        ctx->named_used_alloc = num;
+        ctx->named_used = calloc(sizeof(MVMuint8), num);
     }
 }
+#define NAMED_USED(ctx, idx) ((ctx)->named_used_size <= MVM_ARGS_NAMED_USED_BITS \
+    ? (MVMuint8)(((ctx)->named_used_bits >> (idx)) & 1) \
+    : (ctx)->named_used[idx])
+#define MARK_NAMED_USED(ctx, idx) do { \
+    if ((ctx)->named_used_size <= MVM_ARGS_NAMED_USED_BITS) \
+        (ctx)->named_used_bits |= (MVMuint64)1 << (idx); \
+    else \
+        (ctx)->named_used[idx] = 1; \
+} while (0)
 
 /* Initialize arguments processing context. */
 void MVM_args_proc_init(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMCallsite *callsite, MVMRegister *args) {
@@ -28,6 +39,7 @@ void MVM_args_proc_init(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMCallsit
     ctx->num_pos  = callsite->num_pos;
     ctx->arg_count = callsite->arg_count;
     ctx->arg_flags = NULL; /* will be populated by flattener if needed */
+    ctx->plan = NULL; /* picked by the caller if it wants one */
 }
 
 /* Clean up an arguments processing context for cache. */
@@ -52,8 +64,9 @@ void MVM_args_proc_cleanup(MVMThreadContext *tc, MVMArgProcContext *ctx) {
     if (ctx->named_used) {
         free(ctx->named_used);
         ctx->named_used = NULL;
-        ctx->named_used_size = 0;
+        ctx->named_used_alloc = 0;
     }
+    ctx->named_used_size = 0;
 }
 
 /* Turn an argument processing context into a callsite. In the case that no
@@ -284,23 +297,121 @@ MVMArgInfo MVM_args_get_pos_str(MVMThreadContext *tc, MVMArgProcContext *ctx, MV
     return result;
 }
 
+/* Finds the named argument with the specified name, returning its index
+ * among the nameds, or -1 if it was not passed. */
+static MVMint32 find_named(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMString *name) {
+    MVMuint32 arg_pos;
+    for (arg_pos = ctx->num_pos; arg_pos < ctx->arg_count; arg_pos += 2)
+        if (MVM_string_equal(tc, ctx->args[arg_pos].s, name))
+            return (arg_pos - ctx->num_pos) / 2;
+    return -1;
+}
+
+/* Picks the binding plan of the static frame being invoked that matches the
+ * names passed in this call, making one if there is none yet and there is
+ * room for it. Only calls passing nameds, without flattening, use plans. */
+void MVM_args_pick_plan(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMStaticFrame *sf) {
+    MVMStaticFrameBody *body       = &sf->body;
+    MVMuint16           num_nameds = (ctx->arg_count - ctx->num_pos) / 2;
+    MVMArgsPlan        *plan;
+    MVMuint16           i;
+
+    for (plan = (MVMArgsPlan *)MVM_load(&body->args_plans); plan; plan = plan->next) {
+        if (plan->callsite != ctx->callsite || plan->num_nameds != num_nameds)
+            continue;
+        for (i = 0; i < num_nameds; i++)
+            if (plan->arg_names[i] != ctx->args[ctx->num_pos + 2 * i].s)
+                break;
+        if (i == num_nameds) {
+            ctx->plan = plan;
+            return;
+        }
+    }
+
+    if (MVM_load(&body->num_args_plans) >= MVM_ARGS_PLAN_MAX ||
+            MVM_incr(&body->num_args_plans) >= MVM_ARGS_PLAN_MAX)
+        return;
+    plan             = calloc(1, sizeof(MVMArgsPlan));
+    plan->sf         = sf;
+    plan->callsite   = ctx->callsite;
+    plan->num_nameds = num_nameds;
+    plan->arg_names  = malloc(num_nameds * sizeof(MVMString *));
+    for (i = 0; i < num_nameds; i++) {
+        plan->arg_names[i] = ctx->args[ctx->num_pos + 2 * i].s;
+        MVM_gc_write_barrier(tc, &(sf->common.header), (MVMCollectable *)plan->arg_names[i]);
+    }
+    do {
+        plan->next = (MVMArgsPlan *)MVM_load(&body->args_plans);
+    } while (!MVM_trycas(&body->args_plans, plan->next, plan));
+    ctx->plan = plan;
+}
+
+/* Adds the strings held by the binding plans of a static frame to the GC
+ * worklist. */
+void MVM_args_plans_gc_mark(MVMThreadContext *tc, MVMStaticFrameBody *body, MVMGCWorklist *worklist) {
+    MVMArgsPlan *plan;
+    for (plan = (MVMArgsPlan *)body->args_plans; plan; plan = plan->next) {
+        MVMuint32 i, n = (MVMuint32)MVM_load(&plan->num_params);
+        MVM_gc_worklist_add(tc, worklist, &plan->sf);
+        for (i = 0; i < plan->num_nameds; i++)
+            MVM_gc_worklist_add(tc, worklist, &plan->arg_names[i]);
+        for (i = 0; i < n; i++)
+            MVM_gc_worklist_add(tc, worklist, &plan->param_names[i]);
+    }
+}
+
+/* Frees the binding plans of a static frame. */
+void MVM_args_plans_destroy(MVMThreadContext *tc, MVMStaticFrameBody *body) {
+    MVMArgsPlan *plan = (MVMArgsPlan *)body->args_plans;
+    while (plan) {
+        MVMArgsPlan *next = plan->next;
+        MVM_checked_free_null(plan->arg_names);
+        free(plan);
+        plan = next;
+    }
+    body->args_plans = 0;
+}
+
+/* Finds the named argument for a named parameter, as find_named does, but
+ * through the call's binding plan if it has one, so that the same call site
+ * calling again needs no string comparisons. */
+static MVMint32 find_named_param(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMString *name) {
+    MVMArgsPlan *plan = ctx->plan;
+    MVMint32     slot;
+    MVMuint32    i, n;
+
+    if (!plan)
+        return find_named(tc, ctx, name);
+
+    n = (MVMuint32)MVM_load(&plan->num_params);
+    for (i = 0; i < n; i++)
+        if (plan->param_names[i] == name)
+            return plan->param_slots[i];
+
+    slot = find_named(tc, ctx, name);
+    if (n < MVM_ARGS_PLAN_PARAMS && MVM_trycas(&plan->num_params, n, n + 1)) {
+        plan->param_slots[n] = slot;
+        MVM_barrier();
+        MVM_gc_write_barrier(tc, &(plan->sf->common.header), (MVMCollectable *)name);
+        plan->param_names[n] = name;
+    }
+    return slot;
+}
+
 #define args_get_named(tc, ctx, name, required, _type) do { \
      \
-    MVMuint32 flag_pos, arg_pos; \
+    MVMint32 slot = find_named_param(tc, ctx, name); \
     result.arg.s = NULL; \
     result.exists = 0; \
      \
-    for (flag_pos = arg_pos = ctx->num_pos; arg_pos < ctx->arg_count; flag_pos++, arg_pos += 2) { \
-        if (MVM_string_equal(tc, ctx->args[arg_pos].s, name)) { \
-            if (ctx->named_used[(arg_pos - ctx->num_pos)/2]) { \
-                MVM_exception_throw_adhoc(tc, "Named argument '%s' already used", MVM_string_utf8_encode_C_string(tc, name)); \
-            } \
-            result.arg    = ctx->args[arg_pos + 1]; \
-            result.flags  = (ctx->arg_flags ? ctx->arg_flags : ctx->callsite->arg_flags)[flag_pos]; \
-            result.exists = 1; \
-            ctx->named_used[(arg_pos - ctx->num_pos)/2] = 1; \
-            break; \
+    if (slot >= 0) { \
+        if (NAMED_USED(ctx, slot)) { \
+            MVM_exception_throw_adhoc(tc, "Named argument '%s' already used", MVM_string_utf8_encode_C_string(tc, name)); \
         } \
+        result.arg    = ctx->args[ctx->num_pos + 2 * slot + 1]; \
+        result.flags  = (ctx->arg_flags ? ctx->arg_flags : ctx->callsite->arg_flags)[ctx->num_pos + slot]; \
+        result.exists = 1; \
+        MARK_NAMED_USED(ctx, slot); \
     } \
     if (!result.exists && required) \
         MVM_exception_throw_adhoc(tc, "Required named parameter '%s' not passed", MVM_string_utf8_encode_C_string(tc, name)); \
@@ -339,16 +450,17 @@ MVMint64 MVM_args_has_named(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMStr
     return 0;
 }
 void MVM_args_assert_nameds_used(MVMThreadContext *tc, MVMArgProcContext *ctx) {
-    if (ctx->named_used) {
-        MVMuint16 size = (ctx->arg_count - ctx->num_pos) / 2;
-        MVMuint16 i;
-        for (i = 0; i < size; i++)
-            if (!ctx->named_used[i])
-                MVM_exception_throw_adhoc(tc,
-                    "Unexpected named parameter '%s' passed",
-                    MVM_string_utf8_encode_C_string(tc,
-                        ctx->args[ctx->num_pos + 2 * i].s));
-    }
+    MVMuint16 size = (ctx->arg_count - ctx->num_pos) / 2;
+    MVMuint16 i;
+    if (size <= MVM_ARGS_NAMED_USED_BITS &&
+            ctx->named_used_bits == (size == 64 ? ~(MVMuint64)0 : ((MVMuint64)1 << size) - 1))
+        return;
+    for (i = 0; i < size; i++)
+        if (!NAMED_USED(ctx, i))
+            MVM_exception_throw_adhoc(tc,
+                "Unexpected named parameter '%s' passed",
+                MVM_string_utf8_encode_C_string(tc,
+                    ctx->args[ctx->num_pos + 2 * i].s));
 }
 
 /* Result setting. The frameless flag indicates that the currently
@@ -567,7 +679,7 @@ MVMObject * MVM_args_slurpy_named(MVMThreadContext *tc, MVMArgProcContext *ctx)
     for (flag_pos = arg_pos = ctx->num_pos; arg_pos < ctx->arg_count; flag_pos++, arg_pos += 2) {
         MVMString *key;
 
-        if (ctx->named_used[flag_pos - ctx->num_pos]) continue;
+        if (NAMED_USED(ctx, flag_pos - ctx->num_pos)) continue;
 
         key = ctx->args[arg_pos].s;
 
@@ -716,9 +828,10 @@ static void flatten_args(MVMThreadContext *tc, MVMArgProcContext *ctx) {
 
         if (arg_info.arg.o && REPR(arg_info.arg.o)->ID == MVM_REPR_ID_MVMHash) {
             MVMHashBody *body = &((MVMHash *)arg_info.arg.o)->body;
-            MVMHashEntry *current, *tmp;
+            MVMuint32 i;
 
-            HASH_ITER(hash_handle, body->hash_head, current, tmp) {
+            for (i = MVM_hash_next_entry(body, 0); i < body->num_entries; i = MVM_hash_next_entry(body, i + 1)) {
+                MVMHashEntry *current = &body->entries[i];
 
                 if (new_arg_pos + 1 >= new_args_size) {
                     new_args = realloc(new_args, (new_args_size *= 2) * sizeof(MVMRegister));
@@ -738,6 +851,7 @@ static void flatten_args(MVMThreadContext *tc, MVMArgProcContext *ctx) {
     }
 
     init_named_used(tc, ctx, (new_arg_pos - new_num_pos) / 2);
+    ctx->plan = NULL;
     ctx->args = new_args;
     ctx->arg_count = new_arg_pos;
     ctx->num_pos = new_num_pos;
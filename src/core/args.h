@@ -59,6 +59,41 @@ struct MVMCallsite {
  * have that many slots available (e.g. find_method(how, obj, name)). */
 #define MVM_MIN_CALLSITE_SIZE 3
 
+/* Maximum number of binding plans a static frame keeps, and of named
+ * parameters a plan remembers the argument for. */
+#define MVM_ARGS_PLAN_MAX       8
+#define MVM_ARGS_PLAN_PARAMS    16
+
+/* Named argument counts up to this use a bitmap rather than a bytemap to
+ * track which ones were used. */
+#define MVM_ARGS_NAMED_USED_BITS 64
+
+/* A binding plan, for calls to a static frame from a particular call site:
+ * the callsite and the names of the named arguments passed with it, and for
+ * the named parameters asked for so far, which of those arguments (if any)
+ * supplies each. Names are matched by identity, so a plan only applies to
+ * calls passing the very same name strings, as a given call site in the
+ * bytecode does; the parameter entries then need no string comparisons.
+ * Parameter entries are filled in once, their name written last. */
+struct MVMArgsPlan {
+    /* The static frame the plan belongs to. */
+    MVMStaticFrame *sf;
+
+    /* The callsite and the names of the named arguments, in order. */
+    MVMCallsite  *callsite;
+    MVMString   **arg_names;
+    MVMuint16     num_nameds;
+
+    /* Named parameters, and the index of the named argument for each, or
+     * -1 if not passed; the number of entries in use. */
+    MVMString    *param_names[MVM_ARGS_PLAN_PARAMS];
+    MVMint16      param_slots[MVM_ARGS_PLAN_PARAMS];
+    AO_t          num_params;
+
+    /* The next plan for the same static frame. */
+    MVMArgsPlan  *next;
+};
+
 /* Argument processing context. */
 /* adding these additional fields to MVMFrame adds only 12 bytes
  * (arg_flags, arg_count, and num_pos). */
@@ -72,11 +107,16 @@ struct MVMArgProcContext {
     /* The arguments. */
     MVMRegister *args;
 
-    /* Bytemap of indexes of used nameds, so the
-     * named slurpy knows which ones not to grab.
-     * XXX cache and free this at the proper times. */
+    /* Indexes of used nameds, so the named slurpy knows which ones not to
+     * grab: a bitmap if there are few enough of them, and otherwise a
+     * bytemap. named_used_size is the number of nameds. */
+    MVMuint64 named_used_bits;
     MVMuint8 *named_used;
     MVMuint16 named_used_size;
+    MVMuint16 named_used_alloc;
+
+    /* The binding plan for the call, if any. */
+    MVMArgsPlan *plan;
 
     /* The total argument count (including 2 for each
      * named arg). */
@@ -116,6 +156,9 @@ void MVM_args_proc_init(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMCallsit
 void MVM_args_proc_cleanup_for_cache(MVMThreadContext *tc, MVMArgProcContext *ctx);
 void MVM_args_proc_cleanup(MVMThreadContext *tc, MVMArgProcContext *ctx);
 void MVM_args_checkarity(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMuint16 min, MVMuint16 max);
+void MVM_args_pick_plan(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMStaticFrame *sf);
+void MVM_args_plans_gc_mark(MVMThreadContext *tc, MVMStaticFrameBody *body, MVMGCWorklist *worklist);
+void MVM_args_plans_destroy(MVMThreadContext *tc, MVMStaticFrameBody *body);
 MVMCallsite * MVM_args_proc_to_callsite(MVMThreadContext *tc, MVMArgProcContext *ctx);
 MVM_PUBLIC MVMObject * MVM_args_use_capture(MVMThreadContext *tc, MVMFrame *f);
 
@@ -134,7 +134,7 @@ static MVMString * get_heap_string(MVMThreadContext *tc, MVMCompUnit *cu, Reader
         cleanup_all(tc, rs);
         MVM_exception_throw_adhoc(tc, "String heap index beyond end of string heap");
     }
-    return cu_body->strings[heap_index];
+    return MVM_cu_string(tc, cu, heap_index);
 }
 
 /* Dissects the bytecode stream and hands back a reader pointing to the
@@ -254,37 +254,85 @@ static ReaderState * dissect_bytecode(MVMThreadContext *tc, MVMCompUnit *cu) {
     return rs;
 }
 
-/* Loads the string heap. */
-static MVMString ** deserialize_strings(MVMThreadContext *tc, MVMCompUnit *cu, ReaderState *rs) {
-    MVMCompUnitBody *cu_body = &cu->body;
-    MVMString **strings;
-    MVMuint8   *pos;
-    MVMuint32   i, ss;
+/* Sets up the string heap. Nothing is decoded yet; that happens as each
+ * string is first asked for. */
+/* Given a position in the string heap, checks there's a whole string there
+ * and returns its length, which precedes it. */
+static MVMuint32 heap_string_size(MVMThreadContext *tc, MVMCompUnit *cu, MVMuint8 *pos) {
+    MVMuint8  *limit = cu->body.data_start + cu->body.data_size;
+    MVMuint32  ss;
+    if (pos + 4 > limit)
+        MVM_exception_throw_adhoc(tc, "Read past end of string heap");
+    ss = read_int32(pos, 0);
+    if (pos + 4 + ss > limit)
+        MVM_exception_throw_adhoc(tc, "Read past end of string heap");
+    return ss;
+}
 
-    /* Allocate space for strings list. */
-    if (rs->expected_strings == 0)
-        return NULL;
-    strings = malloc(sizeof(MVMString *) * rs->expected_strings);
+/* Given a position in the string heap, returns that of the next string. */
+static MVMuint8 * next_heap_string(MVMuint8 *pos, MVMuint32 ss) {
+    return pos + 4 + ss + (ss & 3 ? 4 - (ss & 3) : 0);
+}
 
-    /* Load strings. */
-    pos = rs->string_seg;
+/* Sets up the string heap, for strings to be decoded from on first use. The
+ * heap is checked in full here, so that decoding a string later can't fail,
+ * and the position of every MVM_STRING_FAST_TABLE_SPAN'th string is noted
+ * on the way. */
+static void setup_string_heap(MVMThreadContext *tc, MVMCompUnit *cu, ReaderState *rs) {
+    MVMCompUnitBody *cu_body = &cu->body;
+    MVMuint8        *pos     = rs->string_seg;
+    MVMuint32        i, ss;
+    cu_body->num_strings = rs->expected_strings;
+    if (rs->expected_strings == 0)
+        return;
+    cu_body->strings = calloc(rs->expected_strings, sizeof(MVMString *));
+    cu_body->string_heap_start = rs->string_seg;
+    cu_body->string_heap_fast_table = malloc(
+        (rs->expected_strings / MVM_STRING_FAST_TABLE_SPAN + 1) * sizeof(MVMuint32));
     for (i = 0; i < rs->expected_strings; i++) {
-        /* Ensure we can read at least a string size here and do so. */
-        ensure_can_read(tc, cu, rs, pos, 4);
-        ss = read_int32(pos, 0);
-        pos += 4;
-
-        /* Ensure we can read in the string of this size, and decode
-         * it if so. */
-        ensure_can_read(tc, cu, rs, pos, ss);
-        MVM_ASSIGN_REF(tc, &(cu->common.header), strings[i], MVM_string_utf8_decode(tc, tc->instance->VMString, pos, ss));
-        pos += ss;
-
-        /* Add alignment. */
-        pos += ss & 3 ? 4 - (ss & 3) : 0;
+        if (i % MVM_STRING_FAST_TABLE_SPAN == 0)
+            cu_body->string_heap_fast_table[i / MVM_STRING_FAST_TABLE_SPAN] =
+                pos - cu_body->string_heap_start;
+        ss = heap_string_size(tc, cu, pos);
+        if (!MVM_string_utf8_valid((char *)pos + 4, ss))
+            MVM_exception_throw_adhoc(tc,
+                "Malformed UTF-8 in string heap entry %u", i);
+        pos = next_heap_string(pos, ss);
     }
+}
 
-    return strings;
+/* Decodes a string from a compilation unit's string heap and stores it there,
+ * for MVM_cu_string. The heap is walked to the string from the nearest one
+ * found before whose position we know. The string is allocated straight into
+ * the second generation, since the compilation unit is going to hold on to
+ * it anyway, and so that callers needn't worry about things moving. */
+MVMString * MVM_bytecode_obtain_string(MVMThreadContext *tc, MVMCompUnit *cu, MVMuint32 idx) {
+    MVMCompUnitBody     *cu_body = &cu->body;
+    MVMuint32            bin     = idx / MVM_STRING_FAST_TABLE_SPAN;
+    MVMuint32            i, ss;
+    MVMuint8            *pos;
+    MVMString           *s;
+    MVMAllocationTarget  orig_allocate_in;
+
+    if (idx >= cu_body->num_strings)
+        MVM_exception_throw_adhoc(tc,
+            "String heap index %u beyond end of string heap", idx);
+
+    /* Walk to the string from the nearest one in the fast table, and decode
+     * it; the heap was checked at load time, so this can't throw. */
+    pos = cu_body->string_heap_start + cu_body->string_heap_fast_table[bin];
+    for (i = bin * MVM_STRING_FAST_TABLE_SPAN; i < idx; i++)
+        pos = next_heap_string(pos, read_int32(pos, 0));
+    ss = read_int32(pos, 0);
+    orig_allocate_in = tc->allocate_in;
+    tc->allocate_in  = MVMAllocate_Gen2;
+    s = MVM_string_utf8_decode(tc, tc->instance->VMString, (char *)pos + 4, ss);
+    tc->allocate_in  = orig_allocate_in;
+
+    /* Make sure the string is complete before anyone else can see it. */
+    MVM_barrier();
+    MVM_ASSIGN_REF(tc, &(cu->common.header), cu_body->strings[idx], s);
+    return s;
 }
 
 /* Loads the SC dependencies list. */
@@ -314,7 +362,7 @@ static void deserialize_sc_deps(MVMThreadContext *tc, MVMCompUnit *cu, ReaderSta
             cleanup_all(tc, rs);
             MVM_exception_throw_adhoc(tc, "String heap index beyond end of string heap");
         }
-        handle = cu_body->strings[sh_idx];
+        handle = MVM_cu_string(tc, cu, sh_idx);
 
         /* See if we can resolve it. */
         uv_mutex_lock(&tc->instance->mutex_sc_weakhash);
@@ -366,7 +414,7 @@ static MVMExtOpRecord * deserialize_extop_records(MVMThreadContext *tc, MVMCompU
             MVM_exception_throw_adhoc(tc,
                     "String heap index beyond end of string heap");
         }
-        extops[i].name = cu->body.strings[name_idx];
+        extops[i].name = MVM_cu_string(tc, cu, name_idx);
 
         /* Read operand descriptor. */
         ensure_can_read(tc, cu, rs, pos, 8);
@@ -732,8 +780,7 @@ void MVM_bytecode_unpack(MVMThreadContext *tc, MVMCompUnit *cu) {
     rs = dissect_bytecode(tc, cu);
 
     /* Load the strings heap. */
-    cu_body->strings = deserialize_strings(tc, cu, rs);
-    cu_body->num_strings = rs->expected_strings;
+    setup_string_heap(tc, cu, rs);
 
     /* Load SC dependencies. */
     deserialize_sc_deps(tc, cu, rs);
@@ -753,7 +800,7 @@ void MVM_bytecode_unpack(MVMThreadContext *tc, MVMCompUnit *cu) {
     cu_body->num_callsites = rs->expected_callsites;
 
     /* Resolve HLL name. */
-    MVM_ASSIGN_REF(tc, &(cu->common.header), cu_body->hll_name, cu_body->strings[rs->hll_str_idx]);
+    MVM_ASSIGN_REF(tc, &(cu->common.header), cu_body->hll_name, MVM_cu_string(tc, cu, rs->hll_str_idx));
 
     /* Resolve special frames. */
     if (rs->main_frame)
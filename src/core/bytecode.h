@@ -5,5 +5,11 @@ struct MVMBytecodeAnnotation {
     MVMuint32 line_number;
 };
 
+/* Every this many strings in a compilation unit's string heap, we remember
+ * where the next one starts, to save walking the heap from the start each
+ * time a string is decoded. */
+#define MVM_STRING_FAST_TABLE_SPAN 16
+
 void MVM_bytecode_unpack(MVMThreadContext *tc, MVMCompUnit *cu);
+MVMString * MVM_bytecode_obtain_string(MVMThreadContext *tc, MVMCompUnit *cu, MVMuint32 idx);
 MVMBytecodeAnnotation * MVM_bytecode_resolve_annotation(MVMThreadContext *tc, MVMStaticFrameBody *sfb, MVMuint32 offset);
@@ -0,0 +1,259 @@
+#include "moar.h"
+#include "platform/mmap.h"
+#include <sha1.h>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#define O_RDONLY _O_RDONLY
+#define O_WRONLY _O_WRONLY
+#define O_CREAT  _O_CREAT
+#define O_TRUNC  _O_TRUNC
+#endif
+
+/* Cache files start with a header, followed by an entry for each frame in
+ * the compilation unit and then the instruction offsets tables of those
+ * frames that have one. All of it is in the native byte order, since a
+ * cache is only ever used on the machine that wrote it. */
+#define CACHE_MAGIC "MOARVMBC"
+typedef struct {
+    char          magic[8];
+    MVMuint32     version;
+    MVMuint32     num_frames;
+    unsigned char digest[SHA1_DIGEST_SIZE];
+} CacheHeader;
+typedef struct {
+    /* The size of the frame's bytecode, and so of its instruction offsets
+     * table, and the offset of that table in the file (0 if there isn't
+     * one). */
+    MVMuint32 bytecode_size;
+    MVMuint32 offset;
+} CacheFrameEntry;
+
+/* Computes the key a compilation unit's cache is stored under. The
+ * instruction offsets depend on the ops as well as the bytecode, so the VM
+ * version and op count go into it too. */
+static void compute_key(MVMThreadContext *tc, MVMCompUnit *cu, unsigned char *digest) {
+    SHA1_CTX  context;
+    MVMuint32 num_ops = 0;
+    while (MVM_op_get_op((unsigned short)num_ops))
+        num_ops++;
+    SHA1_Init(&context);
+    SHA1_Update(&context, (const unsigned char *)MVM_VERSION, strlen(MVM_VERSION));
+    SHA1_Update(&context, (const unsigned char *)&num_ops, sizeof(num_ops));
+    SHA1_Update(&context, cu->body.data_start, cu->body.data_size);
+    SHA1_Final(&context, digest);
+}
+
+/* Unmaps a cache's file, if it has one mapped. */
+static void unmap_cache_file(MVMBytecodeCache *cache) {
+    if (cache->mapping) {
+        MVM_platform_unmap_file(cache->mapping, cache->mapping_handle, (size_t)cache->mapping_size);
+        cache->mapping      = NULL;
+        cache->mapping_size = 0;
+    }
+}
+
+/* Maps in a cache's file, if there is one that matches the compilation unit,
+ * and points the instruction offsets of the frames found in it there. */
+static void map_cache_file(MVMThreadContext *tc, MVMBytecodeCache *cache, const unsigned char *digest) {
+    MVMCompUnitBody *cu_body = &cache->cu->body;
+    CacheHeader      header;
+    MVMuint64        size;
+    MVMuint32        i;
+    uv_file          fd;
+    uv_fs_t          req;
+
+    if (uv_fs_stat(tc->loop, &req, cache->path, NULL) < 0)
+        return;
+    size = req.statbuf.st_size;
+    if (size < sizeof(CacheHeader) || size > 0xFFFFFFFF)
+        return;
+    if ((fd = uv_fs_open(tc->loop, &req, cache->path, O_RDONLY, 0, NULL)) < 0)
+        return;
+    cache->mapping      = MVM_platform_map_file(fd, &cache->mapping_handle, (size_t)size, 0);
+    cache->mapping_size = size;
+    uv_fs_close(tc->loop, &req, fd, NULL);
+    if (!cache->mapping)
+        return;
+
+    /* Make sure it's a cache for this compilation unit. */
+    memcpy(&header, cache->mapping, sizeof(CacheHeader));
+    if (memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) != 0
+            || header.version != MVM_BYTECODE_CACHE_VERSION
+            || memcmp(header.digest, digest, SHA1_DIGEST_SIZE) != 0
+            || header.num_frames != cu_body->num_frames
+            || sizeof(CacheHeader) + (MVMuint64)header.num_frames * sizeof(CacheFrameEntry) > size) {
+        unmap_cache_file(cache);
+        return;
+    }
+
+    /* Take the instruction offsets of each frame in it. */
+    for (i = 0; i < header.num_frames; i++) {
+        MVMStaticFrame  *sf = cu_body->frames[i];
+        CacheFrameEntry  entry;
+        memcpy(&entry, cache->mapping + sizeof(CacheHeader) + i * sizeof(CacheFrameEntry),
+            sizeof(CacheFrameEntry));
+        if (entry.offset && entry.bytecode_size == sf->body.bytecode_size
+                && (MVMuint64)entry.offset + entry.bytecode_size <= size)
+            sf->body.instr_offsets = cache->mapping + entry.offset;
+    }
+}
+
+/* Sets up the bytecode cache for a compilation unit loaded from a file, and
+ * takes what it can from the cache file if there is one. Does nothing if
+ * no cache directory is configured. */
+void MVM_bytecode_cache_load(MVMThreadContext *tc, MVMCompUnit *cu) {
+    const char       *dir = tc->instance->bytecode_cache_dir;
+    unsigned char     digest[SHA1_DIGEST_SIZE];
+    char              hex[SHA1_DIGEST_SIZE * 2 + 1];
+    MVMBytecodeCache *cache;
+    MVMBytecodeCache *head;
+
+    if (!dir)
+        return;
+
+    compute_key(tc, cu, digest);
+    SHA1_DigestToHex(digest, hex);
+
+    cache       = calloc(1, sizeof(MVMBytecodeCache));
+    cache->path = malloc(strlen(dir) + sizeof(hex) + 8);
+    sprintf(cache->path, "%s/%s.mvc", dir, hex);
+    memcpy(cache->digest, digest, SHA1_DIGEST_SIZE);
+    cache->cu = cu;
+    MVM_gc_root_add_permanent(tc, (MVMCollectable **)&cache->cu);
+
+    /* Add it to the instance's list, so it gets saved at exit. */
+    do {
+        head        = (MVMBytecodeCache *)MVM_load(&tc->instance->bytecode_caches);
+        cache->next = head;
+    } while (!MVM_trycas(&tc->instance->bytecode_caches, head, cache));
+
+    map_cache_file(tc, cache, digest);
+}
+
+/* If a frame's instruction offsets were found in the bytecode cache, makes
+ * it ready to run without validation by resolving any extension ops that it
+ * uses, as validation would. Returns zero if it has to be validated after
+ * all, in which case the cached offsets are dropped. */
+MVMint32 MVM_bytecode_cache_prepare_frame(MVMThreadContext *tc, MVMStaticFrame *sf) {
+    MVMStaticFrameBody *body    = &sf->body;
+    MVMCompUnitBody    *cu_body = &body->cu->body;
+    MVMuint8           *labels  = body->instr_offsets;
+    MVMuint32           pos;
+
+    if (!labels)
+        return 0;
+
+    for (pos = 0; pos < body->bytecode_size; pos++) {
+        if (labels[pos] & MVM_BC_op_boundary) {
+            MVMuint16 op = *(MVMuint16 *)(body->bytecode + pos);
+            if (op >= MVM_OP_EXT_BASE) {
+                MVMuint16 index = op - MVM_OP_EXT_BASE;
+                if (index >= cu_body->num_extops
+                        || !MVM_ext_resolve_extop_record(tc, &cu_body->extops[index])) {
+                    body->instr_offsets = NULL;
+                    return 0;
+                }
+            }
+        }
+    }
+
+    return 1;
+}
+
+/* Checks if any of a compilation unit's frames were validated while running,
+ * rather than being found in the cache. */
+static MVMint32 has_new_frames(MVMBytecodeCache *cache) {
+    MVMCompUnitBody *cu_body = &cache->cu->body;
+    MVMuint32        i;
+    for (i = 0; i < cu_body->num_frames; i++) {
+        MVMuint8 *labels = cu_body->frames[i]->body.instr_offsets;
+        if (labels && (labels < cache->mapping
+                || labels >= cache->mapping + cache->mapping_size))
+            return 1;
+    }
+    return 0;
+}
+
+/* Writes out a cache file with the instruction offsets of all frames that
+ * have them. It goes to a temporary file first, which is then renamed over
+ * the cache file, so other processes never see a partly written one. Any
+ * failure just means no cache gets saved. */
+static void save_cache_file(MVMThreadContext *tc, MVMBytecodeCache *cache) {
+    MVMCompUnitBody *cu_body = &cache->cu->body;
+    CacheHeader      header;
+    MVMuint64        size;
+    MVMuint32        offset, i;
+    char            *buffer;
+    char            *tmp_path;
+    uv_file          fd;
+    uv_fs_t          req;
+
+    /* Work out the size of the file. */
+    size = sizeof(CacheHeader) + (MVMuint64)cu_body->num_frames * sizeof(CacheFrameEntry);
+    for (i = 0; i < cu_body->num_frames; i++)
+        if (cu_body->frames[i]->body.instr_offsets)
+            size += cu_body->frames[i]->body.bytecode_size;
+    if (size > 0xFFFFFFFF)
+        return;
+
+    /* Assemble it. */
+    buffer = malloc((size_t)size);
+    memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+    header.version    = MVM_BYTECODE_CACHE_VERSION;
+    header.num_frames = cu_body->num_frames;
+    memcpy(header.digest, cache->digest, SHA1_DIGEST_SIZE);
+    memcpy(buffer, &header, sizeof(CacheHeader));
+    offset = sizeof(CacheHeader) + cu_body->num_frames * sizeof(CacheFrameEntry);
+    for (i = 0; i < cu_body->num_frames; i++) {
+        MVMStaticFrameBody *body = &cu_body->frames[i]->body;
+        CacheFrameEntry     entry;
+        entry.bytecode_size = body->bytecode_size;
+        entry.offset        = 0;
+        if (body->instr_offsets) {
+            entry.offset = offset;
+            memcpy(buffer + offset, body->instr_offsets, body->bytecode_size);
+            offset += body->bytecode_size;
+        }
+        memcpy(buffer + sizeof(CacheHeader) + i * sizeof(CacheFrameEntry), &entry,
+            sizeof(CacheFrameEntry));
+    }
+
+    /* Write it out. */
+    uv_fs_mkdir(tc->loop, &req, tc->instance->bytecode_cache_dir, 0755, NULL);
+    tmp_path = malloc(strlen(cache->path) + 32);
+    sprintf(tmp_path, "%s.%lld.tmp", cache->path, (long long)MVM_proc_getpid(tc));
+    if ((fd = uv_fs_open(tc->loop, &req, tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644, NULL)) >= 0) {
+        MVMint32 written = uv_fs_write(tc->loop, &req, fd, (const void *)buffer, (size_t)size, 0, NULL) == size;
+        uv_fs_close(tc->loop, &req, fd, NULL);
+        if (!written || uv_fs_rename(tc->loop, &req, tmp_path, cache->path, NULL) < 0)
+            uv_fs_unlink(tc->loop, &req, tmp_path, NULL);
+    }
+    free(tmp_path);
+    free(buffer);
+}
+
+/* Saves the caches of all compilation units that had frames validated that
+ * their cache lacked. Called as the VM is destroyed, before objects go. */
+void MVM_bytecode_cache_save_all(MVMThreadContext *tc) {
+    MVMBytecodeCache *cache = (MVMBytecodeCache *)MVM_load(&tc->instance->bytecode_caches);
+    while (cache) {
+        if (has_new_frames(cache))
+            save_cache_file(tc, cache);
+        cache = cache->next;
+    }
+}
+
+/* Frees all bytecode caches, unmapping their files. */
+void MVM_bytecode_cache_destroy_all(MVMInstance *instance) {
+    MVMBytecodeCache *cache = (MVMBytecodeCache *)MVM_load(&instance->bytecode_caches);
+    while (cache) {
+        MVMBytecodeCache *next = cache->next;
+        unmap_cache_file(cache);
+        free(cache->path);
+        free(cache);
+        cache = next;
+    }
+    MVM_store(&instance->bytecode_caches, NULL);
+    MVM_checked_free_null(instance->bytecode_cache_dir);
+}
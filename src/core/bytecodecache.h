@@ -0,0 +1,39 @@
+/* A bytecode cache keeps what was worked out about the frames of a bytecode
+ * file on disk, so that processes loading the same file later needn't work
+ * it out again. Caches live in the directory named by the MVM_BYTECODE_CACHE
+ * environment variable, if it is set, and are keyed by a hash of the file's
+ * contents (and the VM version and op count), so an edited file or a
+ * different VM never picks up a stale one.
+ *
+ * At present, what is kept is the result of validating each frame: its
+ * instruction offsets table. This is mapped back in and used in place, so
+ * frames found in the cache are not validated again on first invocation.
+ * Frames validated while running that the cache lacked are written out to
+ * a new cache file as the VM is destroyed. */
+
+/* Cache file format version. */
+#define MVM_BYTECODE_CACHE_VERSION 1
+
+struct MVMBytecodeCache {
+    /* The file the cache is kept in. */
+    char *path;
+
+    /* The SHA-1 key of the cache, which is also kept in the file. */
+    MVMuint8 digest[20];
+
+    /* The mapped cache file, if there was a usable one, and its size. */
+    MVMuint8  *mapping;
+    void      *mapping_handle;
+    MVMuint64  mapping_size;
+
+    /* The compilation unit this is the cache for (a permanent root). */
+    MVMCompUnit *cu;
+
+    /* The next cache in the instance's list of them. */
+    MVMBytecodeCache *next;
+};
+
+void MVM_bytecode_cache_load(MVMThreadContext *tc, MVMCompUnit *cu);
+MVMint32 MVM_bytecode_cache_prepare_frame(MVMThreadContext *tc, MVMStaticFrame *sf);
+void MVM_bytecode_cache_save_all(MVMThreadContext *tc);
+void MVM_bytecode_cache_destroy_all(MVMInstance *instance);
@@ -102,6 +102,7 @@ char * MVM_bytecode_dump(MVMThreadContext *tc, MVMCompUnit *cu) {
         frame_lexicals[k] = lexicals;
 
         HASH_ITER(hash_handle, frame->body.lexical_names, current, tmp) {
+            name->body.flags  = MVM_STRING_TYPE_INT32;
             name->body.int32s = (MVMint32 *)current->hash_handle.key;
             name->body.graphs = (MVMuint32)current->hash_handle.keylen / sizeof(MVMCodepoint32);
             lexicals[current->value] = MVM_string_utf8_encode_C_string(tc, name);
@@ -251,7 +252,7 @@ char * MVM_bytecode_dump(MVMThreadContext *tc, MVMCompUnit *cu) {
                     case MVM_operand_str:
                         operand_size = 4;
                         tmpstr = MVM_string_utf8_encode_C_string(
-                            tc, cu->body.strings[GET_UI32(cur_op, 0)]);
+                            tc, MVM_cu_string(tc, cu, GET_UI32(cur_op, 0)));
                         /* XXX C-string-literal escape the \ and '
                             and line breaks and non-ascii someday */
                         a("'%s'", tmpstr);
@@ -337,9 +338,9 @@ char * MVM_bytecode_dump(MVMThreadContext *tc, MVMCompUnit *cu) {
             if (annotations[j]) {
 				MVMuint16 shi = GET_UI16(frame->body.annotations_data + 4, (annotations[j] - 1)*12);
                 tmpstr = MVM_string_utf8_encode_C_string(
-                    tc, cu->body.strings[
+                    tc, MVM_cu_string(tc, cu,
 						shi < cu->body.num_strings ? shi : 0
-					]);
+					));
                 a("     annotation: %s:%u\n", tmpstr, GET_UI32(frame->body.annotations_data, (annotations[j] - 1)*12 + 8));
                 free(tmpstr);
             }
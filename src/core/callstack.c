@@ -0,0 +1,122 @@
+#include "moar.h"
+
+/* Size of a block header, keeping what follows it aligned for registers. */
+#define BLOCK_HEADER_SIZE \
+    ((sizeof(MVMCallStackBlock) + sizeof(MVMRegister) - 1) & ~(sizeof(MVMRegister) - 1))
+
+/* Allocates a region able to hold at least the given number of bytes of
+ * blocks. */
+static MVMCallStackRegion * region_create(size_t size) {
+    MVMCallStackRegion *region;
+    size_t header = (sizeof(MVMCallStackRegion) + sizeof(MVMRegister) - 1) & ~(sizeof(MVMRegister) - 1);
+    if (size < MVM_CALLSTACK_REGION_SIZE)
+        size = MVM_CALLSTACK_REGION_SIZE;
+    region              = malloc(header + size);
+    region->start       = (char *)region + header;
+    region->alloc       = region->start;
+    region->alloc_limit = region->start + size;
+    region->prev        = NULL;
+    region->next        = NULL;
+    region->live        = 0;
+    region->sealed      = 0;
+    return region;
+}
+
+/* Moves on to the next region in the call stack, which must have space for
+ * a block of the given size; the spare one after the current region is used
+ * if it's big enough, and otherwise replaced. */
+static MVMCallStackRegion * next_region(MVMThreadContext *tc, size_t size) {
+    MVMCallStackRegion *cur  = tc->callstack_region;
+    MVMCallStackRegion *next = cur ? cur->next : NULL;
+    if (!next || next->alloc + size > next->alloc_limit) {
+        MVMCallStackRegion *spare = next;
+        while (spare) {
+            MVMCallStackRegion *after = spare->next;
+            free(spare);
+            spare = after;
+        }
+        next = region_create(size);
+        next->prev = cur;
+        if (cur)
+            cur->next = next;
+    }
+    tc->callstack_region = next;
+    return next;
+}
+
+/* Allocates a block of the given size on the thread's call stack. It is not
+ * zeroed. */
+void * MVM_callstack_alloc(MVMThreadContext *tc, size_t size) {
+    MVMCallStackRegion *region = tc->callstack_region;
+    MVMCallStackBlock  *block;
+
+    size = BLOCK_HEADER_SIZE + ((size + sizeof(MVMRegister) - 1) & ~(sizeof(MVMRegister) - 1));
+    if (!region || region->alloc + size > region->alloc_limit)
+        region = next_region(tc, size);
+
+    block          = (MVMCallStackBlock *)region->alloc;
+    block->region  = region;
+    block->prev    = tc->callstack_top;
+    block->freed   = 0;
+    region->alloc += size;
+    region->live++;
+    tc->callstack_top = block;
+
+    return (char *)block + BLOCK_HEADER_SIZE;
+}
+
+/* Frees a block allocated on a call stack. If the block is in a sealed
+ * region, this may be done by any thread; otherwise, it must be done by the
+ * thread that allocated it, in which case any freed blocks at the top of its
+ * call stack are popped. */
+void MVM_callstack_free(MVMThreadContext *tc, void *mem) {
+    MVMCallStackBlock  *block  = (MVMCallStackBlock *)((char *)mem - BLOCK_HEADER_SIZE);
+    MVMCallStackRegion *region = block->region;
+
+    if (region->sealed) {
+        if (MVM_decr(&region->live) == 1)
+            free(region);
+        return;
+    }
+
+    block->freed = 1;
+    region->live--;
+    while (tc->callstack_top && tc->callstack_top->freed) {
+        MVMCallStackBlock *top = tc->callstack_top;
+        top->region->alloc   = (char *)top;
+        tc->callstack_region = top->region;
+        tc->callstack_top    = top->prev;
+    }
+}
+
+/* Seals the thread's call stack, so nothing in it will be allocated from or
+ * popped again; the thread goes on with a new one. Regions with nothing
+ * live in them are freed right away. */
+void MVM_callstack_seal(MVMThreadContext *tc) {
+    MVMCallStackRegion *region = tc->callstack_region;
+    if (!region)
+        return;
+    while (region->prev)
+        region = region->prev;
+    while (region) {
+        MVMCallStackRegion *next = region->next;
+        if (region->live) {
+            region->prev   = NULL;
+            region->next   = NULL;
+            region->sealed = 1;
+        }
+        else {
+            free(region);
+        }
+        region = next;
+    }
+    MVM_barrier();
+    tc->callstack_region = NULL;
+    tc->callstack_top    = NULL;
+}
+
+/* Frees a thread's call stack. Anything still live in it is left to be
+ * freed along with the frames it belongs to. */
+void MVM_callstack_destroy(MVMThreadContext *tc) {
+    MVM_callstack_seal(tc);
+}
@@ -0,0 +1,56 @@
+/* Each thread has a call stack: a chain of regions that the lexical
+ * environment and work area of each frame it invokes are bump-allocated
+ * from, in one block per frame. Frames release their block when they
+ * return, which (continuations aside) happens in the reverse order to that
+ * they were invoked in, so freeing a block normally just moves the
+ * allocation pointer back. A frame that is captured (for example, as the
+ * outer of a closure) and so outlives its return gets its environment moved
+ * to the heap at that point; its work area is no longer needed.
+ *
+ * Frames taken into a continuation may be resumed later, possibly by a
+ * different thread, so need all they have kept where it is. Taking a
+ * continuation seals the thread's call stack, and the thread starts a new
+ * one. A sealed region is never allocated from again, and is freed by
+ * whoever releases its last live block. */
+
+/* Size of a call stack region, unless a block too big for it is needed. */
+#define MVM_CALLSTACK_REGION_SIZE 32768
+
+struct MVMCallStackRegion {
+    /* Where the blocks start, where the next will be allocated, and the
+     * end of the region. */
+    char *start;
+    char *alloc;
+    char *alloc_limit;
+
+    /* The regions before and after this one in the thread's call stack;
+     * those after the one being allocated from are empty, kept for reuse. */
+    MVMCallStackRegion *prev;
+    MVMCallStackRegion *next;
+
+    /* Number of blocks in the region that are yet to be freed. Only
+     * updated atomically once the region is sealed. */
+    AO_t live;
+
+    /* Whether the region is sealed. */
+    MVMuint8 sealed;
+};
+
+/* Header of a block allocated from a call stack region. */
+struct MVMCallStackBlock {
+    /* The region the block is in. */
+    MVMCallStackRegion *region;
+
+    /* The block allocated before this one, which will be the top of the
+     * call stack once this one is freed. */
+    MVMCallStackBlock *prev;
+
+    /* Whether the block was freed, but could not yet be popped off the
+     * call stack since blocks allocated after it are still in use. */
+    MVMuint32 freed;
+};
+
+void * MVM_callstack_alloc(MVMThreadContext *tc, size_t size);
+void MVM_callstack_free(MVMThreadContext *tc, void *mem);
+void MVM_callstack_seal(MVMThreadContext *tc);
+void MVM_callstack_destroy(MVMThreadContext *tc);
@@ -54,6 +54,9 @@ MVMCompUnit * MVM_cu_map_from_file(MVMThreadContext *tc, const char *filename) {
         MVM_exception_throw_adhoc(tc, "Failed to close filehandle: %s", uv_strerror(req.result));
     }
 
-    /* Turn it into a compilation unit. */
-    return MVM_cu_from_bytes(tc, (MVMuint8 *)block, (MVMuint32)size);
+    /* Turn it into a compilation unit, and take what we can from its
+     * bytecode cache. */
+    cu = MVM_cu_from_bytes(tc, (MVMuint8 *)block, (MVMuint32)size);
+    MVM_bytecode_cache_load(tc, cu);
+    return cu;
 }
@@ -68,6 +68,18 @@ void MVM_continuation_control(MVMThreadContext *tc, MVMint64 protect,
     if (!root_frame)
         MVM_exception_throw_adhoc(tc, "No continuation root frame found");
 
+    /* The frames going into the continuation keep their lexicals and work
+     * areas where they are on the call stack, so it must not be popped or
+     * allocated from further. */
+    MVM_callstack_seal(tc);
+
+    /* Frames in a continuation may be resumed and released by any thread. */
+    MVM_frame_share(tc, tc->cur_frame);
+
+    /* We leave frames without them returning, so cached dynamic variable
+     * lookups starting from them must go. */
+    MVM_frame_dynlex_cache_clear(tc, NULL);
+
     /* Create continuation. */
     MVMROOT(tc, code, {
         cont = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTContinuation);
@@ -97,7 +109,7 @@ void MVM_continuation_control(MVMThreadContext *tc, MVMint64 protect,
     MVM_frame_dec_ref(tc, tc->cur_frame);
     tc->cur_frame = MVM_frame_inc_ref(tc, jump_frame);
     *(tc->interp_cur_op) = tc->cur_frame->return_address;
-    *(tc->interp_bytecode_start) = tc->cur_frame->static_info->body.bytecode;
+    *(tc->interp_bytecode_start) = tc->cur_frame->effective_bytecode;
     *(tc->interp_reg_base) = tc->cur_frame->work;
     *(tc->interp_cu) = tc->cur_frame->static_info->body.cu;
 
@@ -123,7 +135,8 @@ void MVM_continuation_invoke(MVMThreadContext *tc, MVMContinuation *cont,
                              MVMObject *code, MVMRegister *res_reg) {
     /* Switch caller of the root to current invoker. */
     MVMFrame *orig_caller = cont->body.root->caller;
-    cont->body.root->caller = MVM_frame_inc_ref(tc, tc->cur_frame);
+    cont->body.root->caller = MVM_frame_inc_ref(tc, MVM_frame_share(tc, tc->cur_frame));
+    MVM_frame_dynlex_cache_clear(tc, NULL);
     MVM_frame_dec_ref(tc, orig_caller);
 
     /* Set up current frame to receive result. */
@@ -135,7 +148,7 @@ void MVM_continuation_invoke(MVMThreadContext *tc, MVMContinuation *cont,
     MVM_frame_dec_ref(tc, tc->cur_frame);
     tc->cur_frame = MVM_frame_inc_ref(tc, cont->body.top);
     *(tc->interp_cur_op) = cont->body.addr;
-    *(tc->interp_bytecode_start) = tc->cur_frame->static_info->body.bytecode;
+    *(tc->interp_bytecode_start) = tc->cur_frame->effective_bytecode;
     *(tc->interp_reg_base) = tc->cur_frame->work;
     *(tc->interp_cu) = tc->cur_frame->static_info->body.cu;
 
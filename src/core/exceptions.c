@@ -66,7 +66,7 @@ static MVMFrameHandler * search_frame_handlers(MVMThreadContext *tc, MVMFrame *f
     if (f == tc->cur_frame)
         pc = (MVMuint32)(*tc->interp_cur_op - *tc->interp_bytecode_start);
     else
-        pc = (MVMuint32)(f->return_address - sf->body.bytecode);
+        pc = (MVMuint32)(f->return_address - f->effective_bytecode);
     for (i = 0; i < sf->body.num_handlers; i++) {
         MVMuint32 category_mask = sf->body.handlers[i].category_mask;
         if ((category_mask & cat) || ((category_mask & MVM_EX_CAT_CONTROL) && cat != MVM_EX_CAT_CATCH))
@@ -225,7 +225,7 @@ char * MVM_exception_backtrace_line(MVMThreadContext *tc, MVMFrame *cur_frame, M
      * we can update it if necessary, and the caller can cache it. */
     char *o = malloc(1024);
     MVMuint8 *cur_op = not_top ? cur_frame->return_address : cur_frame->throw_address;
-    MVMuint32 offset = cur_op - cur_frame->static_info->body.bytecode;
+    MVMuint32 offset = cur_op - cur_frame->effective_bytecode;
     MVMuint32 instr = MVM_bytecode_offset_to_instr_idx(tc, cur_frame->static_info, offset);
     MVMBytecodeAnnotation *annot = MVM_bytecode_resolve_annotation(tc, &cur_frame->static_info->body,
                                         offset > 0 ? offset - 1 : 0);
@@ -234,7 +234,7 @@ char * MVM_exception_backtrace_line(MVMThreadContext *tc, MVMFrame *cur_frame, M
     MVMuint16 string_heap_index = annot ? annot->filename_string_heap_index : 0;
     char *tmp1 = annot && string_heap_index < cur_frame->static_info->body.cu->body.num_strings
         ? MVM_string_utf8_encode(tc,
-            cur_frame->static_info->body.cu->body.strings[string_heap_index], NULL)
+            MVM_cu_string(tc, cur_frame->static_info->body.cu, string_heap_index), NULL)
         : NULL;
 
     /* We may be mid-instruction if exception was thrown at an unfortunate
@@ -289,7 +289,7 @@ MVMObject * MVM_exception_backtrace(MVMThreadContext *tc, MVMObject *ex_obj) {
 
     while (cur_frame != NULL) {
         MVMuint8             *cur_op = count ? cur_frame->return_address : cur_frame->throw_address;
-        MVMuint32             offset = cur_op - cur_frame->static_info->body.bytecode;
+        MVMuint32             offset = cur_op - cur_frame->effective_bytecode;
         MVMBytecodeAnnotation *annot = MVM_bytecode_resolve_annotation(tc, &cur_frame->static_info->body,
                                             offset > 0 ? offset - 1 : 0);
         MVMint32              fshi   = annot ? (MVMint32)annot->filename_string_heap_index : -1;
@@ -302,7 +302,7 @@ MVMObject * MVM_exception_backtrace(MVMThreadContext *tc, MVMObject *ex_obj) {
         /* file */
         if (fshi >= 0 && fshi < cur_frame->static_info->body.cu->body.num_strings)
             value = MVM_repr_box_str(tc, MVM_hll_current(tc)->str_box_type,
-                        cur_frame->static_info->body.cu->body.strings[fshi]);
+                        MVM_cu_string(tc, cur_frame->static_info->body.cu, fshi));
         else
             value = MVM_repr_box_str(tc, MVM_hll_current(tc)->str_box_type,
                         cur_frame->static_info->body.cu->body.filename);
@@ -442,7 +442,7 @@ void MVM_exception_throwobj(MVMThreadContext *tc, MVMuint8 mode, MVMObject *ex_o
         panic_unhandled_ex(tc, ex);
 
     if (!ex->body.origin) {
-        ex->body.origin = MVM_frame_inc_ref(tc, tc->cur_frame);
+        ex->body.origin = MVM_frame_inc_ref(tc, MVM_frame_share(tc, tc->cur_frame));
         tc->cur_frame->throw_address = *(tc->interp_cur_op);
         tc->cur_frame->keep_caller   = 1;
     }
@@ -511,7 +511,7 @@ MVMObject * MVM_exception_newlexotic(MVMThreadContext *tc, MVMuint32 offset) {
     /* Allocate lexotic object and set it up. */
     lexotic = (MVMLexotic *)MVM_repr_alloc_init(tc, tc->instance->Lexotic);
     lexotic->body.handler = h;
-    lexotic->body.frame = MVM_frame_inc_ref(tc, tc->cur_frame);
+    lexotic->body.frame = MVM_frame_inc_ref(tc, MVM_frame_share(tc, tc->cur_frame));
 
     return (MVMObject *)lexotic;
 }
@@ -560,6 +560,9 @@ MVM_NO_RETURN
 void MVM_exception_throw_adhoc_va(MVMThreadContext *tc, const char *messageFormat, va_list args) {
     LocatedHandler lh;
 
+    /* If we're throwing out of deserialization, give up on it. */
+    MVM_serialization_abandon_if_owner(tc);
+
     /* Create and set up an exception object. */
     MVMException *ex = (MVMException *)MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTException);
     MVMROOT(tc, ex, {
@@ -569,7 +572,7 @@ void MVM_exception_throw_adhoc_va(MVMThreadContext *tc, const char *messageForma
         free(c_message);
         MVM_ASSIGN_REF(tc, &(ex->common.header), ex->body.message, message);
         if (tc->cur_frame) {
-            ex->body.origin = MVM_frame_inc_ref(tc, tc->cur_frame);
+            ex->body.origin = MVM_frame_inc_ref(tc, MVM_frame_share(tc, tc->cur_frame));
             tc->cur_frame->throw_address = *(tc->interp_cur_op);
             tc->cur_frame->keep_caller   = 1;
         }
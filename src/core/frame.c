@@ -14,8 +14,9 @@ void prepare_and_verify_static_frame(MVMThreadContext *tc, MVMStaticFrame *stati
     static_frame_body->work_size = sizeof(MVMRegister) *
         (static_frame_body->num_locals + static_frame_body->cu->body.max_callsite_size);
 
-    /* Validate the bytecode. */
-    MVM_validate_static_frame(tc, static_frame);
+    /* Validate the bytecode, unless the bytecode cache already has. */
+    if (!MVM_bytecode_cache_prepare_frame(tc, static_frame))
+        MVM_validate_static_frame(tc, static_frame);
 
     /* Obtain an index to each threadcontext's pool table */
     static_frame_body->pool_index = MVM_incr(&tc->instance->num_frame_pools);
@@ -38,9 +39,34 @@ void prepare_and_verify_static_frame(MVMThreadContext *tc, MVMStaticFrame *stati
     static_frame_body->invoked = 1;
 }
 
+/* Most frames are only ever referenced by the thread that invoked them, from
+ * its call chain and the outers of the frames on it, so their reference
+ * counts are updated without atomic operations. A frame is shared once a
+ * reference to it is stored somewhere another thread may get at it: in a
+ * heap object (a closure, context, exception, lexotic or continuation), or
+ * when starting a thread. From then on its count is updated atomically.
+ * Whoever releases a shared frame releases its caller and outer, so those
+ * are shared too. An unshared frame can only be reached by the thread that
+ * invoked it, so only that thread ever shares it. Returns the frame, for
+ * convenience. */
+MVMFrame * MVM_frame_share(MVMThreadContext *tc, MVMFrame *frame) {
+    MVMFrame *cur = frame;
+    while (cur && !cur->shared) {
+        cur->shared = 1;
+        if (cur->outer)
+            MVM_frame_share(tc, cur->outer);
+        cur = cur->caller;
+    }
+    MVM_barrier();
+    return frame;
+}
+
 /* Increases the reference count of a frame. */
 MVMFrame * MVM_frame_inc_ref(MVMThreadContext *tc, MVMFrame *frame) {
-    MVM_incr(&frame->ref_count);
+    if (frame->shared)
+        MVM_incr(&frame->ref_count);
+    else
+        frame->ref_count++;
     return frame;
 }
 
@@ -49,7 +75,7 @@ MVMFrame * MVM_frame_inc_ref(MVMThreadContext *tc, MVMFrame *frame) {
 MVMFrame * MVM_frame_dec_ref(MVMThreadContext *tc, MVMFrame *frame) {
     /* MVM_dec returns what the count was before it decremented it
      * to zero, so we look for 1 here. */
-    while (MVM_decr(&frame->ref_count) == 1) {
+    while ((frame->shared ? MVM_decr(&frame->ref_count) : frame->ref_count--) == 1) {
         MVMuint32 pool_index = frame->static_info->body.pool_index;
         MVMFrame *node = tc->frame_pool_table[pool_index];
         MVMFrame *outer_to_decr = frame->outer;
@@ -58,17 +84,25 @@ MVMFrame * MVM_frame_dec_ref(MVMThreadContext *tc, MVMFrame *frame) {
         if (frame->caller)
             frame->caller = MVM_frame_dec_ref(tc, frame->caller);
 
+        /* Release the lexicals and work area, which are on the call stack
+         * if the frame never returned (as for frames in a continuation),
+         * and otherwise on the heap, if anywhere. */
+        if (frame->callstack_block) {
+            MVM_callstack_free(tc, frame->callstack_block);
+            frame->callstack_block = NULL;
+        }
+        else {
+            MVM_checked_free_null(frame->env);
+            MVM_checked_free_null(frame->work);
+        }
+        frame->env  = NULL;
+        frame->work = NULL;
+        frame->args = NULL;
+
         if (node && MVM_load(&node->ref_count) >= MVMFramePoolLengthLimit) {
             /* There's no room on the free list, so destruction.*/
-            if (frame->env) {
-                free(frame->env);
-                frame->env = NULL;
-            }
-            if (frame->work) {
+            if (frame->params.callsite)
                 MVM_args_proc_cleanup(tc, &frame->params);
-                free(frame->work);
-                frame->work = NULL;
-            }
             free(frame);
         }
         else { /* Unshift it to the free list */
@@ -123,7 +157,6 @@ void MVM_frame_invoke(MVMThreadContext *tc, MVMStaticFrame *static_frame,
 
     MVMuint32 pool_index;
     MVMFrame *node;
-    int fresh = 0;
     MVMStaticFrameBody *static_frame_body = &static_frame->body;
 
     /* If the frame was never invoked before, need initial calculations
@@ -131,11 +164,16 @@ void MVM_frame_invoke(MVMThreadContext *tc, MVMStaticFrame *static_frame,
     if (!static_frame_body->invoked)
         prepare_and_verify_static_frame(tc, static_frame);
 
+    /* Count the invocation; once the frame gets hot, it is time to log
+     * types in it and later to specialize it. */
+    if (static_frame_body->spesh_state != MVM_SPESH_STATE_DONE &&
+            ++static_frame_body->spesh_invocations >= MVM_SPESH_LOG_THRESHOLD)
+        MVM_spesh_check(tc, static_frame);
+
     pool_index = static_frame_body->pool_index;
     node = tc->frame_pool_table[pool_index];
 
     if (node == NULL) {
-        fresh = 1;
         frame = malloc(sizeof(MVMFrame));
         frame->params.named_used = NULL;
 
@@ -168,28 +206,43 @@ void MVM_frame_invoke(MVMThreadContext *tc, MVMStaticFrame *static_frame,
     /* Copy thread context (back?) into the frame. */
     frame->tc = tc;
 
-    /* Set static frame. */
+    /* Set static frame, and pick the bytecode to run; a hot frame may have
+     * a specialized version, or one that enters JIT-compiled code. */
     frame->static_info = static_frame;
+    {
+        MVMJitCode *jit_code = static_frame_body->jit_code;
+        frame->effective_bytecode = jit_code ? jit_code->bytecode :
+            static_frame_body->spesh_bytecode ? static_frame_body->spesh_bytecode :
+            static_frame_body->bytecode;
+    }
 
     /* Store the code ref (NULL at the top-level). */
     frame->code_ref = code_ref;
 
-    /* Allocate space for lexicals and work area, copying the default lexical
-     * environment into place. */
-    if (static_frame_body->env_size) {
-        if (fresh)
-            frame->env = malloc(static_frame_body->env_size);
-        memcpy(frame->env, static_frame_body->static_env, static_frame_body->env_size);
-    }
-    else {
-        frame->env = NULL;
-    }
-    if (static_frame_body->work_size) {
-        if (fresh || !frame->work)
-            frame->work = malloc(static_frame_body->work_size);
-        memset(frame->work, 0, static_frame_body->work_size);
+    /* Allocate space for lexicals and work area together on the call stack,
+     * copying the default lexical environment into place. */
+    if (static_frame_body->env_size || static_frame_body->work_size) {
+        char *block = MVM_callstack_alloc(tc,
+            static_frame_body->env_size + static_frame_body->work_size);
+        frame->callstack_block = block;
+        if (static_frame_body->env_size) {
+            frame->env = (MVMRegister *)block;
+            memcpy(frame->env, static_frame_body->static_env, static_frame_body->env_size);
+        }
+        else {
+            frame->env = NULL;
+        }
+        if (static_frame_body->work_size) {
+            frame->work = (MVMRegister *)(block + static_frame_body->env_size);
+            memset(frame->work, 0, static_frame_body->work_size);
+        }
+        else {
+            frame->work = NULL;
+        }
     }
     else {
+        frame->callstack_block = NULL;
+        frame->env  = NULL;
         frame->work = NULL;
     }
 
@@ -226,7 +279,8 @@ void MVM_frame_invoke(MVMThreadContext *tc, MVMStaticFrame *static_frame,
     else if (static_frame_body->outer) {
         /* Auto-close, and cache it in the static frame. */
         frame->outer = autoclose(tc, static_frame_body->outer);
-        static_frame_body->static_code->body.outer = MVM_frame_inc_ref(tc, frame->outer);
+        static_frame_body->static_code->body.outer = MVM_frame_inc_ref(tc,
+            MVM_frame_share(tc, frame->outer));
     }
     else {
         frame->outer = NULL;
@@ -241,14 +295,17 @@ void MVM_frame_invoke(MVMThreadContext *tc, MVMStaticFrame *static_frame,
         frame->caller = NULL;
     frame->keep_caller = 0;
     frame->in_continuation = 0;
+    frame->shared = 0;
 
     /* Initial reference count is 1 by virtue of it being the currently
      * executing frame. */
-    MVM_store(&frame->ref_count, 1);
+    frame->ref_count = 1;
     MVM_store(&frame->gc_seq_number, 0);
 
     /* Initialize argument processing. */
     MVM_args_proc_init(tc, &frame->params, callsite, args);
+    if (callsite->arg_count > callsite->num_pos && !callsite->has_flattening)
+        MVM_args_pick_plan(tc, &frame->params, static_frame);
     
     /* Make sure there's no frame context pointer and special return data
      * won't be marked. */
@@ -261,8 +318,8 @@ void MVM_frame_invoke(MVMThreadContext *tc, MVMStaticFrame *static_frame,
     /* Update interpreter and thread context, so next execution will use this
      * frame. */
     tc->cur_frame = frame;
-    *(tc->interp_cur_op) = static_frame_body->bytecode;
-    *(tc->interp_bytecode_start) = static_frame_body->bytecode;
+    *(tc->interp_cur_op) = frame->effective_bytecode;
+    *(tc->interp_bytecode_start) = frame->effective_bytecode;
     *(tc->interp_reg_base) = frame->work;
     *(tc->interp_cu) = static_frame_body->cu;
 
@@ -343,6 +400,7 @@ MVMFrame * MVM_frame_create_context_only(MVMThreadContext *tc, MVMStaticFrame *s
 
     /* Set static frame. */
     frame->static_info = static_frame;
+    frame->effective_bytecode = static_frame->body.bytecode;
 
     /* Store the code ref. */
     frame->code_ref = code_ref;
@@ -359,12 +417,37 @@ MVMFrame * MVM_frame_create_context_only(MVMThreadContext *tc, MVMStaticFrame *s
     return frame;
 }
 
+/* Called as a frame returns, to release the block on the call stack that
+ * its lexicals and work area live in. If anything besides the call stack
+ * holds a reference to the frame, its lexicals may yet be looked at, so
+ * are first moved to the heap. */
+static void leave_callstack(MVMThreadContext *tc, MVMFrame *frame) {
+    if (frame->env && MVM_load(&frame->ref_count) > 1) {
+        MVMuint32    env_size = frame->static_info->body.env_size;
+        MVMRegister *env      = malloc(env_size);
+        memcpy(env, frame->env, env_size);
+        frame->env = env;
+    }
+    else {
+        frame->env = NULL;
+    }
+    frame->work = NULL;
+    frame->args = NULL;
+    MVM_callstack_free(tc, frame->callstack_block);
+    frame->callstack_block = NULL;
+}
+
 /* Removes a single frame, as part of a return or unwind. Done after any exit
  * handler has already been run. */
 static MVMuint64 remove_one_frame(MVMThreadContext *tc, MVMuint8 unwind) {
     MVMFrame *returner = tc->cur_frame;
     MVMFrame *caller   = returner->caller;
 
+    /* Dynamic variable lookups cached as starting from this frame no longer
+     * hold. */
+    if (returner->flags & MVM_FRAME_FLAG_DYNLEX_CACHED)
+        MVM_frame_dynlex_cache_clear(tc, returner);
+
     /* Some cleanup we only need do if we're not a frame involved in a
      * continuation (otherwise we need to allow for multi-shot
      * re-invocation). */
@@ -391,6 +474,11 @@ static MVMuint64 remove_one_frame(MVMThreadContext *tc, MVMuint8 unwind) {
         /* Signal to the GC to ignore ->work */
         returner->tc = NULL;
 
+        /* Release the lexicals and work area from the call stack. (Those of
+         * a frame in a continuation stay, as it may be resumed.) */
+        if (returner->callstack_block)
+            leave_callstack(tc, returner);
+
         /* Unless we need to keep the caller chain in place, clear it up. */
         if (caller) {
             if (!returner->keep_caller) {
@@ -417,7 +505,7 @@ static MVMuint64 remove_one_frame(MVMThreadContext *tc, MVMuint8 unwind) {
     if (caller && returner != tc->thread_entry_frame) {
         tc->cur_frame = caller;
         *(tc->interp_cur_op) = caller->return_address;
-        *(tc->interp_bytecode_start) = caller->static_info->body.bytecode;
+        *(tc->interp_bytecode_start) = caller->effective_bytecode;
         *(tc->interp_reg_base) = caller->work;
         *(tc->interp_cu) = caller->static_info->body.cu;
 
@@ -572,7 +660,7 @@ void MVM_frame_capturelex(MVMThreadContext *tc, MVMObject *code) {
     code_obj = (MVMCode *)code;
     if (code_obj->body.outer)
         MVM_frame_dec_ref(tc, code_obj->body.outer);
-    code_obj->body.outer = MVM_frame_inc_ref(tc, tc->cur_frame);
+    code_obj->body.outer = MVM_frame_inc_ref(tc, MVM_frame_share(tc, tc->cur_frame));
 }
 
 /* Given the specified code object, copies it and returns a copy which
@@ -590,7 +678,7 @@ MVMObject * MVM_frame_takeclosure(MVMThreadContext *tc, MVMObject *code) {
 
     MVM_ASSIGN_REF(tc, &(closure->common.header), closure->body.sf, ((MVMCode *)code)->body.sf);
     MVM_ASSIGN_REF(tc, &(closure->common.header), closure->body.name, ((MVMCode *)code)->body.name);
-    closure->body.outer = MVM_frame_inc_ref(tc, tc->cur_frame);
+    closure->body.outer = MVM_frame_inc_ref(tc, MVM_frame_share(tc, tc->cur_frame));
     MVM_ASSIGN_REF(tc, &(closure->common.header), closure->body.code_object, ((MVMCode *)code)->body.code_object);
 
     return (MVMObject *)closure;
@@ -628,6 +716,115 @@ MVMRegister * MVM_frame_find_lexical_by_name(MVMThreadContext *tc, MVMString *na
         MVM_string_utf8_encode_C_string(tc, name));
 }
 
+/* Remembers in a static frame where a lookup of the lexical with the name at
+ * the given string heap index found it. Takes a free entry if there is one;
+ * otherwise one from an earlier epoch, which is of no more use; otherwise
+ * the entries are replaced in turn. If another thread is writing the entry
+ * picked, we just don't cache this time. */
+static void lexical_cache_add(MVMThreadContext *tc, MVMStaticFrame *sf, MVMuint32 name_idx,
+        MVMuint32 epoch, MVMuint16 depth, MVMuint16 index, MVMStaticFrame *target) {
+    MVMStaticFrameBody   *body = &sf->body;
+    MVMLexicalCacheEntry *entry = NULL;
+    MVMuint32             n, i;
+    AO_t                  version;
+
+    if (!body->lexical_cache) {
+        MVMLexicalCacheEntry *cache = calloc(MVM_LEXICAL_CACHE_SIZE, sizeof(MVMLexicalCacheEntry));
+        if (MVM_casptr(&body->lexical_cache, NULL, cache) != NULL)
+            free(cache);
+    }
+
+    n = (MVMuint32)MVM_load(&body->lexical_cache_entries);
+    if (n < MVM_LEXICAL_CACHE_SIZE) {
+        if (MVM_trycas(&body->lexical_cache_entries, n, n + 1))
+            entry = &body->lexical_cache[n];
+    }
+    else {
+        for (i = 0; i < n && !entry; i++)
+            if (body->lexical_cache[i].epoch != epoch)
+                entry = &body->lexical_cache[i];
+        if (!entry)
+            entry = &body->lexical_cache[MVM_incr(&body->lexical_cache_next) % MVM_LEXICAL_CACHE_SIZE];
+    }
+    if (!entry)
+        return;
+
+    version = MVM_load(&entry->version);
+    if ((version & 1) || !MVM_trycas(&entry->version, version, version + 1))
+        return;
+    entry->name_idx = name_idx;
+    entry->epoch    = epoch;
+    entry->depth    = depth;
+    entry->index    = index;
+    MVM_ASSIGN_REF(tc, &(sf->common.header), entry->target, target);
+    MVM_store(&entry->version, version + 2);
+}
+
+/* Looks up the address of the lexical with the name at the specified index
+ * in the current compilation unit's string heap, and the specified type, as
+ * MVM_frame_find_lexical_by_name does. Where it was found is cached in the
+ * current static frame, so next time we can go straight there. */
+MVMRegister * MVM_frame_find_lexical_by_name_cached(MVMThreadContext *tc, MVMuint32 name_idx, MVMuint16 type) {
+    MVMFrame       *cur_frame = tc->cur_frame;
+    MVMStaticFrame *sf        = cur_frame->static_info;
+    MVMuint32       epoch     = (MVMuint32)MVM_load(&tc->instance->lexical_cache_epoch);
+    MVMString      *name;
+    MVMuint16       depth     = 0;
+
+    /* Try the cache. The static frames of the outer chain follow from that
+     * of the current frame, so checking the one the lexical was found in
+     * is enough. */
+    if (sf->body.lexical_cache) {
+        MVMuint32 i, n = (MVMuint32)MVM_load(&sf->body.lexical_cache_entries);
+        for (i = 0; i < n; i++) {
+            MVMLexicalCacheEntry *entry   = &sf->body.lexical_cache[i];
+            AO_t                  version = MVM_load(&entry->version);
+            MVMStaticFrame       *target  = entry->target;
+            MVMuint16             d       = entry->depth;
+            MVMuint16             index   = entry->index;
+            if (target && entry->name_idx == name_idx && entry->epoch == epoch
+                    && !(version & 1) && MVM_load(&entry->version) == version) {
+                MVMFrame *found = cur_frame;
+                while (d-- && found)
+                    found = found->outer;
+                if (found && found->static_info == target &&
+                        target->body.lexical_types[index] == type)
+                    return &found->env[index];
+            }
+        }
+    }
+
+    /* Otherwise, look it up and cache where we found it. */
+    name = MVM_cu_string(tc, sf->body.cu, name_idx);
+    MVM_string_flatten(tc, name);
+    while (cur_frame != NULL) {
+        MVMLexicalRegistry *lexical_names = cur_frame->static_info->body.lexical_names;
+        if (lexical_names) {
+            MVMLexicalRegistry *entry;
+
+            MVM_HASH_GET(tc, lexical_names, name, entry)
+
+            if (entry) {
+                if (cur_frame->static_info->body.lexical_types[entry->value] == type) {
+                    lexical_cache_add(tc, sf, name_idx, epoch, depth, entry->value,
+                        cur_frame->static_info);
+                    return &cur_frame->env[entry->value];
+                }
+                else
+                   MVM_exception_throw_adhoc(tc,
+                        "Lexical with name '%s' has wrong type",
+                            MVM_string_utf8_encode_C_string(tc, name));
+            }
+        }
+        cur_frame = cur_frame->outer;
+        depth++;
+    }
+    if (type == MVM_reg_obj)
+        return NULL;
+    MVM_exception_throw_adhoc(tc, "No lexical found with name '%s'",
+        MVM_string_utf8_encode_C_string(tc, name));
+}
+
 /* Looks up the address of the lexical with the specified name, starting with
  * the specified frame. Only works if it's an object lexical.  */
 MVMRegister * MVM_frame_find_lexical_by_name_rel(MVMThreadContext *tc, MVMString *name, MVMFrame *cur_frame) {
@@ -684,12 +881,45 @@ MVMRegister * MVM_frame_find_lexical_by_name_rel_caller(MVMThreadContext *tc, MV
     return NULL;
 }
 
+/* Drops the thread's cached dynamic variable lookups that started from the
+ * specified frame, or all of them if it is null. */
+void MVM_frame_dynlex_cache_clear(MVMThreadContext *tc, MVMFrame *frame) {
+    MVMuint32 i;
+    for (i = 0; i < MVM_DYNLEX_CACHE_SIZE; i++) {
+        MVMDynlexCacheEntry *entry = &tc->dynlex_cache[i];
+        if (!frame || entry->start == frame) {
+            entry->name  = NULL;
+            entry->start = NULL;
+            entry->reg   = NULL;
+        }
+    }
+}
+
 /* Looks up the address of the lexical with the specified name and the
  * specified type. Returns null if it does not exist. */
 MVMRegister * MVM_frame_find_contextual_by_name(MVMThreadContext *tc, MVMString *name, MVMuint16 *type, MVMFrame *cur_frame) {
+    MVMFrame *start = cur_frame;
+    MVMuint8  cache;
+    MVMuint32 i;
+
     if (!name) {
         MVM_exception_throw_adhoc(tc, "Contextual name cannot be null");
     }
+
+    /* Lookups starting from the caller of the current frame, as getdynlex
+     * and binddynlex do, are cached in the thread until that frame returns
+     * or is unwound. */
+    cache = start && tc->cur_frame && start == tc->cur_frame->caller;
+    if (cache) {
+        for (i = 0; i < MVM_DYNLEX_CACHE_SIZE; i++) {
+            MVMDynlexCacheEntry *entry = &tc->dynlex_cache[i];
+            if (entry->start == start && entry->name == name) {
+                *type = entry->type;
+                return entry->reg;
+            }
+        }
+    }
+
     MVM_string_flatten(tc, name);
     while (cur_frame != NULL) {
         MVMLexicalRegistry *lexical_names = cur_frame->static_info->body.lexical_names;
@@ -700,6 +930,15 @@ MVMRegister * MVM_frame_find_contextual_by_name(MVMThreadContext *tc, MVMString
 
             if (entry) {
                 *type = cur_frame->static_info->body.lexical_types[entry->value];
+                if (cache) {
+                    MVMDynlexCacheEntry *cached = &tc->dynlex_cache[tc->dynlex_cache_next];
+                    tc->dynlex_cache_next = (tc->dynlex_cache_next + 1) % MVM_DYNLEX_CACHE_SIZE;
+                    cached->name  = name;
+                    cached->start = start;
+                    cached->reg   = &cur_frame->env[entry->value];
+                    cached->type  = *type;
+                    start->flags |= MVM_FRAME_FLAG_DYNLEX_CACHED;
+                }
                 return &cur_frame->env[entry->value];
             }
         }
@@ -899,7 +1138,7 @@ MVMObject * MVM_frame_context_wrapper(MVMThreadContext *tc, MVMFrame *f) {
 
     if (!ctx) {
         ctx = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTContext);
-        ((MVMContext *)ctx)->body.context = MVM_frame_inc_ref(tc, f);
+        ((MVMContext *)ctx)->body.context = MVM_frame_inc_ref(tc, MVM_frame_share(tc, f));
 
         if (MVM_casptr(&f->context_object, NULL, ctx) != NULL) {
             ((MVMContext *)ctx)->body.context = MVM_frame_dec_ref(tc, f);
@@ -918,7 +1157,8 @@ MVMFrame * MVM_frame_clone(MVMThreadContext *tc, MVMFrame *f) {
     MVMFrame *clone = malloc(sizeof(MVMFrame));
     memcpy(clone, f, sizeof(MVMFrame));
 
-    /* Need fresh env and work. */
+    /* Need fresh env and work, which live on the heap. */
+    clone->callstack_block = NULL;
     if (f->static_info->body.env_size) {
         clone->env = malloc(f->static_info->body.env_size);
         memcpy(clone->env, f->env, f->static_info->body.env_size);
@@ -929,8 +1169,10 @@ MVMFrame * MVM_frame_clone(MVMThreadContext *tc, MVMFrame *f) {
         clone->args = clone->work + f->static_info->body.num_locals;
     }
 
-    /* Ref-count of the clone is 1. */
+    /* Ref-count of the clone is 1. Like the frame it was cloned from, it is
+     * part of a continuation, and so shared. */
     clone->ref_count = 1;
+    clone->shared    = 1;
 
     /* If there's an outer, there's now an extra frame pointing at it. */
     if (clone->outer)
@@ -1,11 +1,32 @@
 /* Frame flags; provide some HLLs can alias. */
 #define MVM_FRAME_FLAG_STATE_INIT       1 << 0
 #define MVM_FRAME_FLAG_EXIT_HAND_RUN    1 << 1
+#define MVM_FRAME_FLAG_DYNLEX_CACHED    1 << 2
 #define MVM_FRAME_FLAG_HLL_1            1 << 3
 #define MVM_FRAME_FLAG_HLL_2            1 << 4
 #define MVM_FRAME_FLAG_HLL_3            1 << 5
 #define MVM_FRAME_FLAG_HLL_4            1 << 6
 
+/* Number of name-based lexical lookups starting in a static frame that it
+ * remembers the results of. */
+#define MVM_LEXICAL_CACHE_SIZE 8
+
+/* Where a name-based lexical lookup starting in a static frame found the
+ * lexical: the index of the lexical in the frame that many outers out, whose
+ * static frame the entry also records. Entries are only used while the
+ * lexical cache epoch of the instance is what it was at the time. They may
+ * be overwritten while other threads read them, so the version is made odd
+ * while an entry is written and even again after; readers only trust what
+ * they read if it was even and unchanged throughout. */
+struct MVMLexicalCacheEntry {
+    AO_t            version;
+    MVMStaticFrame *target;
+    MVMuint32       name_idx;
+    MVMuint32       epoch;
+    MVMuint16       depth;
+    MVMuint16       index;
+};
+
 /* Lexical hash entry for ->lexical_names on a frame. */
 struct MVMLexicalRegistry {
     /* key string */
@@ -57,6 +78,10 @@ struct MVMFrame {
      * decrease number of allocations. */
     MVMRegister *args;
 
+    /* The block on the thread's call stack that env and work live in, if
+     * they do; otherwise they are on the heap. */
+    void *callstack_block;
+
     /* Callsite that indicates how the current args buffer is being used, if
      * it is. */
     MVMCallsite *cur_args_callsite;
@@ -71,13 +96,18 @@ struct MVMFrame {
      * this kind of frame, including information needed to GC-trace it. */
     MVMStaticFrame *static_info;
 
+    /* The bytecode this frame is running; either that of the static frame
+     * or a specialized version of it, which has the same layout. */
+    MVMuint8 *effective_bytecode;
+
     /* The code ref object for this frame. */
     MVMObject *code_ref;
 
     /* Parameters received by this frame. */
     MVMArgProcContext params;
 
-    /* Reference count for the frame. */
+    /* Reference count for the frame. Only updated atomically once the
+     * frame is shared. */
     AO_t ref_count;
 
     /* Address of the next op to execute if we return to this frame. */
@@ -126,6 +156,10 @@ struct MVMFrame {
      * such we should keep everything in place for multiple invocations. */
     MVMuint8 in_continuation;
 
+    /* Flags that the frame may be referenced from other threads; see
+     * MVM_frame_share. */
+    MVMuint8 shared;
+
     /* Assorted frame flags. */
     MVMuint8 flags;
 
@@ -167,15 +201,18 @@ MVMFrame * MVM_frame_create_context_only(MVMThreadContext *tc, MVMStaticFrame *s
 MVM_PUBLIC MVMuint64 MVM_frame_try_return(MVMThreadContext *tc);
 void MVM_frame_unwind_to(MVMThreadContext *tc, MVMFrame *frame, MVMuint8 *abs_addr,
                          MVMuint32 rel_addr, MVMObject *return_value);
+MVM_PUBLIC MVMFrame * MVM_frame_share(MVMThreadContext *tc, MVMFrame *frame);
 MVM_PUBLIC MVMFrame * MVM_frame_inc_ref(MVMThreadContext *tc, MVMFrame *frame);
 MVM_PUBLIC MVMFrame * MVM_frame_dec_ref(MVMThreadContext *tc, MVMFrame *frame);
 MVM_PUBLIC void MVM_frame_capturelex(MVMThreadContext *tc, MVMObject *code);
 MVM_PUBLIC MVMObject * MVM_frame_takeclosure(MVMThreadContext *tc, MVMObject *code);
 MVM_PUBLIC MVMRegister * MVM_frame_find_lexical_by_name(MVMThreadContext *tc, MVMString *name, MVMuint16 type);
+MVMRegister * MVM_frame_find_lexical_by_name_cached(MVMThreadContext *tc, MVMuint32 name_idx, MVMuint16 type);
 MVM_PUBLIC MVMRegister * MVM_frame_find_lexical_by_name_rel(MVMThreadContext *tc, MVMString *name, MVMFrame *cur_frame);
 MVM_PUBLIC MVMRegister * MVM_frame_find_lexical_by_name_rel_caller(MVMThreadContext *tc, MVMString *name, MVMFrame *cur_caller_frame);
 MVM_PUBLIC MVMRegister * MVM_frame_find_contextual_by_name(MVMThreadContext *tc, MVMString *name, MVMuint16 *type, MVMFrame *cur_frame);
 MVMObject * MVM_frame_getdynlex(MVMThreadContext *tc, MVMString *name, MVMFrame *cur_frame);
+void MVM_frame_dynlex_cache_clear(MVMThreadContext *tc, MVMFrame *frame);
 void MVM_frame_binddynlex(MVMThreadContext *tc, MVMString *name, MVMObject *value, MVMFrame *cur_frame);
 MVMRegister * MVM_frame_lexical(MVMThreadContext *tc, MVMFrame *f, MVMString *name);
 MVM_PUBLIC MVMRegister * MVM_frame_try_get_lexical(MVMThreadContext *tc, MVMFrame *f, MVMString *name, MVMuint16 type);
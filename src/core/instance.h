@@ -122,6 +122,13 @@ struct MVMInstance {
     MVMCollectable     ***permroots;
     uv_mutex_t            mutex_permroots;
 
+    /* The size each thread's nursery starts out at, whether it is then
+     * sized to suit the thread, and how many collections there are per
+     * full collection. */
+    MVMuint32 nursery_size;
+    MVMuint32 nursery_adaptive;
+    MVMuint32 gc_gen2_ratio;
+
     /* The current GC run sequence number. May wrap around over time; that
      * is fine since only equality ever matters. */
     AO_t gc_seq_number;
@@ -131,6 +138,16 @@ struct MVMInstance {
     AO_t gc_finish;
     /* The number of threads that have yet to acknowledge the finish. */
     AO_t gc_ack;
+    /* Memory to free once every thread has reached a safe point (see
+     * MVM_gc_free_at_safepoint). */
+    AO_t gc_safepoint_free;
+    /* Steal stacks for sharing marking work between the threads taking
+     * part in a full collection; how many are allocated, how many are in
+     * use this run and the next one to be handed out. */
+    MVMGCStealStack **gc_steal_stacks;
+    MVMuint32         gc_steal_alloc;
+    MVMuint32         gc_steal_count;
+    AO_t              gc_steal_next;
     /* Linked list (via forwarder) of STables to free. */
     MVMSTable *stables_to_free;
 
@@ -166,6 +183,10 @@ struct MVMInstance {
      * so each can obtain an index into each threadcontext's pool table */
     AO_t num_frame_pools;
 
+    /* Bumped whenever a static frame's outer is changed, so as to stop the
+     * lexical lookup caches of static frames being used. */
+    AO_t lexical_cache_epoch;
+
     /* Hash of compiler objects keyed by name */
     MVMObject          *compiler_registry;
     uv_mutex_t    mutex_compiler_registry;
@@ -194,10 +215,28 @@ struct MVMInstance {
     MVMSerializationContextBody *sc_weakhash;
     uv_mutex_t                   mutex_sc_weakhash;
 
+    /* Deserialization is done under this lock, which the thread holding it
+     * (if any) may take again; the depth counts how many times it has. The
+     * allocation target the holder had before taking it is put back when it
+     * is released. */
+    uv_mutex_t          mutex_deserialize;
+    AO_t                deserialize_owner;
+    MVMuint32           deserialize_depth;
+    MVMAllocationTarget deserialize_allocate_in;
+
     /* Hash of filenames of compunits loaded from disk. */
     MVMLoadedCompUnitName *loaded_compunits;
     uv_mutex_t       mutex_loaded_compunits;
 
+    /* Directory bytecode caches are kept in (NULL if there isn't one), and
+     * the caches of the compilation units loaded so far. */
+    char *bytecode_cache_dir;
+    AO_t  bytecode_caches;
+
+    /* The event loop asynchronous I/O runs on; started when first needed. */
+    MVMEventLoop *event_loop;
+    uv_mutex_t    mutex_event_loop;
+
     MVMObject *stdin_handle;
     MVMObject *stdout_handle;
     MVMObject *stderr_handle;
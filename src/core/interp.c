@@ -13,6 +13,7 @@
 #define GET_UI64(pc, idx)   *((MVMuint64 *)(pc + idx))
 #define GET_N32(pc, idx)    *((MVMnum32 *)(pc + idx))
 #define GET_N64(pc, idx)    *((MVMnum64 *)(pc + idx))
+#define GET_SPESH_SITE(idx) (&tc->cur_frame->static_info->body.spesh_sites[idx])
 
 #define NEXT_OP (op = *(MVMuint16 *)(cur_op), cur_op += 2, op)
 
@@ -211,50 +212,50 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                 goto NEXT;
             }
             OP(getlex_ni):
-                GET_REG(cur_op, 0).i64 = MVM_frame_find_lexical_by_name(tc,
-                    cu->body.strings[GET_UI32(cur_op, 2)], MVM_reg_int64)->i64;
+                GET_REG(cur_op, 0).i64 = MVM_frame_find_lexical_by_name_cached(tc,
+                    GET_UI32(cur_op, 2), MVM_reg_int64)->i64;
                 cur_op += 6;
                 goto NEXT;
             OP(getlex_nn):
-                GET_REG(cur_op, 0).n64 = MVM_frame_find_lexical_by_name(tc,
-                    cu->body.strings[GET_UI32(cur_op, 2)], MVM_reg_num64)->n64;
+                GET_REG(cur_op, 0).n64 = MVM_frame_find_lexical_by_name_cached(tc,
+                    GET_UI32(cur_op, 2), MVM_reg_num64)->n64;
                 cur_op += 6;
                 goto NEXT;
             OP(getlex_ns):
-                GET_REG(cur_op, 0).s = MVM_frame_find_lexical_by_name(tc,
-                    cu->body.strings[GET_UI32(cur_op, 2)], MVM_reg_str)->s;
+                GET_REG(cur_op, 0).s = MVM_frame_find_lexical_by_name_cached(tc,
+                    GET_UI32(cur_op, 2), MVM_reg_str)->s;
                 cur_op += 6;
                 goto NEXT;
             OP(getlex_no): {
-                MVMRegister *found = MVM_frame_find_lexical_by_name(tc,
-                    cu->body.strings[GET_UI32(cur_op, 2)], MVM_reg_obj);
+                MVMRegister *found = MVM_frame_find_lexical_by_name_cached(tc,
+                    GET_UI32(cur_op, 2), MVM_reg_obj);
                 GET_REG(cur_op, 0).o = found ? found->o : NULL;
                 cur_op += 6;
                 goto NEXT;
             }
             OP(bindlex_ni):
-                MVM_frame_find_lexical_by_name(tc, cu->body.strings[GET_UI32(cur_op, 0)],
+                MVM_frame_find_lexical_by_name_cached(tc, GET_UI32(cur_op, 0),
                     MVM_reg_int64)->i64 = GET_REG(cur_op, 4).i64;
                 cur_op += 6;
                 goto NEXT;
             OP(bindlex_nn):
-                MVM_frame_find_lexical_by_name(tc, cu->body.strings[GET_UI32(cur_op, 0)],
+                MVM_frame_find_lexical_by_name_cached(tc, GET_UI32(cur_op, 0),
                     MVM_reg_num64)->n64 = GET_REG(cur_op, 4).n64;
                 cur_op += 6;
                 goto NEXT;
             OP(bindlex_ns):
-                MVM_frame_find_lexical_by_name(tc, cu->body.strings[GET_UI32(cur_op, 0)],
+                MVM_frame_find_lexical_by_name_cached(tc, GET_UI32(cur_op, 0),
                     MVM_reg_str)->s = GET_REG(cur_op, 4).s;
                 cur_op += 6;
                 goto NEXT;
             OP(bindlex_no): {
-                MVMString *str = cu->body.strings[GET_UI32(cur_op, 0)];
-                MVMRegister *r = MVM_frame_find_lexical_by_name(tc, str, MVM_reg_obj);
+                MVMRegister *r = MVM_frame_find_lexical_by_name_cached(tc,
+                    GET_UI32(cur_op, 0), MVM_reg_obj);
                 if (r)
                     r->o = GET_REG(cur_op, 4).o;
                 else
                     MVM_exception_throw_adhoc(tc, "Cannot bind to non-existing object lexical '%s'",
-                        MVM_string_utf8_encode_C_string(tc, str));
+                        MVM_string_utf8_encode_C_string(tc, MVM_cu_string(tc, cu, GET_UI32(cur_op, 0))));
                 cur_op += 6;
                 goto NEXT;
             }
@@ -305,7 +306,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                 cur_op += 10;
                 goto NEXT;
             OP(const_s):
-                GET_REG(cur_op, 0).s = cu->body.strings[GET_UI32(cur_op, 2)];
+                GET_REG(cur_op, 0).s = MVM_cu_string(tc, cu, GET_UI32(cur_op, 2));
                 cur_op += 6;
                 goto NEXT;
             OP(add_i):
@@ -557,7 +558,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                 cur_op += 10;
                 goto NEXT;
             OP(argconst_s):
-                tc->cur_frame->args[GET_UI16(cur_op, 0)].s = cu->body.strings[GET_UI32(cur_op, 2)];
+                tc->cur_frame->args[GET_UI16(cur_op, 0)].s = MVM_cu_string(tc, cu, GET_UI32(cur_op, 2));
                 cur_op += 6;
                 goto NEXT;
             OP(checkarity):
@@ -638,28 +639,28 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
             }
             OP(param_rn_i):
                 GET_REG(cur_op, 0).i64 = MVM_args_get_named_int(tc, &tc->cur_frame->params,
-                    cu->body.strings[GET_UI32(cur_op, 2)], MVM_ARG_REQUIRED).arg.i64;
+                    MVM_cu_string(tc, cu, GET_UI32(cur_op, 2)), MVM_ARG_REQUIRED).arg.i64;
                 cur_op += 6;
                 goto NEXT;
             OP(param_rn_n):
                 GET_REG(cur_op, 0).n64 = MVM_args_get_named_num(tc, &tc->cur_frame->params,
-                    cu->body.strings[GET_UI32(cur_op, 2)], MVM_ARG_REQUIRED).arg.n64;
+                    MVM_cu_string(tc, cu, GET_UI32(cur_op, 2)), MVM_ARG_REQUIRED).arg.n64;
                 cur_op += 6;
                 goto NEXT;
             OP(param_rn_s):
                 GET_REG(cur_op, 0).s = MVM_args_get_named_str(tc, &tc->cur_frame->params,
-                    cu->body.strings[GET_UI32(cur_op, 2)], MVM_ARG_REQUIRED).arg.s;
+                    MVM_cu_string(tc, cu, GET_UI32(cur_op, 2)), MVM_ARG_REQUIRED).arg.s;
                 cur_op += 6;
                 goto NEXT;
             OP(param_rn_o):
                 GET_REG(cur_op, 0).o = MVM_args_get_named_obj(tc, &tc->cur_frame->params,
-                    cu->body.strings[GET_UI32(cur_op, 2)], MVM_ARG_REQUIRED).arg.o;
+                    MVM_cu_string(tc, cu, GET_UI32(cur_op, 2)), MVM_ARG_REQUIRED).arg.o;
                 cur_op += 6;
                 goto NEXT;
             OP(param_on_i):
             {
                 MVMArgInfo param = MVM_args_get_named_int(tc, &tc->cur_frame->params,
-                    cu->body.strings[GET_UI32(cur_op, 2)], MVM_ARG_OPTIONAL);
+                    MVM_cu_string(tc, cu, GET_UI32(cur_op, 2)), MVM_ARG_OPTIONAL);
                 if (param.exists) {
                     GET_REG(cur_op, 0).i64 = param.arg.i64;
                     cur_op = bytecode_start + GET_UI32(cur_op, 6);
@@ -672,7 +673,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
             OP(param_on_n):
             {
                 MVMArgInfo param = MVM_args_get_named_num(tc, &tc->cur_frame->params,
-                    cu->body.strings[GET_UI32(cur_op, 2)], MVM_ARG_OPTIONAL);
+                    MVM_cu_string(tc, cu, GET_UI32(cur_op, 2)), MVM_ARG_OPTIONAL);
                 if (param.exists) {
                     GET_REG(cur_op, 0).n64 = param.arg.n64;
                     cur_op = bytecode_start + GET_UI32(cur_op, 6);
@@ -685,7 +686,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
             OP(param_on_s):
             {
                 MVMArgInfo param = MVM_args_get_named_str(tc, &tc->cur_frame->params,
-                    cu->body.strings[GET_UI32(cur_op, 2)], MVM_ARG_OPTIONAL);
+                    MVM_cu_string(tc, cu, GET_UI32(cur_op, 2)), MVM_ARG_OPTIONAL);
                 if (param.exists) {
                     GET_REG(cur_op, 0).s = param.arg.s;
                     cur_op = bytecode_start + GET_UI32(cur_op, 6);
@@ -698,7 +699,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
             OP(param_on_o):
             {
                 MVMArgInfo param = MVM_args_get_named_obj(tc, &tc->cur_frame->params,
-                    cu->body.strings[GET_UI32(cur_op, 2)], MVM_ARG_OPTIONAL);
+                    MVM_cu_string(tc, cu, GET_UI32(cur_op, 2)), MVM_ARG_OPTIONAL);
                 if (param.exists) {
                     GET_REG(cur_op, 0).o = param.arg.o;
                     cur_op = bytecode_start + GET_UI32(cur_op, 6);
@@ -883,7 +884,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
             }
             OP(setlexvalue): {
                 MVMObject *code = GET_REG(cur_op, 0).o;
-                MVMString *name = cu->body.strings[GET_UI32(cur_op, 2)];
+                MVMString *name = MVM_cu_string(tc, cu, GET_UI32(cur_op, 2));
                 MVMObject *val  = GET_REG(cur_op, 6).o;
                 MVMint16   flag = GET_I16(cur_op, 8);
                 if (flag < 0 || flag > 2)
@@ -1354,7 +1355,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                 cur_op += 8;
                 goto NEXT;
             OP(graphs_s):
-                GET_REG(cur_op, 0).i64 = GET_REG(cur_op, 2).s->body.graphs;
+                GET_REG(cur_op, 0).i64 = NUM_GRAPHS(GET_REG(cur_op, 2).s);
                 cur_op += 4;
                 goto NEXT;
             OP(codes_s):
@@ -1432,7 +1433,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
             OP(indexat):
                 /* branches on *failure* to match in the constant string, to save an instruction in regexes */
                 if (MVM_string_char_at_in_string(tc, GET_REG(cur_op, 0).s,
-                        GET_REG(cur_op, 2).i64, cu->body.strings[GET_UI32(cur_op, 4)]) >= 0)
+                        GET_REG(cur_op, 2).i64, MVM_cu_string(tc, cu, GET_UI32(cur_op, 4))) >= 0)
                     cur_op += 12;
                 else
                     cur_op = bytecode_start + GET_UI32(cur_op, 8);
@@ -1441,7 +1442,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
             OP(indexnat):
                 /* branches on *failure* to match in the constant string, to save an instruction in regexes */
                 if (MVM_string_char_at_in_string(tc, GET_REG(cur_op, 0).s,
-                        GET_REG(cur_op, 2).i64, cu->body.strings[GET_UI32(cur_op, 4)]) == -1)
+                        GET_REG(cur_op, 2).i64, MVM_cu_string(tc, cu, GET_UI32(cur_op, 4))) == -1)
                     cur_op += 12;
                 else
                     cur_op = bytecode_start + GET_UI32(cur_op, 8);
@@ -1963,7 +1964,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                 /* Increment PC first, as we may make a method call. */
                 MVMRegister *res  = &GET_REG(cur_op, 0);
                 MVMObject   *obj  = GET_REG(cur_op, 2).o;
-                MVMString   *name = cu->body.strings[GET_UI32(cur_op, 4)];
+                MVMString   *name = MVM_cu_string(tc, cu, GET_UI32(cur_op, 4));
                 cur_op += 8;
                 MVM_6model_find_method(tc, obj, name, res);
                 goto NEXT;
@@ -1981,7 +1982,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                 /* Increment PC first, as we may make a method call. */
                 MVMRegister *res  = &GET_REG(cur_op, 0);
                 MVMObject   *obj  = GET_REG(cur_op, 2).o;
-                MVMString   *name = cu->body.strings[GET_UI32(cur_op, 4)];
+                MVMString   *name = MVM_cu_string(tc, cu, GET_UI32(cur_op, 4));
                 cur_op += 8;
                 MVM_6model_can_method(tc, obj, name, res);
                 goto NEXT;
@@ -2398,7 +2399,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                     MVM_exception_throw_adhoc(tc, "Cannot bind attributes in a type object");
                 REPR(obj)->attr_funcs.bind_attribute(tc,
                     STABLE(obj), obj, OBJECT_BODY(obj),
-                    GET_REG(cur_op, 2).o, cu->body.strings[GET_UI32(cur_op, 4)],
+                    GET_REG(cur_op, 2).o, MVM_cu_string(tc, cu, GET_UI32(cur_op, 4)),
                     GET_I16(cur_op, 10), GET_REG(cur_op, 8), MVM_reg_int64);
                 MVM_SC_WB_OBJ(tc, obj);
                 cur_op += 12;
@@ -2410,7 +2411,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                     MVM_exception_throw_adhoc(tc, "Cannot bind attributes in a type object");
                 REPR(obj)->attr_funcs.bind_attribute(tc,
                     STABLE(obj), obj, OBJECT_BODY(obj),
-                    GET_REG(cur_op, 2).o, cu->body.strings[GET_UI32(cur_op, 4)],
+                    GET_REG(cur_op, 2).o, MVM_cu_string(tc, cu, GET_UI32(cur_op, 4)),
                     GET_I16(cur_op, 10), GET_REG(cur_op, 8), MVM_reg_num64);
                 MVM_SC_WB_OBJ(tc, obj);
                 cur_op += 12;
@@ -2422,7 +2423,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                     MVM_exception_throw_adhoc(tc, "Cannot bind attributes in a type object");
                 REPR(obj)->attr_funcs.bind_attribute(tc,
                     STABLE(obj), obj, OBJECT_BODY(obj),
-                    GET_REG(cur_op, 2).o, cu->body.strings[GET_UI32(cur_op, 4)],
+                    GET_REG(cur_op, 2).o, MVM_cu_string(tc, cu, GET_UI32(cur_op, 4)),
                     GET_I16(cur_op, 10), GET_REG(cur_op, 8), MVM_reg_str);
                 MVM_SC_WB_OBJ(tc, obj);
                 cur_op += 12;
@@ -2434,7 +2435,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                     MVM_exception_throw_adhoc(tc, "Cannot bind attributes in a type object");
                 REPR(obj)->attr_funcs.bind_attribute(tc,
                     STABLE(obj), obj, OBJECT_BODY(obj),
-                    GET_REG(cur_op, 2).o, cu->body.strings[GET_UI32(cur_op, 4)],
+                    GET_REG(cur_op, 2).o, MVM_cu_string(tc, cu, GET_UI32(cur_op, 4)),
                     GET_I16(cur_op, 10), GET_REG(cur_op, 8), MVM_reg_obj);
                 MVM_SC_WB_OBJ(tc, obj);
                 cur_op += 12;
@@ -2494,7 +2495,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                     MVM_exception_throw_adhoc(tc, "Cannot look up attributes in a type object");
                 REPR(obj)->attr_funcs.get_attribute(tc,
                     STABLE(obj), obj, OBJECT_BODY(obj),
-                    GET_REG(cur_op, 4).o, cu->body.strings[GET_UI32(cur_op, 6)],
+                    GET_REG(cur_op, 4).o, MVM_cu_string(tc, cu, GET_UI32(cur_op, 6)),
                     GET_I16(cur_op, 10), &GET_REG(cur_op, 0), MVM_reg_int64);
                 cur_op += 12;
                 goto NEXT;
@@ -2505,7 +2506,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                     MVM_exception_throw_adhoc(tc, "Cannot look up attributes in a type object");
                 REPR(obj)->attr_funcs.get_attribute(tc,
                     STABLE(obj), obj, OBJECT_BODY(obj),
-                    GET_REG(cur_op, 4).o, cu->body.strings[GET_UI32(cur_op, 6)],
+                    GET_REG(cur_op, 4).o, MVM_cu_string(tc, cu, GET_UI32(cur_op, 6)),
                     GET_I16(cur_op, 10), &GET_REG(cur_op, 0), MVM_reg_num64);
                 cur_op += 12;
                 goto NEXT;
@@ -2516,7 +2517,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                     MVM_exception_throw_adhoc(tc, "Cannot look up attributes in a type object");
                 REPR(obj)->attr_funcs.get_attribute(tc,
                     STABLE(obj), obj, OBJECT_BODY(obj),
-                    GET_REG(cur_op, 4).o, cu->body.strings[GET_UI32(cur_op, 6)],
+                    GET_REG(cur_op, 4).o, MVM_cu_string(tc, cu, GET_UI32(cur_op, 6)),
                     GET_I16(cur_op, 10), &GET_REG(cur_op, 0), MVM_reg_str);
                 cur_op += 12;
                 goto NEXT;
@@ -2527,7 +2528,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                     MVM_exception_throw_adhoc(tc, "Cannot look up attributes in a type object");
                 REPR(obj)->attr_funcs.get_attribute(tc,
                     STABLE(obj), obj, OBJECT_BODY(obj),
-                    GET_REG(cur_op, 4).o, cu->body.strings[GET_UI32(cur_op, 6)],
+                    GET_REG(cur_op, 4).o, MVM_cu_string(tc, cu, GET_UI32(cur_op, 6)),
                     GET_I16(cur_op, 10), &GET_REG(cur_op, 0), MVM_reg_obj);
                 cur_op += 12;
                 goto NEXT;
@@ -2751,6 +2752,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
 
                 stable = STABLE(GET_REG(cur_op, 0).o);
                 MVM_ASSIGN_REF(tc, &(stable->header), stable->method_cache, cache);
+                stable->cache_version++;
                 MVM_SC_WB_ST(tc, stable);
 
                 cur_op += 4;
@@ -2763,6 +2765,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                 if (flag != 0)
                     new_flags |= MVM_METHOD_CACHE_AUTHORITATIVE;
                 STABLE(obj)->mode_flags = new_flags;
+                STABLE(obj)->cache_version++;
                 MVM_SC_WB_ST(tc, STABLE(obj));
                 cur_op += 4;
                 goto NEXT;
@@ -2780,6 +2783,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                     free(STABLE(obj)->type_check_cache);
                 STABLE(obj)->type_check_cache = cache;
                 STABLE(obj)->type_check_cache_length = (MVMuint16)elems;
+                STABLE(obj)->cache_version++;
                 MVM_SC_WB_ST(tc, STABLE(obj));
                 cur_op += 4;
                 goto NEXT;
@@ -2905,6 +2909,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                 orig = ((MVMCode *)obj)->body.outer;
                 ((MVMCode *)obj)->body.outer = ((MVMContext *)ctx)->body.context;
                 ((MVMCode *)obj)->body.sf->body.outer = ((MVMContext *)ctx)->body.context->static_info;
+                MVM_incr(&tc->instance->lexical_cache_epoch);
                 if (orig != ((MVMContext *)ctx)->body.context) {
                     MVM_frame_inc_ref(tc, ((MVMContext *)ctx)->body.context);
                     if (orig) {
@@ -2987,7 +2992,8 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
             }
             OP(ctx): {
                 MVMObject *ctx = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTContext);
-                ((MVMContext *)ctx)->body.context = MVM_frame_inc_ref(tc, tc->cur_frame);
+                ((MVMContext *)ctx)->body.context = MVM_frame_inc_ref(tc,
+                    MVM_frame_share(tc, tc->cur_frame));
                 GET_REG(cur_op, 0).o = ctx;
                 cur_op += 2;
                 goto NEXT;
@@ -3703,6 +3709,7 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                 MVMSTable *st = STABLE(GET_REG(cur_op, 0).o);
                 st->mode_flags = GET_REG(cur_op, 2).i64 |
                     (st->mode_flags & (~MVM_TYPE_CHECK_CACHE_FLAG_MASK));
+                st->cache_version++;
                 MVM_SC_WB_ST(tc, st);
                 cur_op += 4;
                 goto NEXT;
@@ -3869,6 +3876,11 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                     GET_REG(cur_op, 4).i64);
                 cur_op += 6;
                 goto NEXT;
+            OP(mmapfh):
+                MVM_io_map(tc, GET_REG(cur_op, 0).o, GET_REG(cur_op, 2).o,
+                    GET_REG(cur_op, 4).i64, GET_REG(cur_op, 6).i64);
+                cur_op += 8;
+                goto NEXT;
             OP(write_fhb):
                 MVM_io_write_bytes(tc, GET_REG(cur_op, 0).o, GET_REG(cur_op, 2).o);
                 cur_op += 4;
@@ -3967,6 +3979,195 @@ void MVM_interp_run(MVMThreadContext *tc, void (*initial_invoke)(MVMThreadContex
                     MVM_args_assert_nameds_used(tc, ctx);
                 goto NEXT;
             }
+            OP(sp_findmeth): {
+                MVMObject    *obj  = GET_REG(cur_op, 2).o;
+                MVMSpeshSite *site = GET_SPESH_SITE(GET_UI32(cur_op, 4));
+                MVMSpeshICEntry *entry = obj ? MVM_spesh_ic_lookup(site, STABLE(obj), NULL) : NULL;
+                if (entry) {
+                    GET_REG(cur_op, 0).o = entry->obj;
+                    cur_op += 8;
+                }
+                else {
+                    /* Increment PC first, as we may make a method call. */
+                    MVMRegister *res  = &GET_REG(cur_op, 0);
+                    MVMString   *name = MVM_cu_string(tc, cu, site->operand);
+                    cur_op += 8;
+                    MVM_spesh_find_method(tc, site, obj, name, res);
+                }
+                goto NEXT;
+            }
+            OP(sp_getattr_i): {
+                MVMObject    *obj  = GET_REG(cur_op, 2).o;
+                MVMObject    *ch   = GET_REG(cur_op, 4).o;
+                MVMSpeshSite *site = GET_SPESH_SITE(GET_UI32(cur_op, 6));
+                MVMSpeshICEntry *entry = obj && ch ? MVM_spesh_ic_lookup(site, STABLE(obj), ch) : NULL;
+                if (!entry || !IS_CONCRETE(obj) ||
+                        !MVM_p6opaque_get_at_offset(tc, obj, entry->offset, &GET_REG(cur_op, 0), MVM_reg_int64))
+                    MVM_spesh_get_attribute(tc, site, obj, ch, GET_I16(cur_op, 10),
+                        &GET_REG(cur_op, 0), MVM_reg_int64);
+                cur_op += 12;
+                goto NEXT;
+            }
+            OP(sp_getattr_n): {
+                MVMObject    *obj  = GET_REG(cur_op, 2).o;
+                MVMObject    *ch   = GET_REG(cur_op, 4).o;
+                MVMSpeshSite *site = GET_SPESH_SITE(GET_UI32(cur_op, 6));
+                MVMSpeshICEntry *entry = obj && ch ? MVM_spesh_ic_lookup(site, STABLE(obj), ch) : NULL;
+                if (!entry || !IS_CONCRETE(obj) ||
+                        !MVM_p6opaque_get_at_offset(tc, obj, entry->offset, &GET_REG(cur_op, 0), MVM_reg_num64))
+                    MVM_spesh_get_attribute(tc, site, obj, ch, GET_I16(cur_op, 10),
+                        &GET_REG(cur_op, 0), MVM_reg_num64);
+                cur_op += 12;
+                goto NEXT;
+            }
+            OP(sp_getattr_s): {
+                MVMObject    *obj  = GET_REG(cur_op, 2).o;
+                MVMObject    *ch   = GET_REG(cur_op, 4).o;
+                MVMSpeshSite *site = GET_SPESH_SITE(GET_UI32(cur_op, 6));
+                MVMSpeshICEntry *entry = obj && ch ? MVM_spesh_ic_lookup(site, STABLE(obj), ch) : NULL;
+                if (!entry || !IS_CONCRETE(obj) ||
+                        !MVM_p6opaque_get_at_offset(tc, obj, entry->offset, &GET_REG(cur_op, 0), MVM_reg_str))
+                    MVM_spesh_get_attribute(tc, site, obj, ch, GET_I16(cur_op, 10),
+                        &GET_REG(cur_op, 0), MVM_reg_str);
+                cur_op += 12;
+                goto NEXT;
+            }
+            OP(sp_getattr_o): {
+                MVMObject    *obj  = GET_REG(cur_op, 2).o;
+                MVMObject    *ch   = GET_REG(cur_op, 4).o;
+                MVMSpeshSite *site = GET_SPESH_SITE(GET_UI32(cur_op, 6));
+                MVMSpeshICEntry *entry = obj && ch ? MVM_spesh_ic_lookup(site, STABLE(obj), ch) : NULL;
+                if (!entry || !IS_CONCRETE(obj) ||
+                        !MVM_p6opaque_get_at_offset(tc, obj, entry->offset, &GET_REG(cur_op, 0), MVM_reg_obj))
+                    MVM_spesh_get_attribute(tc, site, obj, ch, GET_I16(cur_op, 10),
+                        &GET_REG(cur_op, 0), MVM_reg_obj);
+                cur_op += 12;
+                goto NEXT;
+            }
+            OP(sp_bindattr_i): {
+                MVMObject    *obj  = GET_REG(cur_op, 0).o;
+                MVMObject    *ch   = GET_REG(cur_op, 2).o;
+                MVMSpeshSite *site = GET_SPESH_SITE(GET_UI32(cur_op, 4));
+                MVMSpeshICEntry *entry = obj && ch ? MVM_spesh_ic_lookup(site, STABLE(obj), ch) : NULL;
+                if (entry && IS_CONCRETE(obj))
+                    MVM_p6opaque_bind_at_offset(tc, obj, entry->offset, GET_REG(cur_op, 8), MVM_reg_int64);
+                else
+                    MVM_spesh_bind_attribute(tc, site, obj, ch, GET_I16(cur_op, 10),
+                        GET_REG(cur_op, 8), MVM_reg_int64);
+                MVM_SC_WB_OBJ(tc, obj);
+                cur_op += 12;
+                goto NEXT;
+            }
+            OP(sp_bindattr_n): {
+                MVMObject    *obj  = GET_REG(cur_op, 0).o;
+                MVMObject    *ch   = GET_REG(cur_op, 2).o;
+                MVMSpeshSite *site = GET_SPESH_SITE(GET_UI32(cur_op, 4));
+                MVMSpeshICEntry *entry = obj && ch ? MVM_spesh_ic_lookup(site, STABLE(obj), ch) : NULL;
+                if (entry && IS_CONCRETE(obj))
+                    MVM_p6opaque_bind_at_offset(tc, obj, entry->offset, GET_REG(cur_op, 8), MVM_reg_num64);
+                else
+                    MVM_spesh_bind_attribute(tc, site, obj, ch, GET_I16(cur_op, 10),
+                        GET_REG(cur_op, 8), MVM_reg_num64);
+                MVM_SC_WB_OBJ(tc, obj);
+                cur_op += 12;
+                goto NEXT;
+            }
+            OP(sp_bindattr_s): {
+                MVMObject    *obj  = GET_REG(cur_op, 0).o;
+                MVMObject    *ch   = GET_REG(cur_op, 2).o;
+                MVMSpeshSite *site = GET_SPESH_SITE(GET_UI32(cur_op, 4));
+                MVMSpeshICEntry *entry = obj && ch ? MVM_spesh_ic_lookup(site, STABLE(obj), ch) : NULL;
+                if (entry && IS_CONCRETE(obj))
+                    MVM_p6opaque_bind_at_offset(tc, obj, entry->offset, GET_REG(cur_op, 8), MVM_reg_str);
+                else
+                    MVM_spesh_bind_attribute(tc, site, obj, ch, GET_I16(cur_op, 10),
+                        GET_REG(cur_op, 8), MVM_reg_str);
+                MVM_SC_WB_OBJ(tc, obj);
+                cur_op += 12;
+                goto NEXT;
+            }
+            OP(sp_bindattr_o): {
+                MVMObject    *obj  = GET_REG(cur_op, 0).o;
+                MVMObject    *ch   = GET_REG(cur_op, 2).o;
+                MVMSpeshSite *site = GET_SPESH_SITE(GET_UI32(cur_op, 4));
+                MVMSpeshICEntry *entry = obj && ch ? MVM_spesh_ic_lookup(site, STABLE(obj), ch) : NULL;
+                if (entry && IS_CONCRETE(obj))
+                    MVM_p6opaque_bind_at_offset(tc, obj, entry->offset, GET_REG(cur_op, 8), MVM_reg_obj);
+                else
+                    MVM_spesh_bind_attribute(tc, site, obj, ch, GET_I16(cur_op, 10),
+                        GET_REG(cur_op, 8), MVM_reg_obj);
+                MVM_SC_WB_OBJ(tc, obj);
+                cur_op += 12;
+                goto NEXT;
+            }
+            OP(sp_istype): {
+                MVMObject    *obj  = GET_REG(cur_op, 2).o;
+                MVMSpeshSite *site = GET_SPESH_SITE(GET_UI16(cur_op, 4));
+                MVMObject    *type = reg_base[site->operand].o;
+                if (MVM_spesh_guard(site, obj, type) &&
+                        STABLE(type)->cache_version == site->guard_obj_version) {
+                    GET_REG(cur_op, 0).i64 = site->value;
+                    cur_op += 6;
+                }
+                else {
+                    /* Increment PC first, as we may make a method call. */
+                    MVMRegister *res = &GET_REG(cur_op, 0);
+                    if (type)
+                        MVM_spesh_log(tc, site, obj, type);
+                    cur_op += 6;
+                    MVM_6model_istype(tc, obj, type, res);
+                }
+                goto NEXT;
+            }
+            OP(sp_jit_enter): {
+                MVMJitCode *jc = tc->cur_frame->static_info->body.jit_code;
+                GC_SYNC_POINT(tc);
+                cur_op = bytecode_start + jc->func(tc, reg_base, jc->entries[GET_UI16(cur_op, 0)]);
+                goto NEXT;
+            }
+            OP(queuepoll):
+                GET_REG(cur_op, 0).o = MVM_concblockingqueue_poll(tc, GET_REG(cur_op, 2).o);
+                cur_op += 4;
+                goto NEXT;
+            OP(asynctimer):
+                GET_REG(cur_op, 0).i64 = MVM_io_async_timer(tc, GET_REG(cur_op, 2).o,
+                    GET_REG(cur_op, 4).o, GET_REG(cur_op, 6).i64, GET_REG(cur_op, 8).i64);
+                cur_op += 10;
+                goto NEXT;
+            OP(asynclisten):
+                GET_REG(cur_op, 0).i64 = MVM_io_async_listen(tc, GET_REG(cur_op, 2).o,
+                    GET_REG(cur_op, 4).o, GET_REG(cur_op, 6).s, GET_REG(cur_op, 8).i64);
+                cur_op += 10;
+                goto NEXT;
+            OP(asyncconnect):
+                GET_REG(cur_op, 0).i64 = MVM_io_async_connect(tc, GET_REG(cur_op, 2).o,
+                    GET_REG(cur_op, 4).o, GET_REG(cur_op, 6).s, GET_REG(cur_op, 8).i64);
+                cur_op += 10;
+                goto NEXT;
+            OP(asyncread):
+                GET_REG(cur_op, 0).i64 = MVM_io_async_read(tc, GET_REG(cur_op, 2).i64,
+                    GET_REG(cur_op, 4).o, GET_REG(cur_op, 6).o, GET_REG(cur_op, 8).o);
+                cur_op += 10;
+                goto NEXT;
+            OP(asyncwrite):
+                GET_REG(cur_op, 0).i64 = MVM_io_async_write(tc, GET_REG(cur_op, 2).i64,
+                    GET_REG(cur_op, 4).o, GET_REG(cur_op, 6).o, GET_REG(cur_op, 8).o);
+                cur_op += 10;
+                goto NEXT;
+            OP(asyncreadfile):
+                GET_REG(cur_op, 0).i64 = MVM_io_async_readfile(tc, GET_REG(cur_op, 2).s,
+                    GET_REG(cur_op, 4).o, GET_REG(cur_op, 6).o, GET_REG(cur_op, 8).o);
+                cur_op += 10;
+                goto NEXT;
+            OP(asyncshell):
+                GET_REG(cur_op, 0).i64 = MVM_io_async_shell(tc, GET_REG(cur_op, 2).s,
+                    GET_REG(cur_op, 4).o, GET_REG(cur_op, 6).o);
+                cur_op += 8;
+                goto NEXT;
+            OP(asynccancel):
+                MVM_io_async_cancel(tc, GET_REG(cur_op, 0).i64);
+                cur_op += 2;
+                goto NEXT;
 #if MVM_CGOTO
             OP_CALL_EXTOP: {
                 /* Bounds checking? Never heard of that. */
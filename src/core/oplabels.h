@@ -565,27 +565,27 @@ static const void * const LABELS[] = {
     &&OP_getuniprop_bool,
     &&OP_getuniprop_str,
     &&OP_matchuniprop,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
+    &&OP_sp_findmeth,
+    &&OP_sp_getattr_i,
+    &&OP_sp_getattr_n,
+    &&OP_sp_getattr_s,
+    &&OP_sp_getattr_o,
+    &&OP_sp_bindattr_i,
+    &&OP_sp_bindattr_n,
+    &&OP_sp_bindattr_s,
+    &&OP_sp_bindattr_o,
+    &&OP_sp_istype,
+    &&OP_sp_jit_enter,
+    &&OP_asynctimer,
+    &&OP_asynclisten,
+    &&OP_asyncconnect,
+    &&OP_asyncread,
+    &&OP_asyncwrite,
+    &&OP_asyncreadfile,
+    &&OP_asyncshell,
+    &&OP_asynccancel,
+    &&OP_mmapfh,
+    &&OP_queuepoll,
     NULL,
     NULL,
     NULL,
@@ -3951,9 +3951,156 @@ static MVMOpInfo MVM_op_infos[] = {
         4,
         { MVM_operand_write_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_int64 }
     },
+    {
+        MVM_OP_sp_findmeth,
+        "sp_findmeth",
+        ".s",
+        3,
+        { MVM_operand_write_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_int32 }
+    },
+    {
+        MVM_OP_sp_getattr_i,
+        "sp_getattr_i",
+        ".s",
+        5,
+        { MVM_operand_write_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_int32, MVM_operand_int16 }
+    },
+    {
+        MVM_OP_sp_getattr_n,
+        "sp_getattr_n",
+        ".s",
+        5,
+        { MVM_operand_write_reg | MVM_operand_num64, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_int32, MVM_operand_int16 }
+    },
+    {
+        MVM_OP_sp_getattr_s,
+        "sp_getattr_s",
+        ".s",
+        5,
+        { MVM_operand_write_reg | MVM_operand_str, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_int32, MVM_operand_int16 }
+    },
+    {
+        MVM_OP_sp_getattr_o,
+        "sp_getattr_o",
+        ".s",
+        5,
+        { MVM_operand_write_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_int32, MVM_operand_int16 }
+    },
+    {
+        MVM_OP_sp_bindattr_i,
+        "sp_bindattr_i",
+        ".s",
+        5,
+        { MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_int32, MVM_operand_read_reg | MVM_operand_int64, MVM_operand_int16 }
+    },
+    {
+        MVM_OP_sp_bindattr_n,
+        "sp_bindattr_n",
+        ".s",
+        5,
+        { MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_int32, MVM_operand_read_reg | MVM_operand_num64, MVM_operand_int16 }
+    },
+    {
+        MVM_OP_sp_bindattr_s,
+        "sp_bindattr_s",
+        ".s",
+        5,
+        { MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_int32, MVM_operand_read_reg | MVM_operand_str, MVM_operand_int16 }
+    },
+    {
+        MVM_OP_sp_bindattr_o,
+        "sp_bindattr_o",
+        ".s",
+        5,
+        { MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_int32, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_int16 }
+    },
+    {
+        MVM_OP_sp_istype,
+        "sp_istype",
+        ".s",
+        3,
+        { MVM_operand_write_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_int16 }
+    },
+    {
+        MVM_OP_sp_jit_enter,
+        "sp_jit_enter",
+        ".s",
+        1,
+        { MVM_operand_int16 }
+    },
+    {
+        MVM_OP_asynctimer,
+        "asynctimer",
+        "  ",
+        5,
+        { MVM_operand_write_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_int64 }
+    },
+    {
+        MVM_OP_asynclisten,
+        "asynclisten",
+        "  ",
+        5,
+        { MVM_operand_write_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_str, MVM_operand_read_reg | MVM_operand_int64 }
+    },
+    {
+        MVM_OP_asyncconnect,
+        "asyncconnect",
+        "  ",
+        5,
+        { MVM_operand_write_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_str, MVM_operand_read_reg | MVM_operand_int64 }
+    },
+    {
+        MVM_OP_asyncread,
+        "asyncread",
+        "  ",
+        5,
+        { MVM_operand_write_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj }
+    },
+    {
+        MVM_OP_asyncwrite,
+        "asyncwrite",
+        "  ",
+        5,
+        { MVM_operand_write_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj }
+    },
+    {
+        MVM_OP_asyncreadfile,
+        "asyncreadfile",
+        "  ",
+        5,
+        { MVM_operand_write_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_str, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj }
+    },
+    {
+        MVM_OP_asyncshell,
+        "asyncshell",
+        "  ",
+        4,
+        { MVM_operand_write_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_str, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj }
+    },
+    {
+        MVM_OP_asynccancel,
+        "asynccancel",
+        "  ",
+        1,
+        { MVM_operand_read_reg | MVM_operand_int64 }
+    },
+    {
+        MVM_OP_mmapfh,
+        "mmapfh",
+        "  ",
+        4,
+        { MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_int64 }
+    },
+    {
+        MVM_OP_queuepoll,
+        "queuepoll",
+        "  ",
+        2,
+        { MVM_operand_write_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj }
+    },
 };
 
-static unsigned short MVM_op_counts = 564;
+static unsigned short MVM_op_counts = 585;
 
 MVMOpInfo * MVM_op_get_op(unsigned short op) {
     if (op >= MVM_op_counts)
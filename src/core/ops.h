@@ -565,6 +565,27 @@
 #define MVM_OP_getuniprop_bool 561
 #define MVM_OP_getuniprop_str 562
 #define MVM_OP_matchuniprop 563
+#define MVM_OP_sp_findmeth 564
+#define MVM_OP_sp_getattr_i 565
+#define MVM_OP_sp_getattr_n 566
+#define MVM_OP_sp_getattr_s 567
+#define MVM_OP_sp_getattr_o 568
+#define MVM_OP_sp_bindattr_i 569
+#define MVM_OP_sp_bindattr_n 570
+#define MVM_OP_sp_bindattr_s 571
+#define MVM_OP_sp_bindattr_o 572
+#define MVM_OP_sp_istype 573
+#define MVM_OP_sp_jit_enter 574
+#define MVM_OP_asynctimer 575
+#define MVM_OP_asynclisten 576
+#define MVM_OP_asyncconnect 577
+#define MVM_OP_asyncread 578
+#define MVM_OP_asyncwrite 579
+#define MVM_OP_asyncreadfile 580
+#define MVM_OP_asyncshell 581
+#define MVM_OP_asynccancel 582
+#define MVM_OP_mmapfh 583
+#define MVM_OP_queuepoll 584
 
 #define MVM_OP_EXT_BASE 1024
 #define MVM_OP_EXT_CU_LIMIT 1024
@@ -10,10 +10,14 @@ MVMThreadContext * MVM_tc_create(MVMInstance *instance) {
     tc->instance = instance;
 
     /* Set up GC nursery. */
-    tc->nursery_fromspace   = calloc(1, MVM_NURSERY_SIZE);
-    tc->nursery_tospace     = calloc(1, MVM_NURSERY_SIZE);
-    tc->nursery_alloc       = tc->nursery_tospace;
-    tc->nursery_alloc_limit = (char *)tc->nursery_alloc + MVM_NURSERY_SIZE;
+    tc->nursery_size           = instance->nursery_size;
+    tc->nursery_fromspace_size = tc->nursery_size;
+    tc->nursery_tospace_size   = tc->nursery_size;
+    tc->nursery_fromspace      = calloc(1, tc->nursery_size);
+    tc->nursery_tospace        = calloc(1, tc->nursery_size);
+    tc->nursery_alloc          = tc->nursery_tospace;
+    tc->nursery_alloc_limit    = (char *)tc->nursery_alloc + tc->nursery_size;
+    tc->nursery_last_collect   = MVM_platform_now();
 
     /* Set up temporary root handling. */
     tc->num_temproots   = 0;
@@ -24,6 +28,9 @@ MVMThreadContext * MVM_tc_create(MVMInstance *instance) {
     tc->num_gen2roots   = 0;
     tc->alloc_gen2roots = 64;
     tc->gen2roots       = malloc(sizeof(MVMCollectable *) * tc->alloc_gen2roots);
+    tc->num_gen2slots   = 0;
+    tc->alloc_gen2slots = 64;
+    tc->gen2slots       = calloc(tc->alloc_gen2slots, sizeof(MVMGen2Slot));
 
     /* Set up the second generation allocator. */
     tc->gen2 = MVM_gc_gen2_create(instance);
@@ -63,6 +70,9 @@ void MVM_tc_destroy(MVMThreadContext *tc) {
     /* We run once again (non-blocking) to eventually close filehandles. */
     uv_run(tc->loop, UV_RUN_NOWAIT);
 
+    /* Free the call stack. */
+    MVM_callstack_destroy(tc);
+
     /* Free the nursery. */
     free(tc->nursery_fromspace);
     free(tc->nursery_tospace);
@@ -74,6 +84,7 @@ void MVM_tc_destroy(MVMThreadContext *tc) {
     MVM_checked_free_null(tc->gc_work);
     MVM_checked_free_null(tc->temproots);
     MVM_checked_free_null(tc->gen2roots);
+    MVM_checked_free_null(tc->gen2slots);
     MVM_checked_free_null(tc->frame_pool_table);
 
     /* destroy the libuv event loop */
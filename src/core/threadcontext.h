@@ -44,6 +44,20 @@ typedef enum {
 #define MVMInitialFramePoolTableSize    64
 #define MVMFramePoolLengthLimit         64
 
+/* Number of dynamic variable lookups a thread remembers the results of. */
+#define MVM_DYNLEX_CACHE_SIZE 8
+
+/* Where a lookup of a dynamic variable found it, when starting from the
+ * given frame. That frame's caller chain stays as it is while the frame is
+ * running, so the entry holds until it returns or is unwound, which clears
+ * it; the frame is flagged so that only such frames need look. */
+struct MVMDynlexCacheEntry {
+    MVMString   *name;
+    MVMFrame    *start;
+    MVMRegister *reg;
+    MVMuint16    type;
+};
+
 #if MVM_HLL_PROFILE_CALLS
 typedef struct _MVMProfileRecord {
     MVMuint32 callsite_id;
@@ -115,6 +129,18 @@ struct MVMThreadContext {
      * allocate new ones. */
     void *nursery_tospace;
 
+    /* The sizes of the two nursery semi-spaces, which differ after the
+     * nursery is resized until the next collection, and the size the next
+     * tospace should be. */
+    MVMuint32 nursery_fromspace_size;
+    MVMuint32 nursery_tospace_size;
+    MVMuint32 nursery_size;
+
+    /* When the nursery was last collected, and how many collections in a
+     * row found little of it used. */
+    MVMuint64 nursery_last_collect;
+    MVMuint32 nursery_idle_runs;
+
     /* The second GC generation allocator. */
     MVMGen2Allocator *gen2;
 
@@ -143,6 +169,13 @@ struct MVMThreadContext {
     MVMuint32             alloc_gen2roots;
     MVMCollectable      **gen2roots;
 
+    /* Slots within generation 2 collectables that point at nursery
+     * collectables, for when only those slots need visiting rather than
+     * the whole collectable. An open-addressed set, keyed on the slot. */
+    MVMuint32             num_gen2slots;
+    MVMuint32             alloc_gen2slots;
+    MVMGen2Slot          *gen2slots;
+
     /* The GC's cross-thread in-tray of processing work. */
     MVMGCPassedWork *gc_in_tray;
 
@@ -155,6 +188,19 @@ struct MVMThreadContext {
     MVMuint32                gc_work_size;
     MVMuint32                gc_work_count;
 
+    /* Steal stack to share marking work through, during a full collection
+     * with other threads taking part. */
+    MVMGCStealStack *gc_steal_stack;
+
+    /* The call stack region being allocated from, and the most recently
+     * allocated block on the call stack that is not yet popped. */
+    MVMCallStackRegion *callstack_region;
+    MVMCallStackBlock  *callstack_top;
+
+    /* Recent dynamic variable lookups, and the entry to replace next. */
+    MVMDynlexCacheEntry dynlex_cache[MVM_DYNLEX_CACHE_SIZE];
+    MVMuint32           dynlex_cache_next;
+
     /* Pool table of chains of frames for each static frame. */
     MVMFrame **frame_pool_table;
 
@@ -97,7 +97,7 @@ MVMObject * MVM_thread_start(MVMThreadContext *tc, MVMObject *invokee, MVMObject
          * the thread is done. */
         ts = malloc(sizeof(ThreadStart));
         ts->tc = child_tc;
-        ts->caller = MVM_frame_inc_ref(tc, tc->cur_frame);
+        ts->caller = MVM_frame_inc_ref(tc, MVM_frame_share(tc, tc->cur_frame));
         ts->thread_obj = child_obj;
 
         /* push this to the *child* tc's temp roots. */
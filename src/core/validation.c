@@ -586,8 +586,13 @@ void MVM_validate_static_frame(MVMThreadContext *tc,
         read_op(val);
 
         switch (val->cur_mark[0]) {
-            case MARK_regular:
             case MARK_special:
+                if (val->cur_mark[1] == 's')
+                    fail(val, MSG(val, "op %s may only be produced by the specializer"),
+                            val->cur_info->name);
+                /* fallthrough */
+
+            case MARK_regular:
                 validate_operands(val);
                 break;
 
@@ -27,7 +27,7 @@ void * MVM_gc_allocate_nursery(MVMThreadContext *tc, size_t size) {
          * second generation. Note that this circumstance is exceptionally
          * unlikely in any non-contrived situation. */
         while ((char *)tc->nursery_alloc + size >= (char *)tc->nursery_alloc_limit) {
-            if (size > MVM_NURSERY_SIZE)
+            if (size > (size_t)((char *)tc->nursery_alloc_limit - (char *)tc->nursery_tospace))
                 MVM_panic(MVM_exitcode_gcalloc, "Attempt to allocate more than the maximum nursery size");
             MVM_gc_enter_from_allocator(tc);
         }
@@ -1,4 +1,5 @@
 #include "moar.h"
+#include "platform/time.h"
 
 /* Combines a piece of work that will be passed to another thread with the
  * ID of the target thread to pass it to. */
@@ -54,12 +55,23 @@ void MVM_gc_collect(MVMThreadContext *tc, MVMuint8 what_to_do, MVMuint8 gen) {
         /* Swap fromspace and tospace. */
         void * fromspace = tc->nursery_tospace;
         void * tospace   = tc->nursery_fromspace;
-        tc->nursery_fromspace = fromspace;
-        tc->nursery_tospace   = tospace;
+        MVMuint32 fromspace_size = tc->nursery_tospace_size;
+
+        /* If the nursery is being resized, the new tospace (which was the
+         * fromspace of the last run, so holds nothing we need) is replaced
+         * by one of the new size. */
+        if (tc->nursery_fromspace_size != tc->nursery_size) {
+            free(tospace);
+            tospace = calloc(1, tc->nursery_size);
+        }
+        tc->nursery_fromspace      = fromspace;
+        tc->nursery_fromspace_size = fromspace_size;
+        tc->nursery_tospace        = tospace;
+        tc->nursery_tospace_size   = tc->nursery_size;
 
         /* Reset nursery allocation pointers to the new tospace. */
         tc->nursery_alloc       = tospace;
-        tc->nursery_alloc_limit = (char *)tc->nursery_alloc + MVM_NURSERY_SIZE;
+        tc->nursery_alloc_limit = (char *)tc->nursery_alloc + tc->nursery_tospace_size;
 
         MVM_gc_worklist_add(tc, worklist, &tc->thread_obj);
         GCDEBUG_LOG(tc, MVM_GC_DEBUG_COLLECT, "Thread %d run %d : processing %d items from thread_obj\n", worklist->items);
@@ -136,10 +148,70 @@ void MVM_gc_collect(MVMThreadContext *tc, MVMuint8 what_to_do, MVMuint8 gen) {
         free(wtp.target_work);
     }
 
-    /* If it was a full collection, some of the things in gen2 that we root
-     * due to point to gen1 objects may be dead. */
-    if (gen != MVMGCGenerations_Nursery)
-        MVM_gc_root_gen2_cleanup(tc);
+    /* Note that after a full collection, some of the things in gen2 that we
+     * root due to pointing to gen1 objects may be dead. They are cleaned up
+     * once every thread is done marking, since until then other threads may
+     * still mark our objects. */
+}
+
+/* Moves a chunk of the worklist to our steal stack, provided whatever we
+ * put there last was taken. */
+static void share_work(MVMThreadContext *tc, MVMGCWorklist *worklist) {
+    MVMGCStealStack *stack  = tc->gc_steal_stack;
+    MVMGCWorklist   *shared = stack->worklist;
+    uv_mutex_lock(&stack->mutex);
+    if (shared->items == 0) {
+        worklist->items -= MVM_GC_STEAL_CHUNK;
+        MVM_gc_worklist_presize_for(tc, shared, MVM_GC_STEAL_CHUNK);
+        memcpy(shared->list, worklist->list + worklist->items,
+            MVM_GC_STEAL_CHUNK * sizeof(MVMCollectable **));
+        shared->items = MVM_GC_STEAL_CHUNK;
+        MVM_store(&stack->available, MVM_GC_STEAL_CHUNK);
+    }
+    uv_mutex_unlock(&stack->mutex);
+}
+
+/* Takes the work on a steal stack, if there is any, and does it. Before
+ * taking it we make sure to hold a vote against the run being finished;
+ * the owner of the stack does not give up its own vote while there's work
+ * on it, so the run can not end with the work in neither place. Returns
+ * the number of items taken. */
+MVMuint32 MVM_gc_collect_steal(MVMThreadContext *tc, MVMGCStealStack *victim, MVMuint8 gen, MVMuint32 *put_vote) {
+    MVMGCWorklist *worklist;
+    MVMuint32      taken;
+    WorkToPass     wtp;
+
+    if (!MVM_load(&victim->available))
+        return 0;
+
+    worklist = MVM_gc_worklist_create(tc, gen != MVMGCGenerations_Nursery);
+    uv_mutex_lock(&victim->mutex);
+    taken = victim->worklist->items;
+    if (taken) {
+        if (!*put_vote) {
+            MVM_incr(&tc->instance->gc_finish);
+            *put_vote = 1;
+        }
+        MVM_gc_worklist_presize_for(tc, worklist, taken);
+        memcpy(worklist->list, victim->worklist->list, taken * sizeof(MVMCollectable **));
+        worklist->items = taken;
+        victim->worklist->items = 0;
+        MVM_store(&victim->available, 0);
+    }
+    uv_mutex_unlock(&victim->mutex);
+
+    if (taken) {
+        GCDEBUG_LOG(tc, MVM_GC_DEBUG_COLLECT, "Thread %d run %d : processing %d stolen items\n", taken);
+        wtp.num_target_threads = 0;
+        wtp.target_work = NULL;
+        process_worklist(tc, worklist, &wtp, gen);
+        if (wtp.num_target_threads) {
+            pass_leftover_work(tc, &wtp);
+            free(wtp.target_work);
+        }
+    }
+    MVM_gc_worklist_destroy(tc, worklist);
+    return taken;
 }
 
 /* Processes the current worklist. */
@@ -148,6 +220,7 @@ static void process_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist, Work
     MVMCollectable   **item_ptr;
     MVMCollectable    *new_addr;
     MVMuint32          gen2count;
+    MVMuint32          until_share = MVM_GC_STEAL_INTERVAL;
     MVMuint16          i;
 
     /* Grab the second generation allocator; we may move items into the
@@ -157,6 +230,13 @@ static void process_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist, Work
     MVM_gc_worklist_mark_frame_roots(tc, worklist);
 
     while ((item_ptr = MVM_gc_worklist_get(tc, worklist))) {
+        /* If other threads are taking part in a full collection, every so
+         * often see if we've enough work left to give them some. */
+        if (tc->gc_steal_stack && --until_share == 0) {
+            until_share = MVM_GC_STEAL_INTERVAL;
+            if (worklist->items >= 2 * MVM_GC_STEAL_CHUNK && !MVM_load(&tc->gc_steal_stack->available))
+                share_work(tc, worklist);
+        }
         /* Dereference the object we're considering. */
         MVMCollectable *item = *item_ptr;
         MVMuint8 item_gen2;
@@ -206,8 +286,12 @@ static void process_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist, Work
             MVM_panic(1, "Heap corruption detected: pointer %p to past fromspace", item);
 
         /* If it's owned by a different thread, we need to pass it over to
-         * the owning thread. */
-        if (item->owner != tc->thread_id) {
+         * the owning thread. Generation 2 objects don't move, so marking
+         * them is left to whichever thread gets to them first. Two threads
+         * may both get to one at the same time and both mark it; that only
+         * costs a little duplicated work, and is rare enough not to be
+         * worth an atomic operation on every object. */
+        if (item->owner != tc->thread_id && !item_gen2) {
             GCDEBUG_LOG(tc, MVM_GC_DEBUG_COLLECT, "Thread %d run %d : sending a handle %p to object %p to thread %d\n", item_ptr, item, item->owner);
             pass_work_item(tc, wtp, item_ptr);
             continue;
@@ -300,7 +384,8 @@ static void process_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist, Work
         MVM_gc_worklist_mark_frame_roots(tc, worklist);
 
         /* In moving an object to generation 2, we may have left it pointing
-         * to nursery objects. If so, make sure it's in the gen2 roots. */
+         * to nursery objects. If so, make sure it's in the gen2 roots, or
+         * just that those slots are remembered if they are in the object. */
         if (to_gen2) {
             MVMCollectable **j;
             MVMuint32 max = worklist->items, k;
@@ -308,7 +393,7 @@ static void process_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist, Work
             for (k = gen2count; k < max; k++) {
                 j = worklist->list[k];
                 if (*j)
-                    MVM_gc_write_barrier(tc, new_addr, *j);
+                    MVM_gc_write_barrier_slot(tc, new_addr, j, *j);
             }
         }
     }
@@ -497,6 +582,45 @@ static void add_in_tray_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklis
     }
 }
 
+/* Decides how big the nursery should be from the next collection on. This
+ * goes by how much of it was in use when this collection started (limit is
+ * how far allocation had got in what is now fromspace), how much of that
+ * survived, and how long ago the nursery was last collected. Should the
+ * nursery shrink, we stop allocating in the current tospace where the
+ * smaller one would end, so that what survives the next collection will
+ * be sure to fit. */
+void MVM_gc_collect_size_nursery(MVMThreadContext *tc, void *limit) {
+    MVMuint32 size     = tc->nursery_tospace_size;
+    MVMuint64 used     = (char *)limit - (char *)tc->nursery_fromspace;
+    MVMuint64 survived = (char *)tc->nursery_alloc - (char *)tc->nursery_tospace;
+    MVMuint64 now      = MVM_platform_now();
+    MVMuint64 interval = now - tc->nursery_last_collect;
+    tc->nursery_last_collect = now;
+
+    if (!tc->instance->nursery_adaptive)
+        return;
+
+    if (survived > size / 2 ||
+            (used > tc->nursery_fromspace_size / 2 && interval < MVM_NURSERY_GROW_INTERVAL)) {
+        tc->nursery_idle_runs = 0;
+        if (size < MVM_NURSERY_SIZE_MAX) {
+            tc->nursery_size = size * 2;
+            GCDEBUG_LOG(tc, MVM_GC_DEBUG_COLLECT, "Thread %d run %d : growing nursery to %u bytes\n", tc->nursery_size);
+        }
+    }
+    else if (used < tc->nursery_fromspace_size / 8 && survived < size / 8) {
+        if (++tc->nursery_idle_runs >= MVM_NURSERY_SHRINK_RUNS && size > MVM_NURSERY_SIZE_MIN) {
+            tc->nursery_idle_runs   = 0;
+            tc->nursery_size        = size / 2;
+            tc->nursery_alloc_limit = (char *)tc->nursery_tospace + tc->nursery_size;
+            GCDEBUG_LOG(tc, MVM_GC_DEBUG_COLLECT, "Thread %d run %d : shrinking nursery to %u bytes\n", tc->nursery_size);
+        }
+    }
+    else {
+        tc->nursery_idle_runs = 0;
+    }
+}
+
 /* Save dead STable pointers to delete later.. */
 static void MVM_gc_collect_enqueue_stable_for_deletion(MVMThreadContext *tc, MVMSTable *st) {
     MVMSTable *old_head;
@@ -564,6 +688,7 @@ void MVM_gc_collect_cleanup_gen2roots(MVMThreadContext *tc) {
         if (gen2roots[i]->flags & MVM_CF_GEN2_LIVE)
             gen2roots[ins_pos++] = gen2roots[i];
     tc->num_gen2roots = ins_pos;
+    MVM_gc_root_gen2_slots_cleanup(tc);
 }
 
 /* Free STables (in any thread/generation!) queued to be freed. */
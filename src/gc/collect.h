@@ -1,11 +1,25 @@
-/* How big is the nursery area? Note that since it's semi-space copying, we
- * actually have double this amount allocated. Also it is per thread. (In
- * the future, we'll make this adaptive rather than a constant.) */
-#define MVM_NURSERY_SIZE 4194304
+/* How big is the nursery area to start with? Note that since it's semi-space
+ * copying, we actually have double this amount allocated. Also it is per
+ * thread. This is the default; the MVM_NURSERY_SIZE environment variable
+ * overrides it for an instance. Each thread's nursery is then grown or shrunk
+ * between the minimum and maximum as its allocation rate and the survival
+ * rate of its objects warrant, unless MVM_NURSERY_ADAPTIVE is set to 0. */
+#define MVM_NURSERY_SIZE        4194304
+#define MVM_NURSERY_SIZE_MIN    262144
+#define MVM_NURSERY_SIZE_MAX    67108864
+
+/* A thread's nursery is grown when the objects surviving a collection fill
+ * more than half of it, or when it mostly filled up again within this many
+ * nanoseconds of its last collection. It is shrunk after this many
+ * collections in a row that found under an eighth of it in use. */
+#define MVM_NURSERY_GROW_INTERVAL   10000000
+#define MVM_NURSERY_SHRINK_RUNS     8
 
 /* How often do we collect the second generation? This is specified as the
  * number of nursery runs that happen per full collection. For example, if
- * this is set to 10 then every tenth collection will involve the full heap. */
+ * this is set to 10 then every tenth collection will involve the full heap.
+ * This is the default; the MVM_GC_GEN2_RATIO environment variable overrides
+ * it for an instance. */
 #define MVM_GC_GEN2_RATIO 25
 
 /* What things should be processed in this GC run? */
@@ -46,10 +60,29 @@ struct MVMGCPassedWork {
     MVMint32         num_items;
 };
 
+/* In a full collection, a thread with plenty of marking work left moves
+ * some of it to its steal stack, from where threads that have run out of
+ * work of their own take it. This is how many items are moved at a time,
+ * and how often (in items processed) a thread considers doing so. */
+#define MVM_GC_STEAL_CHUNK      64
+#define MVM_GC_STEAL_INTERVAL   32
+
+/* A steal stack. There's one per thread taking part in a GC run; they are
+ * kept by the instance, so may be looked at by other threads at any time
+ * during the run. The worklist is only touched with the mutex held, and
+ * available is its number of items, for checking without the mutex. */
+struct MVMGCStealStack {
+    uv_mutex_t     mutex;
+    MVMGCWorklist *worklist;
+    AO_t           available;
+};
+
 /* Functions. */
 void MVM_gc_collect(MVMThreadContext *tc, MVMuint8 what_to_do, MVMuint8 gen);
 void MVM_gc_collect_free_nursery_uncopied(MVMThreadContext *tc, void *limit);
+void MVM_gc_collect_size_nursery(MVMThreadContext *tc, void *limit);
 void MVM_gc_collect_cleanup_gen2roots(MVMThreadContext *tc);
 void MVM_gc_collect_free_gen2_unmarked(MVMThreadContext *tc);
 void MVM_gc_mark_collectable(MVMThreadContext *tc, MVMGCWorklist *worklist, MVMCollectable *item);
 void MVM_gc_collect_free_stables(MVMThreadContext *tc);
+MVMuint32 MVM_gc_collect_steal(MVMThreadContext *tc, MVMGCStealStack *victim, MVMuint8 gen, MVMuint32 *put_vote);
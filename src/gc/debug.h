@@ -3,6 +3,6 @@
 
 #define MVM_ASSERT_NOT_FROMSPACE(tc, c) do { \
         if ((char *)(c) >= (char *)tc->nursery_fromspace && \
-                (char *)(c) < (char *)tc->nursery_fromspace + MVM_NURSERY_SIZE) \
+                (char *)(c) < (char *)tc->nursery_fromspace + tc->nursery_fromspace_size) \
             MVM_exception_throw_adhoc(tc, "Collectable in fromspace accessed"); \
     } while (0);
@@ -234,4 +234,5 @@ void MVM_gc_gen2_transfer(MVMThreadContext *src, MVMThreadContext *dest) {
         free(src->gen2roots);
         src->gen2roots = NULL;
     }
+    MVM_gc_root_gen2_slots_transfer(src, dest);
 }
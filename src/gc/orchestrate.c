@@ -147,6 +147,20 @@ static void cleanup_sent_items(MVMThreadContext *tc) {
     tc->gc_sent_items = NULL;
 }
 
+/* Takes marking work from the steal stacks, starting with our own, which
+ * we must empty before giving up our vote. Returns 0 if there was none. */
+static MVMuint32 steal_work(MVMThreadContext *tc, MVMuint8 gen, MVMuint32 *put_vote) {
+    MVMGCStealStack  *own    = tc->gc_steal_stack;
+    MVMGCStealStack **stacks = tc->instance->gc_steal_stacks;
+    MVMuint32 n = tc->instance->gc_steal_count, i;
+    if (MVM_gc_collect_steal(tc, own, gen, put_vote))
+        return 1;
+    for (i = 0; i < n; i++)
+        if (stacks[i] != own && MVM_gc_collect_steal(tc, stacks[i], gen, put_vote))
+            return 1;
+    return 0;
+}
+
 /* Called by a thread when it thinks it is done with GC. It may get some more
  * work yet, though. */
 static void finish_gc(MVMThreadContext *tc, MVMuint8 gen) {
@@ -163,6 +177,10 @@ static void finish_gc(MVMThreadContext *tc, MVMuint8 gen) {
             failed |= process_sent_items(tc->gc_work[i].tc, &put_vote);
         }
 
+        /* Help out with any marking work other threads have to spare. */
+        if (tc->gc_steal_stack)
+            failed |= steal_work(tc, gen, &put_vote);
+
         if (!failed && put_vote) {
             MVM_decr(&tc->instance->gc_finish);
             put_vote = 0;
@@ -253,16 +271,82 @@ static void signal_child(MVMThreadContext *tc) {
     }
 }
 
+/* Called by the coordinator, while the other threads wait for the run to
+ * start, to set up a steal stack for each of the threads taking part. */
+static void prepare_steal_stacks(MVMThreadContext *tc, MVMuint32 count) {
+    MVMInstance *instance = tc->instance;
+    if (count > 1 && count > instance->gc_steal_alloc) {
+        MVMuint32 i;
+        instance->gc_steal_stacks = realloc(instance->gc_steal_stacks,
+            count * sizeof(MVMGCStealStack *));
+        for (i = instance->gc_steal_alloc; i < count; i++) {
+            MVMGCStealStack *stack = calloc(1, sizeof(MVMGCStealStack));
+            uv_mutex_init(&stack->mutex);
+            stack->worklist = MVM_gc_worklist_create(tc, 1);
+            instance->gc_steal_stacks[i] = stack;
+        }
+        instance->gc_steal_alloc = count;
+    }
+    instance->gc_steal_count = count;
+    MVM_store(&instance->gc_steal_next, 0);
+}
+
+/* Frees the steal stacks, at instance destruction. */
+void MVM_gc_free_steal_stacks(MVMThreadContext *tc) {
+    MVMInstance *instance = tc->instance;
+    MVMuint32 i;
+    for (i = 0; i < instance->gc_steal_alloc; i++) {
+        uv_mutex_destroy(&instance->gc_steal_stacks[i]->mutex);
+        MVM_gc_worklist_destroy(tc, instance->gc_steal_stacks[i]->worklist);
+        free(instance->gc_steal_stacks[i]);
+    }
+    MVM_checked_free_null(instance->gc_steal_stacks);
+    instance->gc_steal_alloc = 0;
+}
+
+/* Queues memory to be freed once every thread has reached a safe point, for
+ * things that other threads may be reading without holding a lock. Such
+ * reads must not span a point where the thread could join a GC run. */
+void MVM_gc_free_at_safepoint(MVMThreadContext *tc, void *to_free) {
+    MVMGCSafepointFree *item = malloc(sizeof(MVMGCSafepointFree));
+    item->to_free = to_free;
+    do {
+        item->next = (MVMGCSafepointFree *)MVM_load(&tc->instance->gc_safepoint_free);
+    } while (!MVM_trycas(&tc->instance->gc_safepoint_free, item->next, item));
+}
+
+/* Frees everything queued by MVM_gc_free_at_safepoint. Called by the GC
+ * coordinator once all threads have joined the run, and at shutdown. */
+void MVM_gc_free_safepoint_queue(MVMThreadContext *tc) {
+    MVMGCSafepointFree *item = (MVMGCSafepointFree *)MVM_load(&tc->instance->gc_safepoint_free);
+    MVM_store(&tc->instance->gc_safepoint_free, 0);
+    while (item) {
+        MVMGCSafepointFree *next = item->next;
+        free(item->to_free);
+        free(item);
+        item = next;
+    }
+}
+
 static void run_gc(MVMThreadContext *tc, MVMuint8 what_to_do) {
     MVMuint8   gen;
     MVMThread *child;
     MVMuint32  i, n;
 
     /* Do GC work for this thread, or at least all we know about. */
-    gen = MVM_load(&tc->instance->gc_seq_number) % MVM_GC_GEN2_RATIO == 0
+    gen = MVM_load(&tc->instance->gc_seq_number) % tc->instance->gc_gen2_ratio == 0
         ? MVMGCGenerations_Both
         : MVMGCGenerations_Nursery;
 
+    /* If it's a full collection with other threads taking part, pick a
+     * steal stack to share our marking work through. */
+    if (gen == MVMGCGenerations_Both && tc->instance->gc_steal_count > 1) {
+        MVMuint32 slot = (MVMuint32)MVM_incr(&tc->instance->gc_steal_next);
+        if (slot < tc->instance->gc_steal_count)
+            for (i = 0, n = tc->gc_work_count ; i < n; i++)
+                tc->gc_work[i].tc->gc_steal_stack = tc->instance->gc_steal_stacks[slot];
+    }
+
     /* Do GC work for any work threads. */
     for (i = 0, n = tc->gc_work_count ; i < n; i++) {
         MVMThreadContext *other = tc->gc_work[i].tc;
@@ -287,8 +371,10 @@ static void run_gc(MVMThreadContext *tc, MVMuint8 what_to_do) {
         if (!other) continue;
 
         thread_obj = other->thread_obj;
+        other->gc_steal_stack = NULL;
 
         MVM_gc_collect_free_nursery_uncopied(other, tc->gc_work[i].limit);
+        MVM_gc_collect_size_nursery(other, tc->gc_work[i].limit);
 
         if (gen == MVMGCGenerations_Both) {
             GCDEBUG_LOG(tc, MVM_GC_DEBUG_ORCHESTRATE, "Thread %d run %d : freeing gen2 of thread %d\n", other->thread_id);
@@ -354,6 +440,13 @@ void MVM_gc_enter_from_allocator(MVMThreadContext *tc) {
         if (MVM_load(&tc->instance->gc_finish) != 0)
             MVM_panic(MVM_exitcode_gcorch, "finish votes was %d\n", MVM_load(&tc->instance->gc_finish));
 
+        /* Make sure there's a steal stack for every thread taking part. */
+        prepare_steal_stacks(tc, num_threads + 1);
+
+        /* Every thread is now at a safe point, so nothing they were reading
+         * before it is in use any more. */
+        MVM_gc_free_safepoint_queue(tc);
+
         /* gc_ack gets an extra so the final acknowledger
          * can also free the STables. */
         MVM_store(&tc->instance->gc_finish, num_threads + 1);
@@ -424,6 +517,7 @@ void MVM_gc_global_destruction(MVMThreadContext *tc) {
     nursery_tmp = tc->nursery_fromspace;
     tc->nursery_fromspace = tc->nursery_tospace;
     tc->nursery_tospace = nursery_tmp;
+    tc->nursery_fromspace_size = tc->nursery_tospace_size;
 
     /* Run the objects' finalizers */
     MVM_gc_collect_free_nursery_uncopied(tc, tc->nursery_alloc);
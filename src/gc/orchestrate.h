@@ -3,6 +3,15 @@ void MVM_gc_enter_from_interrupt(MVMThreadContext *tc);
 void MVM_gc_mark_thread_blocked(MVMThreadContext *tc);
 void MVM_gc_mark_thread_unblocked(MVMThreadContext *tc);
 void MVM_gc_global_destruction(MVMThreadContext *tc);
+void MVM_gc_free_steal_stacks(MVMThreadContext *tc);
+void MVM_gc_free_at_safepoint(MVMThreadContext *tc, void *to_free);
+void MVM_gc_free_safepoint_queue(MVMThreadContext *tc);
+
+/* A piece of memory waiting to be freed at a safe point. */
+struct MVMGCSafepointFree {
+    void               *to_free;
+    MVMGCSafepointFree *next;
+};
 
 struct MVMWorkThread {
     MVMThreadContext *tc;
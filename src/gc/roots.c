@@ -57,6 +57,9 @@ void MVM_gc_root_add_instance_roots_to_worklist(MVMThreadContext *tc, MVMGCWorkl
     HASH_ITER(hash_handle, tc->instance->loaded_compunits, current_lcun, tmp_lcun) {
         MVM_gc_worklist_add(tc, worklist, &current_lcun->filename);
     }
+
+    /* Objects held by asynchronous tasks. */
+    MVM_io_eventloop_gc_mark(tc, worklist);
 }
 
 /* Adds anything that is a root thanks to being referenced by a thread,
@@ -64,6 +67,7 @@ void MVM_gc_root_add_instance_roots_to_worklist(MVMThreadContext *tc, MVMGCWorkl
 void MVM_gc_root_add_tc_roots_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist) {
     /* Any active exception handlers. */
     MVMActiveHandler *cur_ah = tc->active_handlers;
+    MVMuint32 i;
     while (cur_ah != NULL) {
         MVM_gc_worklist_add(tc, worklist, &cur_ah->ex_obj);
         cur_ah = cur_ah->next_handler;
@@ -83,6 +87,10 @@ void MVM_gc_root_add_tc_roots_to_worklist(MVMThreadContext *tc, MVMGCWorklist *w
 
     /* Current dispatcher. */
     MVM_gc_worklist_add(tc, worklist, &tc->cur_dispatcher);
+
+    /* Names in the dynamic variable lookup cache. */
+    for (i = 0; i < MVM_DYNLEX_CACHE_SIZE; i++)
+        MVM_gc_worklist_add(tc, worklist, &tc->dynlex_cache[i].name);
 }
 
 /* Pushes a temporary root onto the thread-local roots list. */
@@ -157,6 +165,116 @@ void MVM_gc_root_gen2_add(MVMThreadContext *tc, MVMCollectable *c) {
     c->flags |= MVM_CF_IN_GEN2_ROOT_LIST;
 }
 
+/* Hashes a slot address for the remembered slot set. */
+#define SLOT_HASH(slot) ((MVMuint32)(((uintptr_t)(slot) >> 3) * 2654435761u))
+
+/* Puts a slot into a remembered slot table with room for it, unless it is
+ * already there. Returns whether it was added. */
+static MVMuint32 slot_insert(MVMGen2Slot *table, MVMuint32 alloc, MVMCollectable *root, MVMCollectable **slot) {
+    MVMuint32 mask = alloc - 1;
+    MVMuint32 i    = SLOT_HASH(slot) & mask;
+    while (table[i].slot) {
+        if (table[i].slot == slot)
+            return 0;
+        i = (i + 1) & mask;
+    }
+    table[i].root = root;
+    table[i].slot = slot;
+    return 1;
+}
+
+/* Replaces the remembered slot table with one of the given size holding
+ * the given entries. */
+static void slots_rebuild(MVMThreadContext *tc, MVMGen2Slot *entries, MVMuint32 num, MVMuint32 alloc) {
+    MVMGen2Slot *table = calloc(alloc, sizeof(MVMGen2Slot));
+    MVMuint32    i;
+    for (i = 0; i < num; i++)
+        slot_insert(table, alloc, entries[i].root, entries[i].slot);
+    free(tc->gen2slots);
+    tc->gen2slots       = table;
+    tc->alloc_gen2slots = alloc;
+    tc->num_gen2slots   = num;
+}
+
+/* Whether a remembered slot is still needed. After a full collection, we
+ * only drop slots of collectables found to be dead. When starting a nursery
+ * collection, we also drop those that no longer point into the nursery, and
+ * those of collectables in the gen2 roots list, as the whole of those will
+ * be visited anyway. */
+static MVMuint32 slot_needed(MVMGen2Slot *entry, MVMuint8 after_full) {
+    if (after_full)
+        return entry->root->flags & MVM_CF_GEN2_LIVE;
+    return !(entry->root->flags & MVM_CF_IN_GEN2_ROOT_LIST) && *entry->slot
+        && !((*entry->slot)->flags & MVM_CF_SECOND_GEN);
+}
+
+/* Rebuilds the remembered slot table with only the slots still needed,
+ * shrinking it if most of them went away. */
+static void slots_compact(MVMThreadContext *tc, MVMuint8 after_full) {
+    MVMGen2Slot *kept  = malloc(tc->num_gen2slots * sizeof(MVMGen2Slot));
+    MVMuint32    nkept = 0, alloc = tc->alloc_gen2slots, i;
+    for (i = 0; i < tc->alloc_gen2slots; i++) {
+        MVMGen2Slot *entry = &tc->gen2slots[i];
+        if (entry->slot && slot_needed(entry, after_full))
+            kept[nkept++] = *entry;
+    }
+    while (alloc > 64 && nkept * 8 < alloc)
+        alloc /= 2;
+    slots_rebuild(tc, kept, nkept, alloc);
+    free(kept);
+}
+
+/* Remembers a slot within a generation 2 collectable that now points to a
+ * nursery collectable. Unlike with MVM_gc_root_gen2_add, a nursery
+ * collection then visits just that slot, not everything the collectable
+ * references. The slot must lie within the collectable itself, so that it
+ * can't move or go away while the collectable lives. */
+void MVM_gc_root_gen2_slot_add(MVMThreadContext *tc, MVMCollectable *root, MVMCollectable **slot) {
+    assert(!(root->flags & MVM_CF_FORWARDER_VALID));
+
+    /* Keep the table at most half full. */
+    if ((tc->num_gen2slots + 1) * 2 > tc->alloc_gen2slots) {
+        MVMGen2Slot *old = tc->gen2slots;
+        MVMuint32    n   = tc->num_gen2slots, i, j = 0;
+        MVMGen2Slot *entries = malloc(n * sizeof(MVMGen2Slot));
+        for (i = 0; i < tc->alloc_gen2slots; i++)
+            if (old[i].slot)
+                entries[j++] = old[i];
+        slots_rebuild(tc, entries, n, tc->alloc_gen2slots * 2);
+        free(entries);
+    }
+
+    tc->num_gen2slots += slot_insert(tc->gen2slots, tc->alloc_gen2slots, root, slot);
+}
+
+/* Forgets remembered slots that are no longer needed, then adds the rest
+ * to the worklist. This must happen before the gen2 roots list is processed,
+ * as that may clear the flag saying a collectable is in it. */
+static void add_gen2_slots_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist) {
+    MVMuint32 i;
+    slots_compact(tc, 0);
+    for (i = 0; i < tc->alloc_gen2slots; i++)
+        if (tc->gen2slots[i].slot)
+            MVM_gc_worklist_add(tc, worklist, tc->gen2slots[i].slot);
+}
+
+/* Moves the remembered slots of a thread that is going away to another. */
+void MVM_gc_root_gen2_slots_transfer(MVMThreadContext *src, MVMThreadContext *dest) {
+    MVMuint32 i;
+    for (i = 0; i < src->alloc_gen2slots; i++)
+        if (src->gen2slots[i].slot)
+            MVM_gc_root_gen2_slot_add(dest, src->gen2slots[i].root, src->gen2slots[i].slot);
+    src->num_gen2slots   = 0;
+    src->alloc_gen2slots = 0;
+    MVM_checked_free_null(src->gen2slots);
+}
+
+/* Forgets remembered slots in collectables that a full collection found to
+ * be dead. */
+void MVM_gc_root_gen2_slots_cleanup(MVMThreadContext *tc) {
+    slots_compact(tc, 1);
+}
+
 /* Adds the set of thread-local inter-generational roots to a GC worklist. As
  * a side-effect, removes gen2 roots that no longer point to any nursery
  * items (usually because all the referenced objects also got promoted). */
@@ -183,7 +301,11 @@ void MVM_gc_root_add_gen2s_to_worklist(MVMThreadContext *tc, MVMGCWorklist *work
 
     /* Guess that we'll end up with around num_roots entries, to avoid some
      * worklist growth reallocations. */
-    MVM_gc_worklist_presize_for(tc, worklist, num_roots);
+    MVM_gc_worklist_presize_for(tc, worklist, num_roots + tc->num_gen2slots);
+
+    /* Remembered slots go first, while the gen2 root flags still say which
+     * collectables will be visited in full. */
+    add_gen2_slots_to_worklist(tc, worklist);
 
     /* Visit each gen2 root and... */
     for (i = 0; i < num_roots; i++) {
@@ -234,21 +356,6 @@ void MVM_gc_root_add_gen2s_to_worklist(MVMThreadContext *tc, MVMGCWorklist *work
     worklist->include_gen2 = orig_include_gen2;
 }
 
-/* Visits all of the roots in the gen2 list and removes those that have been
- * collected. Applied after a full collection. */
-void MVM_gc_root_gen2_cleanup(MVMThreadContext *tc) {
-    MVMCollectable **gen2roots    = tc->gen2roots;
-    MVMuint32        num_roots    = tc->num_gen2roots;
-    MVMuint32        cur_survivor = 0;
-    MVMuint32        i;
-    for (i = 0; i < num_roots; i++)
-        if (gen2roots[i]->flags & MVM_CF_GEN2_LIVE) {
-            assert(!(gen2roots[i]->flags & MVM_CF_FORWARDER_VALID));
-            gen2roots[cur_survivor++] = gen2roots[i];
-        }
-    tc->num_gen2roots = cur_survivor;
-}
-
 /* Walks frames and compilation units. Adds the roots it finds into the
  * GC worklist. */
 void MVM_gc_root_add_frame_roots_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist, MVMFrame *start_frame) {
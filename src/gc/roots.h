@@ -1,3 +1,10 @@
+/* A slot inside a generation 2 collectable that was made to point at a
+ * nursery collectable. */
+struct MVMGen2Slot {
+    MVMCollectable  *root;
+    MVMCollectable **slot;
+};
+
 /* Functions related to roots. */
 MVM_PUBLIC void MVM_gc_root_add_permanent(MVMThreadContext *tc, MVMCollectable **obj_ref);
 void MVM_gc_root_add_permanents_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist);
@@ -9,8 +16,10 @@ MVM_PUBLIC void MVM_gc_root_temp_pop_n(MVMThreadContext *tc, MVMuint32 n);
 void MVM_gc_root_temp_pop_all(MVMThreadContext *tc);
 void MVM_gc_root_add_temps_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist);
 void MVM_gc_root_gen2_add(MVMThreadContext *tc, MVMCollectable *c);
+void MVM_gc_root_gen2_slot_add(MVMThreadContext *tc, MVMCollectable *root, MVMCollectable **slot);
+void MVM_gc_root_gen2_slots_transfer(MVMThreadContext *src, MVMThreadContext *dest);
+void MVM_gc_root_gen2_slots_cleanup(MVMThreadContext *tc);
 void MVM_gc_root_add_gen2s_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist);
-void MVM_gc_root_gen2_cleanup(MVMThreadContext *tc);
 void MVM_gc_root_add_frame_roots_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist, MVMFrame *start_frame);
 
 /* Macros related to rooting objects into the temporaries list, and
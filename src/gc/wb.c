@@ -11,3 +11,17 @@ void MVM_gc_write_barrier_hit(MVMThreadContext *tc, MVMCollectable *update_root)
     if (!(update_root->flags & MVM_CF_IN_GEN2_ROOT_LIST))
         MVM_gc_root_gen2_add(tc, update_root);
 }
+
+/* Called when the slot-aware write barrier detects we need to trigger it.
+ * If the slot being written lies within the object itself, we remember
+ * just that slot, so a nursery GC need not re-scan all of the object's
+ * contents. Slots elsewhere, such as in storage the object owns, may be
+ * moved or freed, so for those we fall back to the whole object. */
+void MVM_gc_write_barrier_slot_hit(MVMThreadContext *tc, MVMCollectable *update_root, MVMCollectable **slot) {
+    if (update_root->flags & MVM_CF_IN_GEN2_ROOT_LIST)
+        return;
+    if ((char *)slot >= (char *)update_root && (char *)slot < (char *)update_root + update_root->size)
+        MVM_gc_root_gen2_slot_add(tc, update_root, slot);
+    else
+        MVM_gc_root_gen2_add(tc, update_root);
+}
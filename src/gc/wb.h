@@ -1,5 +1,6 @@
 /* Functions for if the write barriers are hit. */
 MVM_PUBLIC void MVM_gc_write_barrier_hit(MVMThreadContext *tc, MVMCollectable *update_root);
+MVM_PUBLIC void MVM_gc_write_barrier_slot_hit(MVMThreadContext *tc, MVMCollectable *update_root, MVMCollectable **slot);
 
 /* Ensures that if a generation 2 object comes to hold a reference to a
  * nursery object, then the generation 2 object becomes an inter-generational
@@ -9,13 +10,19 @@ MVM_STATIC_INLINE void MVM_gc_write_barrier(MVMThreadContext *tc, MVMCollectable
         MVM_gc_write_barrier_hit(tc, update_root);
 }
 
+/* As MVM_gc_write_barrier, but also given the address being written to, so
+ * that only that slot need be remembered if it's within the object. */
+MVM_STATIC_INLINE void MVM_gc_write_barrier_slot(MVMThreadContext *tc, MVMCollectable *update_root, MVMCollectable **slot, const MVMCollectable *referenced) {
+    if (((update_root->flags & MVM_CF_SECOND_GEN) && referenced && !(referenced->flags & MVM_CF_SECOND_GEN)))
+        MVM_gc_write_barrier_slot_hit(tc, update_root, slot);
+}
+
 /* Does an assignment, but makes sure the write barrier MVM_WB is applied
  * first. Takes the root object, the address within it we're writing to, and
- * the thing we're writing. Note that update_addr is not involved in the
- * write barrier. */
+ * the thing we're writing. */
 #define MVM_ASSIGN_REF(tc, update_root, update_addr, referenced) \
     { \
         void *_r = referenced; \
-        MVM_gc_write_barrier(tc, update_root, (MVMCollectable *)_r); \
+        MVM_gc_write_barrier_slot(tc, update_root, (MVMCollectable **)&(update_addr), (MVMCollectable *)_r); \
         update_addr = _r; \
     }
@@ -0,0 +1,428 @@
+#include "moar.h"
+
+/* Asynchronous operations. The functions taking a thread context are called
+ * by VM code: they set up a task and submit it to the event loop, returning
+ * its ID. Each task is then started on the event loop thread, by the code
+ * further down, and posts its completions to the queue it was given. */
+
+/* Checks that a type is one of a native array of bytes, so it can be used to
+ * hand back what was read. */
+static void check_buf_type(MVMThreadContext *tc, MVMObject *type, const char *op) {
+    MVMArrayREPRData *rd;
+    if (REPR(type)->ID != MVM_REPR_ID_MVMArray)
+        MVM_exception_throw_adhoc(tc, "%s requires a native array type", op);
+    rd = (MVMArrayREPRData *)STABLE(type)->REPR_data;
+    if (!rd || (rd->slot_type != MVM_ARRAY_I8 && rd->slot_type != MVM_ARRAY_U8))
+        MVM_exception_throw_adhoc(tc, "%s requires a native array of 8-bit integers", op);
+}
+
+MVMint64 MVM_io_async_timer(MVMThreadContext *tc, MVMObject *queue, MVMObject *schedulee, MVMint64 timeout, MVMint64 repeat) {
+    MVMAsyncTask *task;
+    if (timeout < 0 || repeat < 0)
+        MVM_exception_throw_adhoc(tc, "asynctimer requires a non-negative timeout and repeat");
+    task = MVM_io_eventloop_task_create(tc, MVM_ASYNC_TASK_TIMER, queue, schedulee, NULL);
+    task->timeout = timeout;
+    task->repeat  = repeat;
+    return MVM_io_eventloop_submit(tc, task);
+}
+
+MVMint64 MVM_io_async_listen(MVMThreadContext *tc, MVMObject *queue, MVMObject *schedulee, MVMString *host, MVMint64 port) {
+    struct sockaddr *addr = MVM_io_resolve_host_name(tc, host, port);
+    MVMAsyncTask    *task = MVM_io_eventloop_task_create(tc, MVM_ASYNC_TASK_LISTEN, queue, schedulee, NULL);
+    task->addr = addr;
+    return MVM_io_eventloop_submit(tc, task);
+}
+
+MVMint64 MVM_io_async_connect(MVMThreadContext *tc, MVMObject *queue, MVMObject *schedulee, MVMString *host, MVMint64 port) {
+    struct sockaddr *addr = MVM_io_resolve_host_name(tc, host, port);
+    MVMAsyncTask    *task = MVM_io_eventloop_task_create(tc, MVM_ASYNC_TASK_CONNECT, queue, schedulee, NULL);
+    task->addr = addr;
+    return MVM_io_eventloop_submit(tc, task);
+}
+
+MVMint64 MVM_io_async_read(MVMThreadContext *tc, MVMint64 conn_id, MVMObject *queue, MVMObject *schedulee, MVMObject *buf_type) {
+    MVMAsyncTask *task;
+    check_buf_type(tc, buf_type, "asyncread");
+    task = MVM_io_eventloop_task_create(tc, MVM_ASYNC_TASK_READ, queue, schedulee, buf_type);
+    task->conn_id = conn_id;
+    return MVM_io_eventloop_submit(tc, task);
+}
+
+MVMint64 MVM_io_async_write(MVMThreadContext *tc, MVMint64 conn_id, MVMObject *queue, MVMObject *schedulee, MVMObject *buf) {
+    MVMAsyncTask *task;
+    MVMArrayBody *body;
+    if (!IS_CONCRETE(buf))
+        MVM_exception_throw_adhoc(tc, "asyncwrite requires a concrete native array");
+    check_buf_type(tc, buf, "asyncwrite");
+    body = &((MVMArray *)buf)->body;
+    task = MVM_io_eventloop_task_create(tc, MVM_ASYNC_TASK_WRITE, queue, schedulee, NULL);
+    task->conn_id     = conn_id;
+    task->data_length = body->elems;
+    task->data        = malloc(body->elems ? body->elems : 1);
+    memcpy(task->data, body->slots.i8 + body->start, body->elems);
+    return MVM_io_eventloop_submit(tc, task);
+}
+
+MVMint64 MVM_io_async_readfile(MVMThreadContext *tc, MVMString *path, MVMObject *queue, MVMObject *schedulee, MVMObject *buf_type) {
+    char         *path_cstr;
+    MVMAsyncTask *task;
+    check_buf_type(tc, buf_type, "asyncreadfile");
+    path_cstr  = MVM_string_utf8_encode_C_string(tc, path);
+    task       = MVM_io_eventloop_task_create(tc, MVM_ASYNC_TASK_READFILE, queue, schedulee, buf_type);
+    task->path = path_cstr;
+    return MVM_io_eventloop_submit(tc, task);
+}
+
+MVMint64 MVM_io_async_shell(MVMThreadContext *tc, MVMString *cmd, MVMObject *queue, MVMObject *schedulee) {
+    char         *cmd_cstr = MVM_string_utf8_encode_C_string(tc, cmd);
+    MVMAsyncTask *task     = MVM_io_eventloop_task_create(tc, MVM_ASYNC_TASK_SHELL, queue, schedulee, NULL);
+    task->path = cmd_cstr;
+    return MVM_io_eventloop_submit(tc, task);
+}
+
+void MVM_io_async_cancel(MVMThreadContext *tc, MVMint64 id) {
+    MVM_io_eventloop_cancel(tc, id);
+}
+
+/* Everything from here on runs on the event loop thread. */
+
+/* Posts an error from libuv, and finishes with the task. */
+static void fail(MVMEventLoop *loop, MVMAsyncTask *task, const char *what, int status) {
+    char error[256];
+    snprintf(error, sizeof(error), "%s: %s", what, uv_strerror(status));
+    MVM_io_eventloop_post(loop, task, MVM_ASYNC_RESULT_NONE, 0, NULL, 0, error);
+    MVM_io_eventloop_task_done(loop, task);
+}
+
+/* Finds the connection a read or write works on. */
+static MVMAsyncTask * find_conn(MVMEventLoop *loop, MVMAsyncTask *task) {
+    MVMAsyncTask *conn = MVM_io_eventloop_task_find(loop, task->conn_id);
+    if (conn && (conn->kind == MVM_ASYNC_TASK_CONNECTION || conn->kind == MVM_ASYNC_TASK_CONNECT)
+            && conn->has_handle)
+        return conn;
+    MVM_io_eventloop_post(loop, task, MVM_ASYNC_RESULT_NONE, 0, NULL, 0, "No such connection");
+    MVM_io_eventloop_task_done(loop, task);
+    return NULL;
+}
+
+/* Timers. */
+static void on_timer(uv_timer_t *handle) {
+    MVMAsyncTask *task = (MVMAsyncTask *)handle->data;
+    MVM_io_eventloop_post(task->loop, task, MVM_ASYNC_RESULT_NONE, 0, NULL, 0, NULL);
+    if (!task->repeat)
+        MVM_io_eventloop_task_done(task->loop, task);
+}
+static void start_timer(MVMEventLoop *loop, MVMAsyncTask *task) {
+    uv_timer_init(loop->tc->loop, &task->handle.timer);
+    task->handle.timer.data = task;
+    task->has_handle        = 1;
+    uv_timer_start(&task->handle.timer, on_timer, task->timeout, task->repeat);
+}
+
+/* Connections. A connection accepted by a listener gets a task of its own,
+ * which posts nothing; a connect task becomes the connection once it has
+ * connected. Either way, the task ID identifies the connection to reads
+ * and writes. */
+static void on_connection(uv_stream_t *server, int status) {
+    MVMAsyncTask     *task = (MVMAsyncTask *)server->data;
+    MVMEventLoop     *loop = task->loop;
+    MVMThreadContext *tc   = loop->tc;
+    MVMAsyncTask     *conn;
+    int r;
+    if (status < 0) {
+        MVM_io_eventloop_post(loop, task, MVM_ASYNC_RESULT_NONE, 0, NULL, 0, uv_strerror(status));
+        return;
+    }
+    conn = calloc(1, sizeof(MVMAsyncTask));
+    conn->id        = MVM_incr(&loop->last_id) + 1;
+    conn->kind      = MVM_ASYNC_TASK_CONNECTION;
+    conn->loop      = loop;
+    conn->ref_count = 1;
+    uv_tcp_init(loop->tc->loop, &conn->handle.tcp);
+    conn->handle.tcp.data = conn;
+    conn->has_handle      = 1;
+    uv_mutex_lock(&loop->mutex_tasks);
+    conn->next = loop->tasks;
+    if (loop->tasks)
+        loop->tasks->prev = conn;
+    loop->tasks = conn;
+    uv_mutex_unlock(&loop->mutex_tasks);
+    HASH_ADD(hash_handle, loop->tasks_by_id, id, sizeof(MVMint64), conn);
+    if ((r = uv_accept(server, (uv_stream_t *)&conn->handle.tcp)) < 0) {
+        MVM_io_eventloop_post(loop, task, MVM_ASYNC_RESULT_NONE, 0, NULL, 0, uv_strerror(r));
+        MVM_io_eventloop_task_done(loop, conn);
+        return;
+    }
+    MVM_io_eventloop_post(loop, task, MVM_ASYNC_RESULT_INT, conn->id, NULL, 0, NULL);
+}
+static void start_listen(MVMEventLoop *loop, MVMAsyncTask *task) {
+    int r;
+    uv_tcp_init(loop->tc->loop, &task->handle.tcp);
+    task->handle.tcp.data = task;
+    task->has_handle      = 1;
+    if ((r = uv_tcp_bind(&task->handle.tcp, task->addr, 0)) < 0 ||
+            (r = uv_listen((uv_stream_t *)&task->handle.tcp, 128, on_connection)) < 0)
+        fail(loop, task, "Failed to listen", r);
+}
+
+static void on_connect(uv_connect_t *req, int status) {
+    MVMAsyncTask *task = (MVMAsyncTask *)req->data;
+    task->busy = 0;
+    if (task->done)
+        return;
+    if (status < 0)
+        fail(task->loop, task, "Failed to connect", status);
+    else
+        MVM_io_eventloop_post(task->loop, task, MVM_ASYNC_RESULT_INT, task->id, NULL, 0, NULL);
+}
+static void start_connect(MVMEventLoop *loop, MVMAsyncTask *task) {
+    int r;
+    uv_tcp_init(loop->tc->loop, &task->handle.tcp);
+    task->handle.tcp.data  = task;
+    task->has_handle       = 1;
+    task->connect_req.data = task;
+    if ((r = uv_tcp_connect(&task->connect_req, &task->handle.tcp, task->addr, on_connect)) < 0)
+        fail(loop, task, "Failed to connect", r);
+    else
+        task->busy = 1;
+}
+
+/* Reads from a connection. Each chunk read is posted as a buffer; the end
+ * of the stream is posted as a null result. */
+static void on_alloc(uv_handle_t *handle, size_t suggested_size, uv_buf_t *buf) {
+    buf->base = malloc(suggested_size);
+    buf->len  = suggested_size;
+}
+static void stop_reading(MVMAsyncTask *conn) {
+    MVMAsyncTask *reader = conn->reader;
+    uv_read_stop((uv_stream_t *)&conn->handle.tcp);
+    conn->reader = NULL;
+    reader->conn = NULL;
+    MVM_io_eventloop_task_done(reader->loop, reader);
+}
+static void on_read(uv_stream_t *handle, ssize_t nread, const uv_buf_t *buf) {
+    MVMAsyncTask *conn   = (MVMAsyncTask *)handle->data;
+    MVMAsyncTask *reader = conn->reader;
+    if (nread > 0) {
+        MVM_io_eventloop_post(reader->loop, reader, MVM_ASYNC_RESULT_BUF, 0, buf->base, nread, NULL);
+        return;
+    }
+    if (buf->base)
+        free(buf->base);
+    if (nread == UV_EOF) {
+        MVM_io_eventloop_post(reader->loop, reader, MVM_ASYNC_RESULT_NONE, 0, NULL, 0, NULL);
+        stop_reading(conn);
+    }
+    else if (nread < 0) {
+        MVM_io_eventloop_post(reader->loop, reader, MVM_ASYNC_RESULT_NONE, 0, NULL, 0, uv_strerror(nread));
+        stop_reading(conn);
+    }
+}
+static void start_read(MVMEventLoop *loop, MVMAsyncTask *task) {
+    MVMAsyncTask *conn = find_conn(loop, task);
+    int r;
+    if (!conn)
+        return;
+    if (conn->reader) {
+        MVM_io_eventloop_post(loop, task, MVM_ASYNC_RESULT_NONE, 0, NULL, 0, "Connection is already being read");
+        MVM_io_eventloop_task_done(loop, task);
+        return;
+    }
+    conn->reader = task;
+    task->conn   = conn;
+    if ((r = uv_read_start((uv_stream_t *)&conn->handle.tcp, on_alloc, on_read)) < 0) {
+        conn->reader = NULL;
+        task->conn   = NULL;
+        fail(loop, task, "Failed to read", r);
+    }
+}
+
+/* Writes to a connection, posting the number of bytes written. */
+static void on_write(uv_write_t *req, int status) {
+    MVMAsyncTask *task = (MVMAsyncTask *)req->data;
+    task->busy = 0;
+    if (task->done) {
+        MVM_io_eventloop_task_release(task->loop->tc, task);
+        return;
+    }
+    if (status < 0) {
+        fail(task->loop, task, "Failed to write", status);
+        return;
+    }
+    MVM_io_eventloop_post(task->loop, task, MVM_ASYNC_RESULT_INT, task->data_length, NULL, 0, NULL);
+    MVM_io_eventloop_task_done(task->loop, task);
+}
+static void start_write(MVMEventLoop *loop, MVMAsyncTask *task) {
+    MVMAsyncTask *conn = find_conn(loop, task);
+    uv_buf_t      buf;
+    int r;
+    if (!conn)
+        return;
+    buf.base             = task->data;
+    buf.len              = task->data_length;
+    task->write_req.data = task;
+    if ((r = uv_write(&task->write_req, (uv_stream_t *)&conn->handle.tcp, &buf, 1, on_write)) < 0)
+        fail(loop, task, "Failed to write", r);
+    else
+        task->busy = 1;
+}
+
+/* Reads a whole file, a chunk at a time, each posted as a buffer; the end
+ * of the file is posted as a null result. */
+static void close_file(MVMAsyncTask *task) {
+    uv_fs_t req;
+    uv_fs_close(task->loop->tc->loop, &req, task->fd, NULL);
+    uv_fs_req_cleanup(&req);
+}
+static void on_file_read(uv_fs_t *req);
+static void read_file_chunk(MVMAsyncTask *task) {
+    int r;
+    task->read_buf    = malloc(MVM_ASYNC_READ_CHUNK_SIZE);
+    task->fs_req.data = task;
+    if ((r = uv_fs_read(task->loop->tc->loop, &task->fs_req, task->fd, task->read_buf,
+            MVM_ASYNC_READ_CHUNK_SIZE, -1, on_file_read)) < 0) {
+        close_file(task);
+        fail(task->loop, task, "Failed to read file", r);
+    }
+    else {
+        task->busy = 1;
+    }
+}
+static void on_file_read(uv_fs_t *req) {
+    MVMAsyncTask *task   = (MVMAsyncTask *)req->data;
+    ssize_t       result = req->result;
+    uv_fs_req_cleanup(req);
+    task->busy = 0;
+    if (task->done) {
+        close_file(task);
+        MVM_io_eventloop_task_release(task->loop->tc, task);
+    }
+    else if (result < 0) {
+        close_file(task);
+        fail(task->loop, task, "Failed to read file", result);
+    }
+    else if (result == 0) {
+        close_file(task);
+        MVM_io_eventloop_post(task->loop, task, MVM_ASYNC_RESULT_NONE, 0, NULL, 0, NULL);
+        MVM_io_eventloop_task_done(task->loop, task);
+    }
+    else {
+        MVM_io_eventloop_post(task->loop, task, MVM_ASYNC_RESULT_BUF, 0, task->read_buf, result, NULL);
+        task->read_buf = NULL;
+        read_file_chunk(task);
+    }
+}
+static void on_file_open(uv_fs_t *req) {
+    MVMAsyncTask *task   = (MVMAsyncTask *)req->data;
+    ssize_t       result = req->result;
+    uv_fs_req_cleanup(req);
+    task->busy = 0;
+    if (result >= 0)
+        task->fd = (uv_file)result;
+    if (task->done) {
+        if (result >= 0)
+            close_file(task);
+        MVM_io_eventloop_task_release(task->loop->tc, task);
+    }
+    else if (result < 0) {
+        fail(task->loop, task, "Failed to open file", result);
+    }
+    else {
+        read_file_chunk(task);
+    }
+}
+static void start_readfile(MVMEventLoop *loop, MVMAsyncTask *task) {
+    int r;
+    task->fs_req.data = task;
+    if ((r = uv_fs_open(loop->tc->loop, &task->fs_req, task->path, O_RDONLY, 0, on_file_open)) < 0)
+        fail(loop, task, "Failed to open file", r);
+    else
+        task->busy = 1;
+}
+
+/* Runs a command through the shell, posting its exit status in the same
+ * form as the shell op returns it. */
+static void on_process_exit(uv_process_t *req, MVMint64 exit_status, int term_signal) {
+    MVMAsyncTask *task = (MVMAsyncTask *)req->data;
+    MVM_io_eventloop_post(task->loop, task, MVM_ASYNC_RESULT_INT,
+        (exit_status << 8) | term_signal, NULL, 0, NULL);
+    MVM_io_eventloop_task_done(task->loop, task);
+}
+static void start_shell(MVMEventLoop *loop, MVMAsyncTask *task) {
+    uv_process_options_t options = {0};
+    uv_stdio_container_t stdio[3];
+    char *args[4];
+    int   r;
+
+#ifdef _WIN32
+    args[0] = getenv("ComSpec");
+    args[1] = "/c";
+    args[2] = task->path;
+#else
+    args[0] = "/bin/sh";
+    args[1] = "-c";
+    args[2] = task->path;
+#endif
+    args[3] = NULL;
+
+    stdio[0].flags      = UV_IGNORE;
+    stdio[1].flags      = UV_INHERIT_FD;
+    stdio[1].data.fd    = 1;
+    stdio[2].flags      = UV_INHERIT_FD;
+    stdio[2].data.fd    = 2;
+    options.file        = args[0];
+    options.args        = args;
+    options.stdio       = stdio;
+    options.stdio_count = 3;
+    options.flags       = UV_PROCESS_WINDOWS_VERBATIM_ARGUMENTS | UV_PROCESS_WINDOWS_HIDE;
+    options.exit_cb     = on_process_exit;
+
+    task->handle.process.data = task;
+    if ((r = uv_spawn(loop->tc->loop, &task->handle.process, &options)) < 0) {
+        /* A handle that failed to spawn must still be closed. */
+        task->has_handle = 1;
+        fail(loop, task, "Failed to spawn", r);
+        return;
+    }
+    task->has_handle = 1;
+}
+
+/* Starts a task the VM submitted. */
+void MVM_io_async_start(MVMEventLoop *loop, MVMAsyncTask *task) {
+    switch (task->kind) {
+        case MVM_ASYNC_TASK_TIMER:    start_timer(loop, task);    break;
+        case MVM_ASYNC_TASK_LISTEN:   start_listen(loop, task);   break;
+        case MVM_ASYNC_TASK_CONNECT:  start_connect(loop, task);  break;
+        case MVM_ASYNC_TASK_READ:     start_read(loop, task);     break;
+        case MVM_ASYNC_TASK_WRITE:    start_write(loop, task);    break;
+        case MVM_ASYNC_TASK_READFILE: start_readfile(loop, task); break;
+        case MVM_ASYNC_TASK_SHELL:    start_shell(loop, task);    break;
+        default:
+            MVM_io_eventloop_task_done(loop, task);
+    }
+}
+
+/* Cancels a task. Timers stop, listeners and connections are closed (with
+ * the end of the stream posted to anything reading from a connection), a
+ * read stops reading, and a command is sent a signal to terminate. A write,
+ * connect or file read in flight is left to come back, but nothing more is
+ * posted for it. */
+void MVM_io_async_cancel_task(MVMEventLoop *loop, MVMAsyncTask *task) {
+    switch (task->kind) {
+        case MVM_ASYNC_TASK_CONNECT:
+        case MVM_ASYNC_TASK_CONNECTION:
+            if (task->reader) {
+                MVM_io_eventloop_post(loop, task->reader, MVM_ASYNC_RESULT_NONE, 0, NULL, 0, NULL);
+                stop_reading(task);
+            }
+            break;
+        case MVM_ASYNC_TASK_READ:
+            if (task->conn)
+                stop_reading(task->conn);
+            break;
+        case MVM_ASYNC_TASK_SHELL:
+            uv_process_kill(&task->handle.process, SIGTERM);
+            break;
+    }
+    MVM_io_eventloop_task_done(loop, task);
+}
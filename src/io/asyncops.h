@@ -0,0 +1,12 @@
+MVMint64 MVM_io_async_timer(MVMThreadContext *tc, MVMObject *queue, MVMObject *schedulee, MVMint64 timeout, MVMint64 repeat);
+MVMint64 MVM_io_async_listen(MVMThreadContext *tc, MVMObject *queue, MVMObject *schedulee, MVMString *host, MVMint64 port);
+MVMint64 MVM_io_async_connect(MVMThreadContext *tc, MVMObject *queue, MVMObject *schedulee, MVMString *host, MVMint64 port);
+MVMint64 MVM_io_async_read(MVMThreadContext *tc, MVMint64 conn_id, MVMObject *queue, MVMObject *schedulee, MVMObject *buf_type);
+MVMint64 MVM_io_async_write(MVMThreadContext *tc, MVMint64 conn_id, MVMObject *queue, MVMObject *schedulee, MVMObject *buf);
+MVMint64 MVM_io_async_readfile(MVMThreadContext *tc, MVMString *path, MVMObject *queue, MVMObject *schedulee, MVMObject *buf_type);
+MVMint64 MVM_io_async_shell(MVMThreadContext *tc, MVMString *cmd, MVMObject *queue, MVMObject *schedulee);
+void MVM_io_async_cancel(MVMThreadContext *tc, MVMint64 id);
+
+/* Called on the event loop thread. */
+void MVM_io_async_start(MVMEventLoop *loop, MVMAsyncTask *task);
+void MVM_io_async_cancel_task(MVMEventLoop *loop, MVMAsyncTask *task);
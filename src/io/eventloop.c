@@ -0,0 +1,315 @@
+#include "moar.h"
+
+/* Runs the libuv loop of the event loop thread until it is stopped. */
+static void loop_thread(void *data) {
+    MVMEventLoop *loop = (MVMEventLoop *)data;
+    uv_run(loop->tc->loop, UV_RUN_DEFAULT);
+}
+
+/* Takes the list of things to do, under the lock. */
+static MVMAsyncTodo * take_todo(MVMEventLoop *loop, MVMuint8 *stopping) {
+    MVMAsyncTodo *todo;
+    uv_mutex_lock(&loop->mutex_todo);
+    todo            = loop->todo_head;
+    loop->todo_head = NULL;
+    loop->todo_tail = NULL;
+    *stopping       = loop->stopping;
+    uv_mutex_unlock(&loop->mutex_todo);
+    return todo;
+}
+
+/* Called on the loop thread when it is woken up: starts new tasks (see
+ * asyncops.c for what each kind does), cancels those asked to be, and if
+ * the loop is being stopped, finishes with all the tasks it has and lets
+ * the loop run out. */
+static void wakeup_cb(uv_async_t *handle) {
+    MVMEventLoop     *loop = (MVMEventLoop *)handle->data;
+    MVMThreadContext *tc   = loop->tc;
+    MVMuint8          stopping;
+    MVMAsyncTodo     *todo = take_todo(loop, &stopping);
+    while (todo) {
+        MVMAsyncTodo *next = todo->next;
+        if (todo->task) {
+            HASH_ADD(hash_handle, loop->tasks_by_id, id, sizeof(MVMint64), todo->task);
+            MVM_io_async_start(loop, todo->task);
+        }
+        else {
+            MVMAsyncTask *task = MVM_io_eventloop_task_find(loop, todo->cancel_id);
+            if (task)
+                MVM_io_async_cancel_task(loop, task);
+        }
+        free(todo);
+        todo = next;
+    }
+    if (stopping) {
+        while (loop->tasks_by_id)
+            MVM_io_async_cancel_task(loop, loop->tasks_by_id);
+        uv_close((uv_handle_t *)&loop->wakeup, NULL);
+    }
+}
+
+/* Gets the event loop, starting it if this is the first time it's needed. */
+static MVMEventLoop * get_loop(MVMThreadContext *tc) {
+    MVMInstance  *instance = tc->instance;
+    MVMEventLoop *loop     = (MVMEventLoop *)MVM_load(&instance->event_loop);
+    if (loop)
+        return loop;
+
+    uv_mutex_lock(&instance->mutex_event_loop);
+    loop = instance->event_loop;
+    if (!loop) {
+        int r;
+        loop     = calloc(1, sizeof(MVMEventLoop));
+        loop->tc = MVM_tc_create(instance);
+        uv_mutex_init(&loop->mutex_todo);
+        uv_mutex_init(&loop->mutex_tasks);
+        uv_async_init(loop->tc->loop, &loop->wakeup, wakeup_cb);
+        loop->wakeup.data = loop;
+        if ((r = uv_thread_create(&loop->thread, loop_thread, loop)) < 0) {
+            uv_mutex_unlock(&instance->mutex_event_loop);
+            MVM_exception_throw_adhoc(tc, "Could not start event loop thread: %s", uv_strerror(r));
+        }
+        MVM_store(&instance->event_loop, loop);
+    }
+    uv_mutex_unlock(&instance->mutex_event_loop);
+    return loop;
+}
+
+/* Creates a task, which will post to the given queue. The task is known to
+ * the GC from here on, so the VM may allocate before submitting it. */
+MVMAsyncTask * MVM_io_eventloop_task_create(MVMThreadContext *tc, MVMuint32 kind,
+        MVMObject *queue, MVMObject *schedulee, MVMObject *buf_type) {
+    MVMEventLoop *loop = get_loop(tc);
+    MVMAsyncTask *task;
+    MVMConcBlockingQueueShared *shared = queue
+        ? MVM_concblockingqueue_shared(tc, queue)
+        : NULL;
+
+    task            = calloc(1, sizeof(MVMAsyncTask));
+    task->id        = MVM_incr(&loop->last_id) + 1;
+    task->kind      = kind;
+    task->loop      = loop;
+    task->ref_count = 1;
+    task->queue     = shared;
+    task->schedulee = schedulee;
+    task->buf_type  = buf_type;
+
+    uv_mutex_lock(&loop->mutex_tasks);
+    task->next = loop->tasks;
+    if (loop->tasks)
+        loop->tasks->prev = task;
+    loop->tasks = task;
+    uv_mutex_unlock(&loop->mutex_tasks);
+    return task;
+}
+
+/* Hands a task over to the event loop thread, returning its ID. */
+MVMint64 MVM_io_eventloop_submit(MVMThreadContext *tc, MVMAsyncTask *task) {
+    MVMEventLoop *loop = tc->instance->event_loop;
+    MVMAsyncTodo *todo = calloc(1, sizeof(MVMAsyncTodo));
+    MVMint64      id   = task->id;
+    todo->task = task;
+    uv_mutex_lock(&loop->mutex_todo);
+    if (loop->todo_tail)
+        loop->todo_tail->next = todo;
+    else
+        loop->todo_head = todo;
+    loop->todo_tail = todo;
+    uv_mutex_unlock(&loop->mutex_todo);
+    uv_async_send(&loop->wakeup);
+    return id;
+}
+
+/* Asks the event loop to cancel the task with the given ID. Nothing happens
+ * if the loop is already done with it. */
+void MVM_io_eventloop_cancel(MVMThreadContext *tc, MVMint64 id) {
+    MVMEventLoop *loop = get_loop(tc);
+    MVMAsyncTodo *todo = calloc(1, sizeof(MVMAsyncTodo));
+    todo->cancel_id = id;
+    uv_mutex_lock(&loop->mutex_todo);
+    if (loop->todo_tail)
+        loop->todo_tail->next = todo;
+    else
+        loop->todo_head = todo;
+    loop->todo_tail = todo;
+    uv_mutex_unlock(&loop->mutex_todo);
+    uv_async_send(&loop->wakeup);
+}
+
+/* Finds a task the loop is working on by ID. Loop thread only. */
+MVMAsyncTask * MVM_io_eventloop_task_find(MVMEventLoop *loop, MVMint64 id) {
+    MVMAsyncTask *task;
+    HASH_FIND(hash_handle, loop->tasks_by_id, &id, sizeof(MVMint64), task);
+    return task;
+}
+
+static void task_closed(uv_handle_t *handle) {
+    MVMAsyncTask *task = (MVMAsyncTask *)handle->data;
+    MVM_io_eventloop_task_release(task->loop->tc, task);
+}
+
+/* Called on the loop thread when it is done with a task. The task stops
+ * posting completions, lets go of its queue, and once any libuv handle it
+ * has is closed and any request in flight is back, the loop's reference to
+ * it is released. */
+void MVM_io_eventloop_task_done(MVMEventLoop *loop, MVMAsyncTask *task) {
+    if (task->done)
+        return;
+    task->done = 1;
+    HASH_DELETE(hash_handle, loop->tasks_by_id, task);
+    if (task->queue) {
+        MVM_concblockingqueue_release(loop->tc, task->queue);
+        task->queue = NULL;
+    }
+    if (task->has_handle)
+        uv_close((uv_handle_t *)&task->handle, task_closed);
+    else if (!task->busy)
+        MVM_io_eventloop_task_release(loop->tc, task);
+}
+
+/* Lets go of a reference to a task, freeing it if it was the last. The
+ * memory is only freed once the GC is next at a safe point, since a thread
+ * may be marking the task's objects. */
+void MVM_io_eventloop_task_release(MVMThreadContext *tc, MVMAsyncTask *task) {
+    MVMEventLoop *loop = task->loop;
+    if (MVM_decr(&task->ref_count) != 1)
+        return;
+
+    uv_mutex_lock(&loop->mutex_tasks);
+    if (task->prev)
+        task->prev->next = task->next;
+    else
+        loop->tasks = task->next;
+    if (task->next)
+        task->next->prev = task->prev;
+    uv_mutex_unlock(&loop->mutex_tasks);
+
+    if (task->queue)
+        MVM_concblockingqueue_release(tc, task->queue);
+    MVM_checked_free_null(task->addr);
+    MVM_checked_free_null(task->path);
+    MVM_checked_free_null(task->data);
+    MVM_checked_free_null(task->read_buf);
+    MVM_gc_free_at_safepoint(tc, task);
+}
+
+/* Posts a completion of a task to its queue; the completion takes over the
+ * bytes, and a copy of the error is made. Loop thread only. */
+void MVM_io_eventloop_post(MVMEventLoop *loop, MVMAsyncTask *task, MVMuint8 result_kind,
+        MVMint64 value, char *bytes, MVMint64 length, const char *error) {
+    MVMAsyncCompletion *completion;
+    if (!task->queue) {
+        MVM_checked_free_null(bytes);
+        return;
+    }
+    completion              = calloc(1, sizeof(MVMAsyncCompletion));
+    completion->task        = task;
+    completion->result_kind = result_kind;
+    completion->value       = value;
+    completion->bytes       = bytes;
+    completion->length      = length;
+    completion->error       = error ? strdup(error) : NULL;
+    MVM_incr(&task->ref_count);
+    MVM_concblockingqueue_post(task->queue, completion);
+}
+
+/* Turns a completion shifted from a queue into an array of the task's
+ * schedulee, the result and the error, freeing the completion. */
+MVMObject * MVM_io_eventloop_completion_to_object(MVMThreadContext *tc, MVMAsyncCompletion *completion) {
+    MVMAsyncTask *task   = completion->task;
+    MVMObject    *result = NULL;
+    MVMObject    *arr    = NULL;
+    MVMObject    *error  = NULL;
+
+    MVMROOT(tc, result, {
+    MVMROOT(tc, arr, {
+    MVMROOT(tc, error, {
+        switch (completion->result_kind) {
+            case MVM_ASYNC_RESULT_INT:
+                result = MVM_repr_box_int(tc, tc->instance->boot_types.BOOTInt,
+                    completion->value);
+                break;
+            case MVM_ASYNC_RESULT_BUF:
+                result = MVM_repr_alloc_init(tc, task->buf_type);
+                ((MVMArray *)result)->body.slots.i8 = (MVMint8 *)completion->bytes;
+                ((MVMArray *)result)->body.start    = 0;
+                ((MVMArray *)result)->body.ssize    = completion->length;
+                ((MVMArray *)result)->body.elems    = completion->length;
+                completion->bytes = NULL;
+                break;
+        }
+        if (completion->error)
+            error = MVM_repr_box_str(tc, tc->instance->boot_types.BOOTStr,
+                MVM_string_utf8_decode(tc, tc->instance->VMString,
+                    completion->error, strlen(completion->error)));
+        arr = MVM_repr_alloc_init(tc, tc->instance->boot_types.BOOTArray);
+        MVM_repr_push_o(tc, arr, task->schedulee);
+        MVM_repr_push_o(tc, arr, result);
+        MVM_repr_push_o(tc, arr, error);
+    });
+    });
+    });
+
+    MVM_io_eventloop_completion_free(tc, completion);
+    return arr;
+}
+
+/* Frees a completion, letting go of its task. */
+void MVM_io_eventloop_completion_free(MVMThreadContext *tc, MVMAsyncCompletion *completion) {
+    MVM_io_eventloop_task_release(tc, completion->task);
+    MVM_checked_free_null(completion->bytes);
+    MVM_checked_free_null(completion->error);
+    free(completion);
+}
+
+/* Marks the objects held by live tasks. */
+void MVM_io_eventloop_gc_mark(MVMThreadContext *tc, MVMGCWorklist *worklist) {
+    MVMEventLoop *loop = tc->instance->event_loop;
+    MVMAsyncTask *task;
+    if (!loop)
+        return;
+    uv_mutex_lock(&loop->mutex_tasks);
+    for (task = loop->tasks; task; task = task->next) {
+        MVM_gc_worklist_add(tc, worklist, &task->schedulee);
+        MVM_gc_worklist_add(tc, worklist, &task->buf_type);
+    }
+    uv_mutex_unlock(&loop->mutex_tasks);
+}
+
+/* Stops the event loop, if it was started: all tasks are cancelled, and we
+ * wait for the loop thread to finish with them. */
+void MVM_io_eventloop_stop(MVMInstance *instance) {
+    MVMEventLoop *loop = instance->event_loop;
+    if (!loop)
+        return;
+    uv_mutex_lock(&loop->mutex_todo);
+    loop->stopping = 1;
+    uv_mutex_unlock(&loop->mutex_todo);
+    uv_async_send(&loop->wakeup);
+    uv_thread_join(&loop->thread);
+}
+
+/* Frees the event loop, along with any tasks still around. Called once all
+ * objects are gone, by which time the loop is done with every task and has
+ * let go of its queue. */
+void MVM_io_eventloop_destroy(MVMInstance *instance) {
+    MVMEventLoop *loop = instance->event_loop;
+    MVMAsyncTask *task;
+    if (!loop)
+        return;
+    task = loop->tasks;
+    while (task) {
+        MVMAsyncTask *next = task->next;
+        MVM_checked_free_null(task->addr);
+        MVM_checked_free_null(task->path);
+        MVM_checked_free_null(task->data);
+        MVM_checked_free_null(task->read_buf);
+        free(task);
+        task = next;
+    }
+    uv_mutex_destroy(&loop->mutex_todo);
+    uv_mutex_destroy(&loop->mutex_tasks);
+    MVM_tc_destroy(loop->tc);
+    free(loop);
+    instance->event_loop = NULL;
+}
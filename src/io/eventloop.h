@@ -0,0 +1,151 @@
+/* Asynchronous I/O runs on an event loop thread, started the first time an
+ * asynchronous operation is requested. VM threads never touch its libuv
+ * loop: they describe the work in a task, queue it up and wake the loop
+ * thread, which does the work and posts each completion to the concurrent
+ * queue given when the task was set up. Code can then wait on that queue;
+ * a completion turns into an array of the schedulee given along with the
+ * queue, a result (an integer, a buffer or null) and an error (a string or
+ * null). */
+
+/* Kinds of task. */
+#define MVM_ASYNC_TASK_TIMER        1
+#define MVM_ASYNC_TASK_LISTEN       2
+#define MVM_ASYNC_TASK_CONNECT      3
+#define MVM_ASYNC_TASK_CONNECTION   4
+#define MVM_ASYNC_TASK_READ         5
+#define MVM_ASYNC_TASK_WRITE        6
+#define MVM_ASYNC_TASK_READFILE     7
+#define MVM_ASYNC_TASK_SHELL        8
+
+/* Kinds of completion result. */
+#define MVM_ASYNC_RESULT_NONE       0
+#define MVM_ASYNC_RESULT_INT        1
+#define MVM_ASYNC_RESULT_BUF        2
+
+/* Size of the buffer each read from a file is done into. */
+#define MVM_ASYNC_READ_CHUNK_SIZE   65536
+
+/* A piece of asynchronous work. Tasks are reference counted: the event loop
+ * holds one reference until it is done with the task (and has closed any
+ * libuv handle it has), and each completion not yet shifted from a queue
+ * holds another. */
+struct MVMAsyncTask {
+    /* ID handed out to identify the task to VM code. */
+    MVMint64 id;
+
+    /* What kind of task this is, and the loop it runs on. */
+    MVMuint32     kind;
+    MVMEventLoop *loop;
+
+    /* Set once the loop is done with the task, or asked to cancel it. */
+    MVMuint8 done;
+
+    /* Set while a libuv request that refers to the task is in flight; the
+     * loop lets go of the task only once it has come back. */
+    MVMuint8 busy;
+
+    /* Number of references to the task. */
+    AO_t ref_count;
+
+    /* Where completions go, what is handed back with each, and the type of
+     * buffer to read into, if any. The objects are marked as roots for as
+     * long as the task lives. */
+    MVMConcBlockingQueueShared *queue;
+    MVMObject *schedulee;
+    MVMObject *buf_type;
+
+    /* What the task works on: the connection for reads and writes, an
+     * address for listens and connects, a path or command, timings in
+     * milliseconds for timers, and the data to write. */
+    MVMint64         conn_id;
+    struct sockaddr *addr;
+    char            *path;
+    MVMint64         timeout;
+    MVMint64         repeat;
+    char            *data;
+    size_t           data_length;
+
+    /* libuv state. */
+    union {
+        uv_timer_t   timer;
+        uv_tcp_t     tcp;
+        uv_process_t process;
+    } handle;
+    MVMuint8     has_handle;
+    uv_connect_t connect_req;
+    uv_write_t   write_req;
+    uv_fs_t      fs_req;
+    uv_file      fd;
+    char        *read_buf;
+
+    /* For a connection, the read task reading from it, if any; for a read
+     * or write, the connection it works on. */
+    MVMAsyncTask *reader;
+    MVMAsyncTask *conn;
+
+    /* Links in the list of live tasks. */
+    MVMAsyncTask *prev;
+    MVMAsyncTask *next;
+
+    /* Entry in the event loop's table of tasks by ID. */
+    UT_hash_handle hash_handle;
+};
+
+/* A completion of (a step of) a task, on its way to a queue. */
+struct MVMAsyncCompletion {
+    MVMAsyncTask *task;
+    MVMuint8      result_kind;
+    MVMint64      value;
+    char         *bytes;
+    MVMint64      length;
+    char         *error;
+};
+
+/* Something for the event loop thread to do: a task to start, or the ID of
+ * one to cancel. */
+struct MVMAsyncTodo {
+    MVMAsyncTask *task;
+    MVMint64      cancel_id;
+    MVMAsyncTodo *next;
+};
+
+/* The event loop. */
+struct MVMEventLoop {
+    /* Thread context for the loop thread. It never runs VM code; it is
+     * used for its libuv loop. */
+    MVMThreadContext *tc;
+    uv_thread_t       thread;
+
+    /* Wakes the loop thread when there is something to do, and the list of
+     * things to do. */
+    uv_async_t    wakeup;
+    uv_mutex_t    mutex_todo;
+    MVMAsyncTodo *todo_head;
+    MVMAsyncTodo *todo_tail;
+    MVMuint8      stopping;
+
+    /* All live tasks, so their objects can be marked. */
+    uv_mutex_t    mutex_tasks;
+    MVMAsyncTask *tasks;
+
+    /* Tasks the loop is working on, by ID. Only used by the loop thread. */
+    MVMAsyncTask *tasks_by_id;
+
+    /* Last task ID handed out. */
+    AO_t last_id;
+};
+
+MVMAsyncTask * MVM_io_eventloop_task_create(MVMThreadContext *tc, MVMuint32 kind,
+    MVMObject *queue, MVMObject *schedulee, MVMObject *buf_type);
+MVMint64 MVM_io_eventloop_submit(MVMThreadContext *tc, MVMAsyncTask *task);
+void MVM_io_eventloop_cancel(MVMThreadContext *tc, MVMint64 id);
+MVMAsyncTask * MVM_io_eventloop_task_find(MVMEventLoop *loop, MVMint64 id);
+void MVM_io_eventloop_task_done(MVMEventLoop *loop, MVMAsyncTask *task);
+void MVM_io_eventloop_post(MVMEventLoop *loop, MVMAsyncTask *task, MVMuint8 result_kind,
+    MVMint64 value, char *bytes, MVMint64 length, const char *error);
+void MVM_io_eventloop_task_release(MVMThreadContext *tc, MVMAsyncTask *task);
+MVMObject * MVM_io_eventloop_completion_to_object(MVMThreadContext *tc, MVMAsyncCompletion *completion);
+void MVM_io_eventloop_completion_free(MVMThreadContext *tc, MVMAsyncCompletion *completion);
+void MVM_io_eventloop_gc_mark(MVMThreadContext *tc, MVMGCWorklist *worklist);
+void MVM_io_eventloop_stop(MVMInstance *instance);
+void MVM_io_eventloop_destroy(MVMInstance *instance);
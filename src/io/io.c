@@ -80,6 +80,8 @@ void MVM_io_read_bytes(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *res
     if (((MVMArrayREPRData *)STABLE(result)->REPR_data)->slot_type != MVM_ARRAY_U8
         && ((MVMArrayREPRData *)STABLE(result)->REPR_data)->slot_type != MVM_ARRAY_I8)
         MVM_exception_throw_adhoc(tc, "read_fhb requires a native array of uint8 or int8");
+    if (((MVMArray *)result)->body.mapping)
+        MVM_exception_throw_adhoc(tc, "read_fhb cannot read into a memory-mapped array");
 
     if (length < 1 || length > 99999999)
         MVM_exception_throw_adhoc(tc, "read from filehandle length out of range");
@@ -199,3 +201,27 @@ MVMObject * MVM_io_accept(MVMThreadContext *tc, MVMObject *oshandle) {
     else
         MVM_exception_throw_adhoc(tc, "Cannot accept this kind of handle");
 }
+
+/* Makes a native array of bytes a read-only view of part of the file a
+ * handle is for, without copying it. The array must be empty, or already
+ * such a view, in which case it moves to the new window; this way a large
+ * file can be scanned a window at a time. */
+void MVM_io_map(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *result, MVMint64 offset, MVMint64 length) {
+    MVMOSHandle     *handle = verify_is_handle(tc, oshandle, "map");
+    MVMArrayMapping *mapping;
+
+    /* Ensure the target is in the correct form. */
+    if (!IS_CONCRETE(result) || REPR(result)->ID != MVM_REPR_ID_MVMArray)
+        MVM_exception_throw_adhoc(tc, "mmapfh requires a native array to map into");
+    if (((MVMArrayREPRData *)STABLE(result)->REPR_data)->slot_type != MVM_ARRAY_U8
+        && ((MVMArrayREPRData *)STABLE(result)->REPR_data)->slot_type != MVM_ARRAY_I8)
+        MVM_exception_throw_adhoc(tc, "mmapfh requires a native array of uint8 or int8");
+    if (((MVMArray *)result)->body.slots.any && !((MVMArray *)result)->body.mapping)
+        MVM_exception_throw_adhoc(tc, "mmapfh requires an empty array");
+
+    if (handle->body.ops->mappable)
+        mapping = handle->body.ops->mappable->map(tc, handle, offset, &length);
+    else
+        MVM_exception_throw_adhoc(tc, "Cannot map this kind of handle");
+    MVM_array_set_mapping(tc, result, mapping, length);
+}
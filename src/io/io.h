@@ -10,6 +10,7 @@ struct MVMIOOps {
     const MVMIOSockety      *sockety;
     const MVMIOInteractive  *interactive;
     const MVMIOLockable     *lockable;
+    const MVMIOMappable     *mappable;
 
     /* How to mark the handle's data, if needed. */
     void (*gc_mark) (MVMThreadContext *tc, void *data, MVMGCWorklist *worklist);
@@ -70,6 +71,13 @@ struct MVMIOLockable {
     void (*unlock) (MVMThreadContext *tc, MVMOSHandle *h);
 };
 
+/* I/O operations on handles that can be memory-mapped. Maps length bytes
+ * starting at offset (or all from offset on, if length is negative), read
+ * only. */
+struct MVMIOMappable {
+    MVMArrayMapping * (*map) (MVMThreadContext *tc, MVMOSHandle *h, MVMint64 offset, MVMint64 *length);
+};
+
 void MVM_io_close(MVMThreadContext *tc, MVMObject *oshandle);
 void MVM_io_set_encoding(MVMThreadContext *tc, MVMObject *oshandle, MVMString *encoding_name);
 void MVM_io_seek(MVMThreadContext *tc, MVMObject *oshandle, MVMint64 offset, MVMint64 flag);
@@ -89,3 +97,4 @@ void MVM_io_truncate(MVMThreadContext *tc, MVMObject *oshandle, MVMint64 offset)
 void MVM_io_connect(MVMThreadContext *tc, MVMObject *oshandle, MVMString *host, MVMint64 port);
 void MVM_io_bind(MVMThreadContext *tc, MVMObject *oshandle, MVMString *host, MVMint64 port);
 MVMObject * MVM_io_accept(MVMThreadContext *tc, MVMObject *oshandle);
+void MVM_io_map(MVMThreadContext *tc, MVMObject *oshandle, MVMObject *result, MVMint64 offset, MVMint64 length);
@@ -1,5 +1,6 @@
 #include "moar.h"
 #include "platform/io.h"
+#include "platform/mmap.h"
 
 /* Here we implement synchronous file I/O. It's done using libuv's file I/O
  * functions, without specifying callbacks, thus easily giving synchronous
@@ -340,6 +341,50 @@ void unlock(MVMThreadContext *tc, MVMOSHandle *h) {
 #endif
 }
 
+/* Maps part of the file into memory, read only. The mapping has to start on
+ * a boundary the platform dictates, so it may take in some bytes before the
+ * offset asked for. The mapping stays valid after the handle is closed. */
+static MVMArrayMapping * map(MVMThreadContext *tc, MVMOSHandle *h, MVMint64 offset, MVMint64 *length) {
+    MVMIOFileData   *data = (MVMIOFileData *)h->body.data;
+    MVMArrayMapping *mapping;
+    MVMuint64        size, granularity, aligned;
+    uv_fs_t          req;
+
+    if (data->fd == -1)
+        MVM_exception_throw_adhoc(tc, "Cannot map a closed filehandle");
+    if (uv_fs_fstat(tc->loop, &req, data->fd, NULL) < 0)
+        MVM_exception_throw_adhoc(tc, "Failed to map filehandle: %s", uv_strerror(req.result));
+    size = req.statbuf.st_size;
+    uv_fs_req_cleanup(&req);
+
+    if (offset < 0 || (MVMuint64)offset > size)
+        MVM_exception_throw_adhoc(tc, "Cannot map from offset %lld of a file of %llu bytes",
+            offset, size);
+    if (*length < 0)
+        *length = size - offset;
+    else if ((MVMuint64)*length > size - offset)
+        MVM_exception_throw_adhoc(tc, "Cannot map %lld bytes from offset %lld of a file of %llu bytes",
+            *length, offset, size);
+
+    granularity = MVM_platform_map_granularity();
+    aligned     = offset - offset % granularity;
+    if ((MVMuint64)(offset - aligned) + *length > (MVMuint64)(size_t)-1)
+        MVM_exception_throw_adhoc(tc, "Cannot map %lld bytes at once; map a smaller window", *length);
+
+    mapping        = calloc(1, sizeof(MVMArrayMapping));
+    mapping->start = offset - aligned;
+    mapping->size  = mapping->start + *length;
+    if (*length > 0) {
+        mapping->block = MVM_platform_map_file_range(data->fd, &mapping->handle,
+            aligned, mapping->size, 0);
+        if (!mapping->block) {
+            free(mapping);
+            MVM_exception_throw_adhoc(tc, "Failed to map filehandle into memory");
+        }
+    }
+    return mapping;
+}
+
 /* Frees data associated with the handle. */
 static void gc_free(MVMThreadContext *tc, MVMObject *h, void *d) {
     MVMIOFileData *data = (MVMIOFileData *)d;
@@ -359,6 +404,7 @@ static const MVMIOSyncReadable sync_readable = { set_separator, read_line, slurp
 static const MVMIOSyncWritable sync_writable = { write_str, write_bytes, flush, truncatefh };
 static const MVMIOSeekable     seekable      = { seek, tell };
 static const MVMIOLockable     lockable      = { lock, unlock };
+static const MVMIOMappable     mappable      = { map };
 static const MVMIOOps op_table = {
     &closable,
     &encodable,
@@ -368,6 +414,7 @@ static const MVMIOOps op_table = {
     NULL,
     NULL,
     &lockable,
+    &mappable,
     NULL,
     gc_free
 };
@@ -35,7 +35,7 @@ static void gc_free(MVMThreadContext *tc, MVMObject *h, void *d) {
     do_close(tc, data);
 }
 
-static struct sockaddr * resolve_host_name(MVMThreadContext *tc, MVMString *host, MVMint64 port) {
+struct sockaddr * MVM_io_resolve_host_name(MVMThreadContext *tc, MVMString *host, MVMint64 port) {
     char *host_cstr = MVM_string_utf8_encode_C_string(tc, host);
     struct sockaddr *dest = malloc(sizeof(struct sockaddr));
     struct addrinfo *result;
@@ -68,7 +68,7 @@ static void on_connect(uv_connect_t* req, int status) {
 static void socket_connect(MVMThreadContext *tc, MVMOSHandle *h, MVMString *host, MVMint64 port) {
     MVMIOSyncSocketData *data = (MVMIOSyncSocketData *)h->body.data;
     if (!data->ss.handle) {
-        struct sockaddr *dest    = resolve_host_name(tc, host, port);
+        struct sockaddr *dest    = MVM_io_resolve_host_name(tc, host, port);
         uv_tcp_t        *socket  = malloc(sizeof(uv_tcp_t));
         uv_connect_t    *connect = malloc(sizeof(uv_connect_t));
         int r;
@@ -106,7 +106,7 @@ static void on_connection(uv_stream_t *server, int status) {
 static void socket_bind(MVMThreadContext *tc, MVMOSHandle *h, MVMString *host, MVMint64 port) {
     MVMIOSyncSocketData *data = (MVMIOSyncSocketData *)h->body.data;
     if (!data->ss.handle) {
-        struct sockaddr *dest    = resolve_host_name(tc, host, port);
+        struct sockaddr *dest    = MVM_io_resolve_host_name(tc, host, port);
         uv_tcp_t        *socket  = malloc(sizeof(uv_tcp_t));
         int r;
 
@@ -161,6 +161,7 @@ static const MVMIOOps op_table = {
     NULL,
     NULL,
     NULL,
+    NULL,
     gc_free
 };
 
@@ -1,2 +1,3 @@
 MVMObject * MVM_io_socket_create(MVMThreadContext *tc, MVMint64 listen);
 MVMString * MVM_io_get_hostname(MVMThreadContext *tc);
+struct sockaddr * MVM_io_resolve_host_name(MVMThreadContext *tc, MVMString *host, MVMint64 port);
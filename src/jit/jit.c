@@ -0,0 +1,564 @@
+#include "moar.h"
+#include "platform/mmap.h"
+
+#if MVM_JIT_SUPPORTED
+
+/* Machine registers, as numbered in x86-64 instruction encodings. While in
+ * compiled code, rbx holds the thread context and r12 the frame's register
+ * base; rax, rcx and xmm0/xmm1 are scratch. */
+#define RAX 0
+#define RCX 1
+
+/* Condition codes, as used by jcc and setcc. */
+#define CC_B    0x2
+#define CC_AE   0x3
+#define CC_E    0x4
+#define CC_NE   0x5
+#define CC_A    0x7
+#define CC_P    0xA
+#define CC_NP   0xB
+#define CC_L    0xC
+#define CC_GE   0xD
+#define CC_LE   0xE
+#define CC_G    0xF
+
+/* A branch whose 32-bit displacement must be filled in once we know where
+ * the target op's code is. */
+typedef struct {
+    MVMuint32 patch_pos;
+    MVMuint32 target;
+} Fixup;
+
+/* State while compiling a frame. */
+typedef struct {
+    MVMuint8  *buf;
+    MVMuint32  len;
+    MVMuint32  alloc;
+
+    Fixup     *fixups;
+    MVMuint32  num_fixups;
+    MVMuint32  alloc_fixups;
+
+    /* Where the shared epilogue lives. */
+    MVMuint32  epilogue;
+
+    /* The bytecode the interpreter will be running. */
+    MVMuint8  *bytecode;
+} Emitter;
+
+static void emit_byte(Emitter *e, MVMuint8 b) {
+    if (e->len == e->alloc) {
+        e->alloc *= 2;
+        e->buf = realloc(e->buf, e->alloc);
+    }
+    e->buf[e->len++] = b;
+}
+static void emit_bytes(Emitter *e, const char *bytes, MVMuint32 n) {
+    MVMuint32 i;
+    for (i = 0; i < n; i++)
+        emit_byte(e, (MVMuint8)bytes[i]);
+}
+static void emit_i32(Emitter *e, MVMint32 v) {
+    MVMuint32 u = (MVMuint32)v;
+    emit_byte(e, u & 0xFF);
+    emit_byte(e, (u >> 8) & 0xFF);
+    emit_byte(e, (u >> 16) & 0xFF);
+    emit_byte(e, (u >> 24) & 0xFF);
+}
+static void emit_u64(Emitter *e, MVMuint64 v) {
+    emit_i32(e, (MVMint32)(v & 0xFFFFFFFF));
+    emit_i32(e, (MVMint32)(v >> 32));
+}
+static void patch_i32(Emitter *e, MVMuint32 pos, MVMint32 v) {
+    MVMuint32 u = (MVMuint32)v;
+    e->buf[pos]     = u & 0xFF;
+    e->buf[pos + 1] = (u >> 8) & 0xFF;
+    e->buf[pos + 2] = (u >> 16) & 0xFF;
+    e->buf[pos + 3] = (u >> 24) & 0xFF;
+}
+
+/* Emits an instruction taking a frame register, [r12 + reg * 8], as its
+ * memory operand. prefix is a mandatory prefix (0 for none), and wide
+ * selects a 64-bit operand size. */
+static void emit_mem(Emitter *e, MVMuint8 prefix, MVMuint8 wide, const char *opcode,
+        MVMuint32 opcode_len, MVMuint8 modrm_reg, MVMuint16 reg) {
+    if (prefix)
+        emit_byte(e, prefix);
+    emit_byte(e, wide ? 0x49 : 0x41);
+    emit_bytes(e, opcode, opcode_len);
+    emit_byte(e, 0x84 | (modrm_reg << 3));
+    emit_byte(e, 0x24);
+    emit_i32(e, reg * sizeof(MVMRegister));
+}
+#define LOAD(e, mreg, reg)     emit_mem(e, 0, 1, "\x8B", 1, mreg, reg)
+#define STORE(e, mreg, reg)    emit_mem(e, 0, 1, "\x89", 1, mreg, reg)
+#define LOAD_XMM0(e, reg)      emit_mem(e, 0xF2, 0, "\x0F\x10", 2, 0, reg)
+#define STORE_XMM0(e, reg)     emit_mem(e, 0xF2, 0, "\x0F\x11", 2, 0, reg)
+#define UCOMISD_XMM0(e, reg)   emit_mem(e, 0x66, 0, "\x0F\x2E", 2, 0, reg)
+
+/* Stores al, zero- or sign-extended, into a frame register. */
+static void emit_store_al(Emitter *e, MVMuint16 reg, MVMuint8 sign) {
+    if (sign)
+        emit_bytes(e, "\x48\x0F\xBE\xC0", 4);   /* movsx rax, al */
+    else
+        emit_bytes(e, "\x0F\xB6\xC0", 3);       /* movzx eax, al */
+    STORE(e, RAX, reg);
+}
+static void emit_setcc(Emitter *e, MVMuint8 cc, MVMuint8 mreg) {
+    emit_byte(e, 0x0F);
+    emit_byte(e, 0x90 | cc);
+    emit_byte(e, 0xC0 | mreg);
+}
+
+/* Leaves compiled code, resuming the interpreter at the given offset. */
+static void emit_exit(Emitter *e, MVMuint32 offset) {
+    emit_byte(e, 0xB8);                          /* mov eax, imm32 */
+    emit_i32(e, (MVMint32)offset);
+    emit_byte(e, 0xE9);                          /* jmp epilogue */
+    emit_i32(e, (MVMint32)(e->epilogue - (e->len + 4)));
+}
+
+/* Emits a jump (or conditional jump, unless cc is negative) to the code
+ * for the op at the given bytecode offset, to be fixed up later. */
+static void emit_jump_to_op(Emitter *e, MVMint32 cc, MVMuint32 target) {
+    if (cc < 0) {
+        emit_byte(e, 0xE9);
+    }
+    else {
+        emit_byte(e, 0x0F);
+        emit_byte(e, 0x80 | cc);
+    }
+    if (e->num_fixups == e->alloc_fixups) {
+        e->alloc_fixups = e->alloc_fixups ? e->alloc_fixups * 2 : 16;
+        e->fixups = realloc(e->fixups, e->alloc_fixups * sizeof(Fixup));
+    }
+    e->fixups[e->num_fixups].patch_pos = e->len;
+    e->fixups[e->num_fixups].target    = target;
+    e->num_fixups++;
+    emit_i32(e, 0);
+}
+
+/* Emits a branch to the op at target. Backward branches are GC safepoints:
+ * if a GC is pending, we go back to the interpreter, which will join in
+ * the collection before it re-enters compiled code at the target. */
+static void emit_branch(Emitter *e, MVMint32 cc, MVMuint32 target, MVMuint32 pos) {
+    if (target > pos) {
+        emit_jump_to_op(e, cc, target);
+    }
+    else {
+        MVMuint32 skip = 0;
+        if (cc >= 0) {
+            /* Jump over the branch if the condition does not hold. */
+            emit_byte(e, 0x0F);
+            emit_byte(e, 0x80 | (cc ^ 1));
+            skip = e->len;
+            emit_i32(e, 0);
+        }
+        emit_bytes(e, "\x48\x8B\x83", 3);        /* mov rax, [rbx + gc_status] */
+        emit_i32(e, offsetof(MVMThreadContext, gc_status));
+        emit_bytes(e, "\x48\x85\xC0", 3);        /* test rax, rax */
+        emit_jump_to_op(e, CC_E, target);
+        emit_exit(e, target);
+        if (cc >= 0)
+            patch_i32(e, skip, (MVMint32)(e->len - (skip + 4)));
+    }
+}
+
+/* Makes the interpreter's current op point into the op at pos, so that an
+ * exception thrown from a helper is attributed to it. */
+static void emit_sync_cur_op(Emitter *e, MVMuint32 pos) {
+    emit_bytes(e, "\x48\x8B\x83", 3);            /* mov rax, [rbx + interp_cur_op] */
+    emit_i32(e, offsetof(MVMThreadContext, interp_cur_op));
+    emit_bytes(e, "\x48\xB9", 2);                /* mov rcx, imm64 */
+    emit_u64(e, (MVMuint64)(uintptr_t)(e->bytecode + pos + 2));
+    emit_bytes(e, "\x48\x89\x08", 3);            /* mov [rax], rcx */
+}
+
+/* Calls a helper taking just the thread context. */
+static void emit_call_tc(Emitter *e, void *func) {
+    emit_bytes(e, "\x48\x89\xDF", 3);            /* mov rdi, rbx */
+    emit_bytes(e, "\x48\xB8", 2);                /* mov rax, imm64 */
+    emit_u64(e, (MVMuint64)(uintptr_t)func);
+    emit_bytes(e, "\xFF\xD0", 2);                /* call rax */
+}
+
+static void outer_out_of_range(MVMThreadContext *tc) {
+    MVM_exception_throw_adhoc(tc, "getlex: outer index out of range");
+}
+
+/* Leaves the frame holding the lexical in rax, walking outers as needed. */
+static void emit_lex_frame(Emitter *e, MVMuint16 outers, MVMuint32 pos) {
+    emit_bytes(e, "\x48\x8B\x83", 3);            /* mov rax, [rbx + cur_frame] */
+    emit_i32(e, offsetof(MVMThreadContext, cur_frame));
+    while (outers--) {
+        MVMuint32 skip;
+        emit_bytes(e, "\x48\x8B\x80", 3);        /* mov rax, [rax + outer] */
+        emit_i32(e, offsetof(MVMFrame, outer));
+        emit_bytes(e, "\x48\x85\xC0", 3);        /* test rax, rax */
+        emit_bytes(e, "\x75", 1);                /* jnz over the throw */
+        skip = e->len;
+        emit_byte(e, 0);
+        emit_sync_cur_op(e, pos);
+        emit_call_tc(e, (void *)outer_out_of_range);
+        e->buf[skip] = (MVMuint8)(e->len - (skip + 1));
+    }
+    emit_bytes(e, "\x48\x8B\x80", 3);            /* mov rax, [rax + env] */
+    emit_i32(e, offsetof(MVMFrame, env));
+}
+
+/* Loads the truthiness of a num register into al, matching the
+ * interpreter's "!= 0.0" (so NaN is true). */
+static void emit_num_truth(Emitter *e, MVMuint16 reg) {
+    emit_bytes(e, "\x66\x0F\x57\xC9", 4);        /* xorpd xmm1, xmm1 */
+    LOAD_XMM0(e, reg);
+    emit_bytes(e, "\x66\x0F\x2E\xC1", 4);        /* ucomisd xmm0, xmm1 */
+    emit_setcc(e, CC_NE, RAX);
+    emit_setcc(e, CC_P, RCX);
+    emit_bytes(e, "\x08\xC8", 2);                /* or al, cl */
+}
+
+/* Checks if we know how to compile an op. */
+static MVMint64 is_supported(MVMuint16 op) {
+    switch (op) {
+        case MVM_OP_no_op:
+        case MVM_OP_const_i64: case MVM_OP_const_n64:
+        case MVM_OP_set:
+        case MVM_OP_add_i: case MVM_OP_sub_i: case MVM_OP_mul_i:
+        case MVM_OP_band_i: case MVM_OP_bor_i: case MVM_OP_bxor_i:
+        case MVM_OP_blshift_i: case MVM_OP_brshift_i:
+        case MVM_OP_neg_i: case MVM_OP_abs_i: case MVM_OP_bnot_i:
+        case MVM_OP_inc_i: case MVM_OP_dec_i:
+        case MVM_OP_eq_i: case MVM_OP_ne_i: case MVM_OP_lt_i:
+        case MVM_OP_le_i: case MVM_OP_gt_i: case MVM_OP_ge_i:
+        case MVM_OP_cmp_i:
+        case MVM_OP_add_n: case MVM_OP_sub_n: case MVM_OP_mul_n:
+        case MVM_OP_div_n: case MVM_OP_neg_n:
+        case MVM_OP_eq_n: case MVM_OP_ne_n: case MVM_OP_lt_n:
+        case MVM_OP_le_n: case MVM_OP_gt_n: case MVM_OP_ge_n:
+        case MVM_OP_cmp_n:
+        case MVM_OP_coerce_in: case MVM_OP_coerce_ni:
+        case MVM_OP_goto:
+        case MVM_OP_if_i: case MVM_OP_unless_i:
+        case MVM_OP_if_n: case MVM_OP_unless_n:
+        case MVM_OP_getlex: case MVM_OP_bindlex:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/* Emits code for one op, found at pos in the bytecode. Returns non-zero if
+ * execution may fall through to the next op. */
+static MVMint64 emit_op(Emitter *e, MVMuint8 *bc, MVMuint32 pos) {
+    MVMuint16 op = *((MVMuint16 *)(bc + pos));
+    MVMuint8 *args = bc + pos + 2;
+#define REG(idx) (*((MVMuint16 *)(args + idx)))
+    switch (op) {
+        case MVM_OP_no_op:
+            break;
+        case MVM_OP_const_i64:
+        case MVM_OP_const_n64:
+            emit_bytes(e, "\x48\xB8", 2);        /* mov rax, imm64 */
+            emit_u64(e, *((MVMuint64 *)(args + 2)));
+            STORE(e, RAX, REG(0));
+            break;
+        case MVM_OP_set:
+            LOAD(e, RAX, REG(2));
+            STORE(e, RAX, REG(0));
+            break;
+        case MVM_OP_add_i: case MVM_OP_sub_i:
+        case MVM_OP_band_i: case MVM_OP_bor_i: case MVM_OP_bxor_i: {
+            const char *opc = op == MVM_OP_add_i  ? "\x03" :
+                              op == MVM_OP_sub_i  ? "\x2B" :
+                              op == MVM_OP_band_i ? "\x23" :
+                              op == MVM_OP_bor_i  ? "\x0B" : "\x33";
+            LOAD(e, RAX, REG(2));
+            emit_mem(e, 0, 1, opc, 1, RAX, REG(4));
+            STORE(e, RAX, REG(0));
+            break;
+        }
+        case MVM_OP_mul_i:
+            LOAD(e, RAX, REG(2));
+            emit_mem(e, 0, 1, "\x0F\xAF", 2, RAX, REG(4));
+            STORE(e, RAX, REG(0));
+            break;
+        case MVM_OP_blshift_i:
+        case MVM_OP_brshift_i:
+            LOAD(e, RAX, REG(2));
+            LOAD(e, RCX, REG(4));
+            if (op == MVM_OP_blshift_i)
+                emit_bytes(e, "\x48\xD3\xE0", 3);    /* shl rax, cl */
+            else
+                emit_bytes(e, "\x48\xD3\xF8", 3);    /* sar rax, cl */
+            STORE(e, RAX, REG(0));
+            break;
+        case MVM_OP_neg_i:
+            LOAD(e, RAX, REG(2));
+            emit_bytes(e, "\x48\xF7\xD8", 3);        /* neg rax */
+            STORE(e, RAX, REG(0));
+            break;
+        case MVM_OP_bnot_i:
+            LOAD(e, RAX, REG(2));
+            emit_bytes(e, "\x48\xF7\xD0", 3);        /* not rax */
+            STORE(e, RAX, REG(0));
+            break;
+        case MVM_OP_abs_i:
+            LOAD(e, RAX, REG(2));
+            emit_bytes(e, "\x48\x89\xC1", 3);        /* mov rcx, rax */
+            emit_bytes(e, "\x48\xC1\xF9\x3F", 4);    /* sar rcx, 63 */
+            emit_bytes(e, "\x48\x01\xC8", 3);        /* add rax, rcx */
+            emit_bytes(e, "\x48\x31\xC8", 3);        /* xor rax, rcx */
+            STORE(e, RAX, REG(0));
+            break;
+        case MVM_OP_inc_i:
+            emit_mem(e, 0, 1, "\xFF", 1, 0, REG(0));
+            break;
+        case MVM_OP_dec_i:
+            emit_mem(e, 0, 1, "\xFF", 1, 1, REG(0));
+            break;
+        case MVM_OP_eq_i: case MVM_OP_ne_i: case MVM_OP_lt_i:
+        case MVM_OP_le_i: case MVM_OP_gt_i: case MVM_OP_ge_i: {
+            MVMuint8 cc = op == MVM_OP_eq_i ? CC_E :
+                          op == MVM_OP_ne_i ? CC_NE :
+                          op == MVM_OP_lt_i ? CC_L :
+                          op == MVM_OP_le_i ? CC_LE :
+                          op == MVM_OP_gt_i ? CC_G : CC_GE;
+            LOAD(e, RAX, REG(2));
+            emit_mem(e, 0, 1, "\x3B", 1, RAX, REG(4));
+            emit_setcc(e, cc, RAX);
+            emit_store_al(e, REG(0), 0);
+            break;
+        }
+        case MVM_OP_cmp_i:
+            LOAD(e, RAX, REG(2));
+            emit_mem(e, 0, 1, "\x3B", 1, RAX, REG(4));
+            emit_setcc(e, CC_G, RAX);
+            emit_setcc(e, CC_L, RCX);
+            emit_bytes(e, "\x28\xC8", 2);            /* sub al, cl */
+            emit_store_al(e, REG(0), 1);
+            break;
+        case MVM_OP_add_n: case MVM_OP_sub_n:
+        case MVM_OP_mul_n: case MVM_OP_div_n: {
+            const char *opc = op == MVM_OP_add_n ? "\x0F\x58" :
+                              op == MVM_OP_sub_n ? "\x0F\x5C" :
+                              op == MVM_OP_mul_n ? "\x0F\x59" : "\x0F\x5E";
+            LOAD_XMM0(e, REG(2));
+            emit_mem(e, 0xF2, 0, opc, 2, 0, REG(4));
+            STORE_XMM0(e, REG(0));
+            break;
+        }
+        case MVM_OP_neg_n:
+            LOAD(e, RAX, REG(2));
+            emit_bytes(e, "\x48\x0F\xBA\xF8\x3F", 5);    /* btc rax, 63 */
+            STORE(e, RAX, REG(0));
+            break;
+        case MVM_OP_eq_n: case MVM_OP_ne_n:
+            LOAD_XMM0(e, REG(2));
+            UCOMISD_XMM0(e, REG(4));
+            if (op == MVM_OP_eq_n) {
+                emit_setcc(e, CC_E, RAX);
+                emit_setcc(e, CC_NP, RCX);
+                emit_bytes(e, "\x20\xC8", 2);        /* and al, cl */
+            }
+            else {
+                emit_setcc(e, CC_NE, RAX);
+                emit_setcc(e, CC_P, RCX);
+                emit_bytes(e, "\x08\xC8", 2);        /* or al, cl */
+            }
+            emit_store_al(e, REG(0), 0);
+            break;
+        case MVM_OP_lt_n: case MVM_OP_le_n:
+        case MVM_OP_gt_n: case MVM_OP_ge_n: {
+            /* Compare so that "above" means true; unordered sets CF, so NaN
+             * operands give false as in C. */
+            MVMuint8 swap = op == MVM_OP_lt_n || op == MVM_OP_le_n;
+            MVMuint8 cc   = op == MVM_OP_lt_n || op == MVM_OP_gt_n ? CC_A : CC_AE;
+            LOAD_XMM0(e, swap ? REG(4) : REG(2));
+            UCOMISD_XMM0(e, swap ? REG(2) : REG(4));
+            emit_setcc(e, cc, RAX);
+            emit_store_al(e, REG(0), 0);
+            break;
+        }
+        case MVM_OP_cmp_n:
+            LOAD_XMM0(e, REG(2));
+            UCOMISD_XMM0(e, REG(4));
+            emit_setcc(e, CC_A, RAX);
+            LOAD_XMM0(e, REG(4));
+            UCOMISD_XMM0(e, REG(2));
+            emit_setcc(e, CC_A, RCX);
+            emit_bytes(e, "\x28\xC8", 2);            /* sub al, cl */
+            emit_store_al(e, REG(0), 1);
+            break;
+        case MVM_OP_coerce_in:
+            emit_mem(e, 0xF2, 1, "\x0F\x2A", 2, 0, REG(2));     /* cvtsi2sd */
+            STORE_XMM0(e, REG(0));
+            break;
+        case MVM_OP_coerce_ni:
+            emit_mem(e, 0xF2, 1, "\x0F\x2C", 2, RAX, REG(2));   /* cvttsd2si */
+            STORE(e, RAX, REG(0));
+            break;
+        case MVM_OP_goto:
+            emit_branch(e, -1, *((MVMuint32 *)args), pos);
+            return 0;
+        case MVM_OP_if_i:
+        case MVM_OP_unless_i:
+            emit_mem(e, 0, 1, "\x83", 1, 7, REG(0));   /* cmp qword [reg], 0 */
+            emit_byte(e, 0);
+            emit_branch(e, op == MVM_OP_if_i ? CC_NE : CC_E,
+                *((MVMuint32 *)(args + 2)), pos);
+            break;
+        case MVM_OP_if_n:
+        case MVM_OP_unless_n:
+            emit_num_truth(e, REG(0));
+            emit_bytes(e, "\x84\xC0", 2);            /* test al, al */
+            emit_branch(e, op == MVM_OP_if_n ? CC_NE : CC_E,
+                *((MVMuint32 *)(args + 2)), pos);
+            break;
+        case MVM_OP_getlex:
+            emit_lex_frame(e, REG(4), pos);
+            emit_bytes(e, "\x48\x8B\x88", 3);        /* mov rcx, [rax + idx * 8] */
+            emit_i32(e, REG(2) * sizeof(MVMRegister));
+            STORE(e, RCX, REG(0));
+            break;
+        case MVM_OP_bindlex:
+            emit_lex_frame(e, REG(2), pos);
+            LOAD(e, RCX, REG(4));
+            emit_bytes(e, "\x48\x89\x88", 3);        /* mov [rax + idx * 8], rcx */
+            emit_i32(e, REG(0) * sizeof(MVMRegister));
+            break;
+    }
+#undef REG
+    return 1;
+}
+
+/* Compiles the frame's (specialized, if available) bytecode. Returns NULL
+ * if there was nothing worth compiling. */
+MVMJitCode * MVM_jit_compile(MVMThreadContext *tc, MVMStaticFrame *sf) {
+    MVMStaticFrameBody *body   = &sf->body;
+    MVMuint8           *src    = body->spesh_bytecode ? body->spesh_bytecode : body->bytecode;
+    MVMuint32           size   = body->bytecode_size;
+    MVMuint8           *labels = body->instr_offsets;
+    MVMint32           *native;
+    MVMuint32          *entry_pos;
+    MVMuint32           num_entries = 0, pos, i;
+    MVMint64            want_entry;
+    MVMJitCode         *code;
+    Emitter             e;
+
+    /* Find the ops we can compile; native[pos] is -1 for those we can't. */
+    native = malloc(size * sizeof(MVMint32));
+    for (pos = 0; pos < size; pos++)
+        native[pos] = labels[pos] & MVM_BC_op_boundary &&
+            is_supported(*((MVMuint16 *)(src + pos))) ? 0 : -1;
+
+    e.alloc        = 256;
+    e.len          = 0;
+    e.buf          = malloc(e.alloc);
+    e.fixups       = NULL;
+    e.num_fixups   = 0;
+    e.alloc_fixups = 0;
+    e.bytecode     = malloc(size);
+    memcpy(e.bytecode, src, size);
+
+    /* Prologue: save callee-saved registers (three, keeping the stack
+     * aligned for calls), set up rbx and r12, and jump to the entry. The
+     * epilogue comes straight after. */
+    emit_bytes(&e, "\x53\x41\x54\x41\x55", 5);         /* push rbx; push r12; push r13 */
+    emit_bytes(&e, "\x48\x89\xFB", 3);                 /* mov rbx, rdi */
+    emit_bytes(&e, "\x49\x89\xF4", 3);                 /* mov r12, rsi */
+    emit_bytes(&e, "\xFF\xE2", 2);                     /* jmp rdx */
+    e.epilogue = e.len;
+    emit_bytes(&e, "\x41\x5D\x41\x5C\x5B\xC3", 6);     /* pop r13; pop r12; pop rbx; ret */
+
+    entry_pos = malloc(size * sizeof(MVMuint32));
+    want_entry = 1;
+    for (pos = 0; pos < size; pos++) {
+        MVMuint32 next;
+        if (!(labels[pos] & MVM_BC_op_boundary))
+            continue;
+        for (next = pos + 1; next < size && !(labels[next] & MVM_BC_op_boundary); next++)
+            ;
+        if (native[pos] < 0) {
+            want_entry = 1;
+            continue;
+        }
+
+        /* The interpreter enters compiled code at the start of each stretch
+         * of compilable ops and at branch targets, provided the op there is
+         * big enough to be replaced by sp_jit_enter. */
+        if ((want_entry || labels[pos] & MVM_BC_branch_target) && num_entries <= 0xFFFF) {
+            if (next - pos >= 4) {
+                entry_pos[num_entries++] = pos;
+                want_entry = 0;
+            }
+            else {
+                want_entry = 1;
+            }
+        }
+
+        native[pos] = e.len;
+        if (emit_op(&e, src, pos) && (next >= size || native[next] < 0))
+            emit_exit(&e, next);
+    }
+
+    /* Resolve branches; those to ops we did not compile leave compiled code. */
+    for (i = 0; i < e.num_fixups; i++) {
+        Fixup     *f      = &e.fixups[i];
+        MVMuint32  target = f->target;
+        if (target >= size || native[target] < 0) {
+            patch_i32(&e, f->patch_pos, (MVMint32)(e.len - (f->patch_pos + 4)));
+            emit_exit(&e, target);
+        }
+        else {
+            patch_i32(&e, f->patch_pos, (MVMint32)(native[target] - (f->patch_pos + 4)));
+        }
+    }
+
+    if (num_entries == 0) {
+        code = NULL;
+        free(e.bytecode);
+    }
+    else {
+        MVMuint8 *mem = MVM_platform_alloc_pages(e.len, 1);
+        if (mem) {
+            memcpy(mem, e.buf, e.len);
+            code = malloc(sizeof(MVMJitCode));
+            code->func        = (MVMJitFunc)mem;
+            code->size        = e.len;
+            code->bytecode    = e.bytecode;
+            code->num_entries = num_entries;
+            code->entries     = malloc(num_entries * sizeof(void *));
+            for (i = 0; i < num_entries; i++) {
+                code->entries[i] = mem + native[entry_pos[i]];
+                *((MVMuint16 *)(e.bytecode + entry_pos[i]))     = MVM_OP_sp_jit_enter;
+                *((MVMuint16 *)(e.bytecode + entry_pos[i] + 2)) = (MVMuint16)i;
+            }
+        }
+        else {
+            code = NULL;
+            free(e.bytecode);
+        }
+    }
+
+    free(e.buf);
+    free(e.fixups);
+    free(entry_pos);
+    free(native);
+    return code;
+}
+
+#else
+
+MVMJitCode * MVM_jit_compile(MVMThreadContext *tc, MVMStaticFrame *sf) {
+    return NULL;
+}
+
+#endif
+
+/* Frees compiled code. */
+void MVM_jit_destroy(MVMThreadContext *tc, MVMJitCode *code) {
+    MVM_platform_free_pages((void *)code->func, code->size);
+    free(code->bytecode);
+    free(code->entries);
+    free(code);
+}
@@ -0,0 +1,39 @@
+/* A template JIT for hot static frames. Ops that it knows how to compile
+ * (integer and num arithmetic and comparisons, register moves, branches
+ * and lexical access) are turned into x86-64 machine code that works on
+ * the frame's registers in place. Anything else is left to the
+ * interpreter.
+ *
+ * The interpreter enters the machine code through sp_jit_enter ops, which
+ * replace the first op of each stretch of compiled code in a copy of the
+ * frame's bytecode. The machine code runs until it reaches an op it does
+ * not handle, or a backward branch while a GC is pending, and then returns
+ * the bytecode offset at which the interpreter should carry on. Exceptions
+ * thrown from helpers called by the machine code unwind it like any other
+ * C code, with the interpreter's current op kept up to date first. */
+
+#if (defined(__x86_64__) || defined(__amd64__)) && !defined(_WIN32)
+#define MVM_JIT_SUPPORTED 1
+#else
+#define MVM_JIT_SUPPORTED 0
+#endif
+
+/* Entry point into compiled code: runs from the given entry address and
+ * returns the bytecode offset at which to resume interpreting. */
+typedef MVMuint32 (*MVMJitFunc)(MVMThreadContext *tc, MVMRegister *reg_base, void *entry);
+
+struct MVMJitCode {
+    /* The machine code and the size of the pages it lives in. */
+    MVMJitFunc func;
+    size_t     size;
+
+    /* Copy of the bytecode with sp_jit_enter ops at each entry. */
+    MVMuint8 *bytecode;
+
+    /* Native addresses of the entries, indexed by sp_jit_enter's operand. */
+    void      **entries;
+    MVMuint32   num_entries;
+};
+
+MVMJitCode * MVM_jit_compile(MVMThreadContext *tc, MVMStaticFrame *sf);
+void MVM_jit_destroy(MVMThreadContext *tc, MVMJitCode *code);
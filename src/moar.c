@@ -8,6 +8,31 @@
 	} \
 } while (0)
 
+/* Works out the GC configuration, taking any given in the environment. */
+static void setup_gc_config(MVMInstance *instance) {
+    const char *env;
+
+    instance->nursery_size     = MVM_NURSERY_SIZE;
+    instance->nursery_adaptive = 1;
+    instance->gc_gen2_ratio    = MVM_GC_GEN2_RATIO;
+
+    if ((env = getenv("MVM_NURSERY_SIZE")) && *env) {
+        unsigned long size = strtoul(env, NULL, 10);
+        if (size < MVM_NURSERY_SIZE_MIN)
+            size = MVM_NURSERY_SIZE_MIN;
+        else if (size > MVM_NURSERY_SIZE_MAX)
+            size = MVM_NURSERY_SIZE_MAX;
+        instance->nursery_size = (MVMuint32)(size & ~4095UL);
+    }
+    if ((env = getenv("MVM_NURSERY_ADAPTIVE")) && *env)
+        instance->nursery_adaptive = strtoul(env, NULL, 10) != 0;
+    if ((env = getenv("MVM_GC_GEN2_RATIO")) && *env) {
+        unsigned long ratio = strtoul(env, NULL, 10);
+        if (ratio > 0)
+            instance->gc_gen2_ratio = (MVMuint32)ratio;
+    }
+}
+
 /* Create a new instance of the VM. */
 static void string_consts(MVMThreadContext *tc);
 static void setup_std_handles(MVMThreadContext *tc);
@@ -18,6 +43,16 @@ MVMInstance * MVM_vm_create_instance(void) {
     /* Set up instance data structure. */
     instance = calloc(1, sizeof(MVMInstance));
 
+    /* Configure the GC, which the thread contexts need to know about. */
+    setup_gc_config(instance);
+
+    /* Find where bytecode caches are kept, if anywhere. */
+    {
+        const char *env = getenv("MVM_BYTECODE_CACHE");
+        if (env && *env)
+            instance->bytecode_cache_dir = strdup(env);
+    }
+
     /* Create the main thread's ThreadContext and stash it. */
     instance->main_thread = MVM_tc_create(instance);
 
@@ -50,6 +85,9 @@ MVMInstance * MVM_vm_create_instance(void) {
     /* Set up weak reference hash mutex. */
     init_mutex(instance->mutex_sc_weakhash, "sc weakhash");
 
+    /* Set up deserialization mutex. */
+    init_mutex(instance->mutex_deserialize, "deserialization");
+
     /* Set up loaded compunits hash mutex. */
     init_mutex(instance->mutex_loaded_compunits, "loaded compunits");
 
@@ -93,8 +131,8 @@ MVMInstance * MVM_vm_create_instance(void) {
     /* Set up hll symbol tables mutex. */
     init_mutex(instance->mutex_hll_syms, "hll syms");
 
-    /* Initialize string cclass handling. */
-    MVM_string_cclass_init(instance->main_thread);
+    /* Set up the mutex guarding the start of the event loop. */
+    init_mutex(instance->mutex_event_loop, "event loop");
 
     /* Set up some string constants commonly used. */
     string_consts(instance->main_thread);
@@ -193,10 +231,21 @@ void MVM_vm_dump_file(MVMInstance *instance, const char *filename) {
 /* Destroys a VM instance. This must be called only from
  * the main thread. */
 void MVM_vm_destroy_instance(MVMInstance *instance) {
+    /* Stop the event loop, so nothing more is posted to queues. */
+    MVM_io_eventloop_stop(instance);
+
+    /* Save any bytecode caches that gained frames, while the compilation
+     * units they come from are still around. */
+    MVM_bytecode_cache_save_all(instance->main_thread);
+
     /* Run the GC global destruction phase. After this,
      * no 6model object pointers should be accessed. */
     MVM_gc_global_destruction(instance->main_thread);
 
+    /* Clean up the event loop. */
+    MVM_io_eventloop_destroy(instance);
+    uv_mutex_destroy(&instance->mutex_event_loop);
+
     /* Cleanup REPR registry */
     uv_mutex_destroy(&instance->mutex_repr_registry);
     MVM_HASH_DESTROY(hash_handle, MVMReprRegistry, instance->repr_hash);
@@ -206,6 +255,11 @@ void MVM_vm_destroy_instance(MVMInstance *instance) {
     uv_mutex_destroy(&instance->mutex_permroots);
     MVM_checked_free_null(instance->permroots);
 
+    /* Clean up GC work stealing stacks, and anything waiting to be freed
+     * at a safe point. */
+    MVM_gc_free_steal_stacks(instance->main_thread);
+    MVM_gc_free_safepoint_queue(instance->main_thread);
+
     /* Clean up Hash of HLLConfig. */
     uv_mutex_destroy(&instance->mutex_hllconfigs);
     MVM_HASH_DESTROY(hash_handle, MVMHLLConfig, instance->compiler_hll_configs);
@@ -225,12 +279,16 @@ void MVM_vm_destroy_instance(MVMInstance *instance) {
 
     /* Clean up Hash of all known serialization contexts. */
     uv_mutex_destroy(&instance->mutex_sc_weakhash);
+    uv_mutex_destroy(&instance->mutex_deserialize);
     MVM_HASH_DESTROY(hash_handle, MVMSerializationContextBody, instance->sc_weakhash);
 
     /* Clean up Hash of filenames of compunits loaded from disk. */
     uv_mutex_destroy(&instance->mutex_loaded_compunits);
     MVM_HASH_DESTROY(hash_handle, MVMLoadedCompUnitName, instance->loaded_compunits);
 
+    /* Clean up bytecode caches. */
+    MVM_bytecode_cache_destroy_all(instance);
+
     /* Clean up Container registry. */
     uv_mutex_destroy(&instance->mutex_container_registry);
     MVM_HASH_DESTROY(hash_handle, MVMContainerRegistry, instance->container_registry);
@@ -59,9 +59,11 @@ typedef double   MVMnum64;
 #include "core/args.h"
 #include "core/exceptions.h"
 #include "core/frame.h"
+#include "core/callstack.h"
 #include "core/validation.h"
 #include "core/compunit.h"
 #include "core/bytecode.h"
+#include "core/bytecodecache.h"
 #include "core/bytecodedump.h"
 #include "core/ops.h"
 #include "core/threads.h"
@@ -101,9 +103,13 @@ typedef double   MVMnum64;
 #include "io/fileops.h"
 #include "io/dirops.h"
 #include "io/procops.h"
+#include "io/eventloop.h"
+#include "io/asyncops.h"
 #include "math/bigintops.h"
 #include "mast/driver.h"
 #include "core/intcache.h"
+#include "spesh/spesh.h"
+#include "jit/jit.h"
 
 MVMObject *MVM_backend_config(MVMThreadContext *tc);
 
@@ -1,4 +1,6 @@
 void *MVM_platform_alloc_pages(size_t size, int executable);
 int MVM_platform_free_pages(void *block, size_t size);
 void *MVM_platform_map_file(int fd, void **handle, size_t size, int writable);
+void *MVM_platform_map_file_range(int fd, void **handle, uint64_t offset, size_t size, int writable);
+size_t MVM_platform_map_granularity(void);
 int MVM_platform_unmap_file(void *block, void *handle, size_t size);
@@ -1,5 +1,7 @@
 #include <stddef.h>
+#include <unistd.h>
 #include <sys/mman.h>
+#include "platform/inttypes.h"
 #include "platform/mmap.h"
 
 /* MAP_ANONYMOUS is Linux, MAP_ANON is BSD */
@@ -32,15 +34,26 @@ int MVM_platform_free_pages(void *block, size_t size)
 }
 
 void *MVM_platform_map_file(int fd, void **handle, size_t size, int writable)
+{
+    return MVM_platform_map_file_range(fd, handle, 0, size, writable);
+}
+
+/* The offset must be a multiple of MVM_platform_map_granularity(). */
+void *MVM_platform_map_file_range(int fd, void **handle, uint64_t offset, size_t size, int writable)
 {
     void *block = mmap(NULL, size,
         writable ? PROT_READ | PROT_WRITE : PROT_READ,
-        writable ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+        writable ? MAP_SHARED : MAP_PRIVATE, fd, (off_t)offset);
 
     (void)handle;
     return block != MAP_FAILED ? block : NULL;
 }
 
+size_t MVM_platform_map_granularity(void)
+{
+    return (size_t)sysconf(_SC_PAGESIZE);
+}
+
 int MVM_platform_unmap_file(void *block, void *handle, size_t size)
 {
     (void)handle;
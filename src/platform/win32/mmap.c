@@ -1,5 +1,6 @@
 #include <windows.h>
 #include <io.h>
+#include "platform/inttypes.h"
 #include "platform/mmap.h"
 
 void *MVM_platform_alloc_pages(size_t size, int executable)
@@ -15,16 +16,23 @@ int MVM_platform_free_pages(void *pages, size_t size)
 }
 
 void *MVM_platform_map_file(int fd, void **handle, size_t size, int writable)
+{
+    return MVM_platform_map_file_range(fd, handle, 0, size, writable);
+}
+
+/* The offset must be a multiple of MVM_platform_map_granularity(). */
+void *MVM_platform_map_file_range(int fd, void **handle, uint64_t offset, size_t size, int writable)
 {
     HANDLE fh, mapping;
-    LARGE_INTEGER li;
+    LARGE_INTEGER li, off;
     void *block;
 
     fh = (HANDLE)_get_osfhandle(fd);
     if (fh == INVALID_HANDLE_VALUE)
         return NULL;
 
-    li.QuadPart = size;
+    li.QuadPart  = offset + size;
+    off.QuadPart = offset;
     mapping = CreateFileMapping(fh, NULL,
         writable ? PAGE_READWRITE : PAGE_READONLY,
         li.HighPart, li.LowPart, NULL);
@@ -34,7 +42,7 @@ void *MVM_platform_map_file(int fd, void **handle, size_t size, int writable)
 
     block = MapViewOfFile(mapping,
         writable ? FILE_MAP_READ | FILE_MAP_WRITE : FILE_MAP_READ,
-        0, 0, size);
+        off.HighPart, off.LowPart, size);
 
     if (block == NULL)
     {
@@ -48,6 +56,13 @@ void *MVM_platform_map_file(int fd, void **handle, size_t size, int writable)
     return block;
 }
 
+size_t MVM_platform_map_granularity(void)
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwAllocationGranularity;
+}
+
 int MVM_platform_unmap_file(void *block, void *handle, size_t size)
 {
     BOOL unmapped = UnmapViewOfFile(block);
@@ -0,0 +1,295 @@
+#include "moar.h"
+
+/* Maps an op we know how to specialize to its specializing version, and
+ * sets the offset (from the start of the op) of the operand that will be
+ * replaced by a site index. Returns 0 if the op is not one we handle. */
+static MVMuint16 spesh_op_for(MVMuint16 op, MVMuint32 *site_pos) {
+    switch (op) {
+        case MVM_OP_findmeth:   *site_pos = 6; return MVM_OP_sp_findmeth;
+        case MVM_OP_getattr_i:  *site_pos = 8; return MVM_OP_sp_getattr_i;
+        case MVM_OP_getattr_n:  *site_pos = 8; return MVM_OP_sp_getattr_n;
+        case MVM_OP_getattr_s:  *site_pos = 8; return MVM_OP_sp_getattr_s;
+        case MVM_OP_getattr_o:  *site_pos = 8; return MVM_OP_sp_getattr_o;
+        case MVM_OP_bindattr_i: *site_pos = 6; return MVM_OP_sp_bindattr_i;
+        case MVM_OP_bindattr_n: *site_pos = 6; return MVM_OP_sp_bindattr_n;
+        case MVM_OP_bindattr_s: *site_pos = 6; return MVM_OP_sp_bindattr_s;
+        case MVM_OP_bindattr_o: *site_pos = 6; return MVM_OP_sp_bindattr_o;
+        case MVM_OP_istype:     *site_pos = 6; return MVM_OP_sp_istype;
+        default:                return 0;
+    }
+}
+
+/* Makes a copy of the frame's bytecode with the ops we can specialize
+ * rewritten to sp_* ops, each with its own site. The rewritten ops have the
+ * same size as the originals, so branch targets, handler offsets and
+ * annotations all still apply. If there is nothing to rewrite, the frame
+ * keeps running its original bytecode. */
+static void install_logging(MVMThreadContext *tc, MVMStaticFrame *sf) {
+    MVMStaticFrameBody *body   = &sf->body;
+    MVMuint8           *labels = body->instr_offsets;
+    MVMuint8           *bc;
+    MVMSpeshSite       *sites  = NULL;
+    MVMuint32           num_sites = 0, alloc_sites = 0, pos;
+
+    bc = malloc(body->bytecode_size);
+    memcpy(bc, body->bytecode, body->bytecode_size);
+
+    for (pos = 0; pos < body->bytecode_size; pos++) {
+        MVMuint16     op, sp_op;
+        MVMuint32     site_pos;
+        MVMSpeshSite *site;
+
+        if (!(labels[pos] & MVM_BC_op_boundary))
+            continue;
+        op    = *((MVMuint16 *)(bc + pos));
+        sp_op = spesh_op_for(op, &site_pos);
+        if (!sp_op)
+            continue;
+
+        /* istype only has room for a 16-bit site index. */
+        if (sp_op == MVM_OP_sp_istype && num_sites > 0xFFFF)
+            continue;
+
+        if (num_sites == alloc_sites) {
+            alloc_sites = alloc_sites ? alloc_sites * 2 : 8;
+            sites = realloc(sites, alloc_sites * sizeof(MVMSpeshSite));
+        }
+        site = &sites[num_sites];
+        memset(site, 0, sizeof(MVMSpeshSite));
+        site->orig_op = op;
+        if (sp_op != MVM_OP_sp_istype)
+            site->ic = calloc(MVM_SPESH_IC_SIZE, sizeof(MVMSpeshICEntry));
+
+        if (sp_op == MVM_OP_sp_istype) {
+            site->operand = *((MVMuint16 *)(bc + pos + site_pos));
+            *((MVMuint16 *)(bc + pos + site_pos)) = (MVMuint16)num_sites;
+        }
+        else {
+            site->operand = *((MVMuint32 *)(bc + pos + site_pos));
+            *((MVMuint32 *)(bc + pos + site_pos)) = num_sites;
+        }
+        *((MVMuint16 *)(bc + pos)) = sp_op;
+        num_sites++;
+    }
+
+    if (!num_sites) {
+        free(bc);
+        return;
+    }
+
+    /* Sites must be in place before any frame can run the new bytecode. */
+    body->spesh_sites     = sites;
+    body->num_spesh_sites = num_sites;
+    MVM_barrier();
+    body->spesh_bytecode  = bc;
+}
+
+/* Works out the result of an istype site that only ever saw one type, if
+ * we can do so from the type check cache. Returns 0 if not. */
+static MVMint64 specialize_site(MVMThreadContext *tc, MVMStaticFrame *sf, MVMSpeshSite *site) {
+    MVMSTable  *st    = site->log_st;
+    MVMObject  *type  = site->log_obj;
+    MVMObject **cache = st->type_check_cache;
+    MVMint64    mode  = STABLE(type)->mode_flags & MVM_TYPE_CHECK_CACHE_FLAG_MASK;
+    MVMint64    i;
+    if (!cache)
+        return 0;
+    for (i = 0; i < st->type_check_cache_length; i++) {
+        if (cache[i] == type) {
+            site->value = 1;
+            return 1;
+        }
+    }
+    /* A miss only means a false result if the cache is definitive. */
+    if ((mode & MVM_TYPE_CHECK_CACHE_THEN_METHOD) || (mode & MVM_TYPE_CHECK_NEEDS_ACCEPTS))
+        return 0;
+    site->value = 0;
+    return 1;
+}
+
+/* Specializes all of the sites that saw a single type. */
+static void specialize_sites(MVMThreadContext *tc, MVMStaticFrame *sf) {
+    MVMuint32 i;
+    for (i = 0; i < sf->body.num_spesh_sites; i++) {
+        MVMSpeshSite *site = &sf->body.spesh_sites[i];
+        if (site->log_state != MVM_SPESH_LOG_MONO)
+            continue;
+        if (!specialize_site(tc, sf, site))
+            continue;
+
+        /* Set up the guard; guard_st goes last, since it being set is what
+         * makes the fast path use the rest. */
+        MVM_ASSIGN_REF(tc, &(sf->common.header), site->guard_obj, site->log_obj);
+        site->guard_version     = site->log_st->cache_version;
+        site->guard_obj_version = site->log_obj ? STABLE(site->log_obj)->cache_version : 0;
+        MVM_barrier();
+        MVM_ASSIGN_REF(tc, &(sf->common.header), site->guard_st, site->log_st);
+    }
+}
+
+/* Called on invocation of a static frame once it has been invoked at least
+ * MVM_SPESH_LOG_THRESHOLD times, until it is fully specialized. Only one
+ * thread gets to do each step. The last step also hands the specialized
+ * bytecode to the JIT. */
+void MVM_spesh_check(MVMThreadContext *tc, MVMStaticFrame *sf) {
+    MVMStaticFrameBody *body = &sf->body;
+    switch (MVM_load(&body->spesh_state)) {
+        case MVM_SPESH_STATE_COLD:
+            if (MVM_trycas(&body->spesh_state, MVM_SPESH_STATE_COLD, MVM_SPESH_STATE_BUSY)) {
+                install_logging(tc, sf);
+                MVM_store(&body->spesh_state, MVM_SPESH_STATE_LOGGING);
+            }
+            break;
+        case MVM_SPESH_STATE_LOGGING:
+            if (body->spesh_invocations >= MVM_SPESH_THRESHOLD &&
+                    MVM_trycas(&body->spesh_state, MVM_SPESH_STATE_LOGGING, MVM_SPESH_STATE_BUSY)) {
+                MVMJitCode *jit_code;
+                specialize_sites(tc, sf);
+                jit_code = MVM_jit_compile(tc, sf);
+                if (jit_code) {
+                    MVM_barrier();
+                    body->jit_code = jit_code;
+                }
+                MVM_store(&body->spesh_state, MVM_SPESH_STATE_DONE);
+            }
+            break;
+    }
+}
+
+/* Logs the type of the object seen at a site, along with the type object
+ * it was checked against. Must be called while the frame holding the
+ * site is still the current one. */
+void MVM_spesh_log(MVMThreadContext *tc, MVMSpeshSite *site, MVMObject *obj, MVMObject *extra) {
+    MVMStaticFrame *sf = tc->cur_frame->static_info;
+    if (!obj || sf->body.spesh_state != MVM_SPESH_STATE_LOGGING)
+        return;
+    switch (site->log_state) {
+        case MVM_SPESH_LOG_NONE:
+            MVM_ASSIGN_REF(tc, &(sf->common.header), site->log_st, STABLE(obj));
+            MVM_ASSIGN_REF(tc, &(sf->common.header), site->log_obj, extra);
+            site->log_state = MVM_SPESH_LOG_MONO;
+            break;
+        case MVM_SPESH_LOG_MONO:
+            if (site->log_st != STABLE(obj) || site->log_obj != extra)
+                site->log_state = MVM_SPESH_LOG_POLY;
+            break;
+    }
+}
+
+/* Adds an entry to a site's inline cache. If the type (and class handle)
+ * already has an entry, it is stale, and we refresh it in place. If the
+ * cache is full, we leave it be. */
+static void ic_add(MVMThreadContext *tc, MVMSpeshSite *site, MVMSTable *st, MVMuint32 version,
+        MVMObject *obj, MVMint64 offset, MVMint64 match_obj) {
+    MVMStaticFrame *sf = tc->cur_frame->static_info;
+    MVMuint32       i, n;
+
+    n = (MVMuint32)MVM_load(&site->ic_entries);
+    for (i = 0; i < n; i++) {
+        MVMSpeshICEntry *entry = &site->ic[i];
+        if (entry->st == st && (!match_obj || entry->obj == obj)) {
+            MVM_ASSIGN_REF(tc, &(sf->common.header), entry->obj, obj);
+            entry->offset = offset;
+            MVM_barrier();
+            entry->version = version;
+            return;
+        }
+    }
+    if (n < MVM_SPESH_IC_SIZE && MVM_trycas(&site->ic_entries, n, n + 1)) {
+        MVMSpeshICEntry *entry = &site->ic[n];
+        MVM_ASSIGN_REF(tc, &(sf->common.header), entry->obj, obj);
+        entry->offset  = offset;
+        entry->version = version;
+        MVM_barrier();
+        MVM_ASSIGN_REF(tc, &(sf->common.header), entry->st, st);
+    }
+}
+
+/* Slow path for findmeth, taken on an inline cache miss. Methods found in
+ * the type's method cache are added to the inline cache; anything found
+ * through the meta-object's find_method is not. */
+void MVM_spesh_find_method(MVMThreadContext *tc, MVMSpeshSite *site, MVMObject *obj,
+        MVMString *name, MVMRegister *res) {
+    MVMSTable *st;
+    MVMObject *cache, *meth;
+    MVMuint32  version;
+
+    if (!obj) {
+        MVM_6model_find_method(tc, obj, name, res);
+        return;
+    }
+    st      = STABLE(obj);
+    version = st->cache_version;
+    MVM_barrier();
+    cache   = st->method_cache;
+    meth    = cache && IS_CONCRETE(cache) ? MVM_repr_at_key_o(tc, cache, name) : NULL;
+    if (!meth) {
+        MVM_6model_find_method(tc, obj, name, res);
+        return;
+    }
+    res->o = meth;
+    ic_add(tc, site, st, version, meth, 0, 0);
+}
+
+/* Caches the P6opaque slot offset of an attribute for a type and class
+ * handle, if it has one we can access directly. */
+static void ic_add_attribute(MVMThreadContext *tc, MVMSpeshSite *site, MVMObject *obj,
+        MVMObject *class_handle, MVMString *name, MVMuint16 kind) {
+    MVMSTable *st      = STABLE(obj);
+    MVMuint32  version = st->cache_version;
+    MVMint64   offset;
+    if (!class_handle)
+        return;
+    offset = MVM_p6opaque_attr_offset(tc, st, class_handle, name, kind);
+    if (offset >= 0)
+        ic_add(tc, site, st, version, class_handle, offset, 1);
+}
+
+/* Slow paths for the attribute ops, taken on an inline cache miss. */
+void MVM_spesh_get_attribute(MVMThreadContext *tc, MVMSpeshSite *site, MVMObject *obj,
+        MVMObject *class_handle, MVMint16 hint, MVMRegister *result, MVMuint16 kind) {
+    MVMString *name = MVM_cu_string(tc, tc->cur_frame->static_info->body.cu, site->operand);
+    if (!IS_CONCRETE(obj))
+        MVM_exception_throw_adhoc(tc, "Cannot look up attributes in a type object");
+    ic_add_attribute(tc, site, obj, class_handle, name, kind);
+    REPR(obj)->attr_funcs.get_attribute(tc, STABLE(obj), obj, OBJECT_BODY(obj),
+        class_handle, name, hint, result, kind);
+}
+void MVM_spesh_bind_attribute(MVMThreadContext *tc, MVMSpeshSite *site, MVMObject *obj,
+        MVMObject *class_handle, MVMint16 hint, MVMRegister value, MVMuint16 kind) {
+    MVMString *name = MVM_cu_string(tc, tc->cur_frame->static_info->body.cu, site->operand);
+    if (!IS_CONCRETE(obj))
+        MVM_exception_throw_adhoc(tc, "Cannot bind attributes in a type object");
+    ic_add_attribute(tc, site, obj, class_handle, name, kind);
+    REPR(obj)->attr_funcs.bind_attribute(tc, STABLE(obj), obj, OBJECT_BODY(obj),
+        class_handle, name, hint, value, kind);
+}
+
+/* Marks the objects held by the sites of a static frame. */
+void MVM_spesh_gc_mark(MVMThreadContext *tc, MVMStaticFrameBody *body, MVMGCWorklist *worklist) {
+    MVMuint32 i;
+    for (i = 0; i < body->num_spesh_sites; i++) {
+        MVMSpeshSite *site = &body->spesh_sites[i];
+        MVM_gc_worklist_add(tc, worklist, &site->log_st);
+        MVM_gc_worklist_add(tc, worklist, &site->log_obj);
+        MVM_gc_worklist_add(tc, worklist, &site->guard_st);
+        MVM_gc_worklist_add(tc, worklist, &site->guard_obj);
+        if (site->ic) {
+            MVMuint32 j;
+            for (j = 0; j < MVM_SPESH_IC_SIZE; j++) {
+                MVM_gc_worklist_add(tc, worklist, &site->ic[j].st);
+                MVM_gc_worklist_add(tc, worklist, &site->ic[j].obj);
+            }
+        }
+    }
+}
+
+/* Frees the specialized bytecode and sites of a static frame. */
+void MVM_spesh_destroy(MVMThreadContext *tc, MVMStaticFrameBody *body) {
+    MVMuint32 i;
+    for (i = 0; i < body->num_spesh_sites; i++)
+        MVM_checked_free_null(body->spesh_sites[i].ic);
+    MVM_checked_free_null(body->spesh_bytecode);
+    MVM_checked_free_null(body->spesh_sites);
+    body->num_spesh_sites = 0;
+}
@@ -0,0 +1,108 @@
+/* The bytecode specializer. Once a static frame has been invoked often
+ * enough, we make a copy of its bytecode in which the ops we know how to
+ * specialize are replaced by sp_* ops of the same length. Each of those
+ * refers to a site, which first logs the types that show up there. Once
+ * the frame is hot, istype sites that only saw one type are specialized:
+ * they get a guard and a pre-computed result, so the generic type check is
+ * only done if the guard fails. findmeth and attribute sites instead have
+ * an inline cache, holding the methods or P6opaque slot offsets found for
+ * the first few types seen there. */
+
+/* Number of invocations after which we start logging types, and after
+ * which we specialize the sites using what was logged. */
+#define MVM_SPESH_LOG_THRESHOLD     10
+#define MVM_SPESH_THRESHOLD         100
+
+/* Specialization states of a static frame. */
+#define MVM_SPESH_STATE_COLD        0
+#define MVM_SPESH_STATE_BUSY        1
+#define MVM_SPESH_STATE_LOGGING     2
+#define MVM_SPESH_STATE_DONE        3
+
+/* Number of entries in the inline cache of a findmeth or attribute site. */
+#define MVM_SPESH_IC_SIZE           4
+
+/* What a site logged so far. */
+#define MVM_SPESH_LOG_NONE          0
+#define MVM_SPESH_LOG_MONO          1
+#define MVM_SPESH_LOG_POLY          2
+
+/* An entry in a site's inline cache, valid as long as the type's cache
+ * version is unchanged (that is, until its method cache is republished).
+ * For findmeth, obj is the method found for the type. For attribute ops,
+ * obj is the class handle and offset is where the attribute lives in a
+ * P6opaque's body. */
+struct MVMSpeshICEntry {
+    MVMSTable *st;
+    MVMObject *obj;
+    MVMint64   offset;
+    MVMuint32  version;
+};
+
+/* A site in specialized bytecode. */
+struct MVMSpeshSite {
+    /* The operand that was displaced by the site index: the string heap
+     * index of the name for findmeth and the attribute ops, or the register
+     * holding the type for istype. */
+    MVMuint32 operand;
+
+    /* The op the site was made from. */
+    MVMuint16 orig_op;
+
+    /* Whether we saw no, one or many types here. */
+    MVMuint8 log_state;
+
+    /* The type seen, along with the type object it was checked against. */
+    MVMSTable *log_st;
+    MVMObject *log_obj;
+
+    /* Once specialized, the type and type object we must see for the result
+     * to apply, and their cache versions at the time we worked it out. */
+    MVMSTable *guard_st;
+    MVMObject *guard_obj;
+    MVMuint32  guard_version;
+    MVMuint32  guard_obj_version;
+
+    /* The outcome: a type check result. */
+    MVMint64   value;
+
+    /* For findmeth and attribute sites, the inline cache and the number of
+     * its entries in use; once all are, further types take the slow path. */
+    MVMSpeshICEntry *ic;
+    AO_t             ic_entries;
+};
+
+/* Checks if a site's guard holds for the given object and type object.
+ * guard_st is written last when specializing a site, so it
+ * being set means the rest of the site can be used. */
+MVM_STATIC_INLINE MVMint64 MVM_spesh_guard(MVMSpeshSite *site, MVMObject *obj, MVMObject *extra) {
+    MVMSTable *st = site->guard_st;
+    return obj && STABLE(obj) == st && site->guard_obj == extra &&
+        st->cache_version == site->guard_version;
+}
+
+/* Looks up a type, along with the class handle for attribute sites (NULL
+ * for findmeth), in a site's inline cache. Entries are filled in once and
+ * never moved, and an entry's type is written last, so a match on it means
+ * the rest of the entry is there. */
+MVM_STATIC_INLINE MVMSpeshICEntry * MVM_spesh_ic_lookup(MVMSpeshSite *site, MVMSTable *st, MVMObject *ch) {
+    MVMuint32 i, n = (MVMuint32)site->ic_entries;
+    for (i = 0; i < n; i++) {
+        MVMSpeshICEntry *entry = &site->ic[i];
+        if (entry->st == st && entry->version == st->cache_version &&
+                (!ch || entry->obj == ch))
+            return entry;
+    }
+    return NULL;
+}
+
+void MVM_spesh_check(MVMThreadContext *tc, MVMStaticFrame *sf);
+void MVM_spesh_log(MVMThreadContext *tc, MVMSpeshSite *site, MVMObject *obj, MVMObject *extra);
+void MVM_spesh_find_method(MVMThreadContext *tc, MVMSpeshSite *site, MVMObject *obj,
+    MVMString *name, MVMRegister *res);
+void MVM_spesh_get_attribute(MVMThreadContext *tc, MVMSpeshSite *site, MVMObject *obj,
+    MVMObject *class_handle, MVMint16 hint, MVMRegister *result, MVMuint16 kind);
+void MVM_spesh_bind_attribute(MVMThreadContext *tc, MVMSpeshSite *site, MVMObject *obj,
+    MVMObject *class_handle, MVMint16 hint, MVMRegister value, MVMuint16 kind);
+void MVM_spesh_gc_mark(MVMThreadContext *tc, MVMStaticFrameBody *body, MVMGCWorklist *worklist);
+void MVM_spesh_destroy(MVMThreadContext *tc, MVMStaticFrameBody *body);
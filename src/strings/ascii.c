@@ -4,7 +4,6 @@
  * a result of the specified type. The type must have the MVMString REPR. */
 MVMString * MVM_string_ascii_decode(MVMThreadContext *tc, MVMObject *result_type, const char *ascii, size_t bytes) {
     MVMString *result = (MVMString *)REPR(result_type)->allocate(tc, STABLE(result_type));
-    size_t i;
 
     /* There's no combining chars and such stuff in ASCII, so the codes
      * count and grapheme count are trivially the same as the buffer
@@ -13,13 +12,11 @@ MVMString * MVM_string_ascii_decode(MVMThreadContext *tc, MVMObject *result_type
     result->body.graphs = bytes;
 
     /* Allocate grapheme buffer and decode the ASCII string. */
+    if (MVM_string_ascii_prefix((const MVMuint8 *)ascii, bytes) != bytes)
+        MVM_exception_throw_adhoc(tc,
+            "Will not decode invalid ASCII (code point > 127 found)");
     result->body.uint8s = malloc(sizeof(MVMCodepoint8) * bytes);
-    for (i = 0; i < bytes; i++)
-        if (ascii[i] <= 127)
-            result->body.uint8s[i] = ascii[i];
-        else
-            MVM_exception_throw_adhoc(tc,
-                "Will not decode invalid ASCII (code point > 127 found)");
+    memcpy(result->body.uint8s, ascii, bytes);
     result->body.flags = MVM_STRING_TYPE_UINT8;
 
     return result;
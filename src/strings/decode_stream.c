@@ -72,7 +72,7 @@ void MVM_string_decodestream_discard_to(MVMThreadContext *tc, MVMDecodeStream *d
 }
 
 /* Does a decode run, selected by encoding. */
-static run_decode(MVMThreadContext *tc, MVMDecodeStream *ds, MVMint32 *stopper_chars, MVMint32 *stopper_sep) {
+static void run_decode(MVMThreadContext *tc, MVMDecodeStream *ds, MVMint32 *stopper_chars, MVMint32 *stopper_sep) {
     switch (ds->encoding) {
     case MVM_encoding_type_utf8:
         MVM_string_utf8_decodestream(tc, ds, stopper_chars, stopper_sep);
@@ -181,8 +181,113 @@ MVMint32 find_separator(MVMThreadContext *tc, MVMDecodeStream *ds, MVMCodepoint3
     }
     return 0;
 }
+
+/* Checks if lines can be taken straight from the byte buffers. */
+static MVMint32 can_scan_bytes(MVMDecodeStream *ds, MVMCodepoint32 sep) {
+    if (ds->chars_head || sep < 0 || sep > 127)
+        return 0;
+    switch (ds->encoding) {
+    case MVM_encoding_type_utf8:
+    case MVM_encoding_type_ascii:
+    case MVM_encoding_type_latin1:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/* Checks that a line's bytes will decode without error. */
+static MVMint32 line_bytes_valid(MVMDecodeStream *ds, char *line, size_t length) {
+    switch (ds->encoding) {
+    case MVM_encoding_type_utf8:
+        return MVM_string_utf8_valid(line, length);
+    case MVM_encoding_type_ascii:
+        return MVM_string_ascii_prefix((MVMuint8 *)line, length) == length;
+    default:
+        return 1;
+    }
+}
+
+/* Gets characters up until the specified separator straight from the byte
+ * buffers, decoding them once into the result string. This is possible when
+ * there are no already decoded chars waiting, and the separator is ASCII
+ * in an encoding where ASCII bytes only ever stand for themselves, so that
+ * it can be looked for with memchr. Only if the line spans byte buffers are
+ * they first copied together; such a copy is checked before decoding, so
+ * the decoder won't throw with it still allocated. Returns zero if the check
+ * fails, leaving the line to the usual decoding (which reports the error).
+ * Otherwise, puts the line in result, or NULL if the separator isn't found,
+ * leaving the bytes to be decoded when more arrive. */
+static MVMint32 take_line_from_bytes(MVMThreadContext *tc, MVMDecodeStream *ds, MVMCodepoint32 sep,
+        MVMString **result) {
+    MVMDecodeStreamBytes *cur_bytes = ds->bytes_head;
+    char      *line, *copy = NULL;
+    size_t     length = 0;
+    MVMint32   end = 0;
+
+    /* Find the separator. */
+    while (cur_bytes) {
+        MVMint32  start = cur_bytes == ds->bytes_head ? ds->bytes_head_pos : 0;
+        char     *found = memchr(cur_bytes->bytes + start, (int)sep, cur_bytes->length - start);
+        if (found) {
+            end     = (MVMint32)(found - cur_bytes->bytes) + 1;
+            length += end - start;
+            break;
+        }
+        length += cur_bytes->length - start;
+        cur_bytes = cur_bytes->next;
+    }
+    if (!cur_bytes) {
+        *result = NULL;
+        return 1;
+    }
+
+    /* Get the line's bytes in one piece. */
+    if (cur_bytes == ds->bytes_head) {
+        line = ds->bytes_head->bytes + ds->bytes_head_pos;
+    }
+    else {
+        MVMDecodeStreamBytes *piece = ds->bytes_head;
+        size_t pos = 0;
+        line = copy = malloc(length);
+        while (piece != cur_bytes) {
+            MVMint32 start = piece == ds->bytes_head ? ds->bytes_head_pos : 0;
+            memcpy(copy + pos, piece->bytes + start, piece->length - start);
+            pos  += piece->length - start;
+            piece = piece->next;
+        }
+        memcpy(copy + pos, cur_bytes->bytes, end);
+        if (!line_bytes_valid(ds, copy, length)) {
+            free(copy);
+            return 0;
+        }
+    }
+
+    /* Decode it, and then throw away the bytes. */
+    switch (ds->encoding) {
+    case MVM_encoding_type_utf8:
+        *result = MVM_string_utf8_decode_compact_nobom(tc, tc->instance->VMString, line, length);
+        break;
+    case MVM_encoding_type_ascii:
+        *result = MVM_string_ascii_decode(tc, tc->instance->VMString, line, length);
+        break;
+    default:
+        *result = MVM_string_latin1_decode(tc, tc->instance->VMString, (MVMuint8 *)line, length);
+        break;
+    }
+    if (copy)
+        free(copy);
+    MVM_string_decodestream_discard_to(tc, ds, cur_bytes, end);
+    return 1;
+}
+
 MVMString * MVM_string_decodestream_get_until_sep(MVMThreadContext *tc, MVMDecodeStream *ds, MVMCodepoint32 sep) {
-    MVMint32 sep_loc;
+    MVMString *line;
+    MVMint32   sep_loc;
+
+    /* If we can, decode the line straight from the bytes. */
+    if (can_scan_bytes(ds, sep) && take_line_from_bytes(tc, ds, sep, &line))
+        return line;
 
     /* Look for separator, trying more decoding if it fails. We get the place
      * just beyond the separator, so can use take_chars to get what's need. */
@@ -2,20 +2,18 @@
 
 /* Decodes the specified number of bytes of latin1 into an NFG string,
  * creating a result of the specified type. The type must have the MVMString
- * REPR. */
+ * REPR. Every latin1 codepoint fits in 8 bits, so the bytes are copied
+ * straight into an 8-bit string. */
 MVMString * MVM_string_latin1_decode(MVMThreadContext *tc, MVMObject *result_type, 
                                      MVMuint8 *latin1, size_t bytes) {
     MVMString *result = (MVMString *)REPR(result_type)->allocate(tc, STABLE(result_type));
-    size_t i;
 
     result->body.codes  = bytes;
     result->body.graphs = bytes;
-    result->body.flags  = MVM_STRING_TYPE_INT32;
-    result->body.int32s = malloc(sizeof(MVMint32) * bytes);
+    result->body.flags  = MVM_STRING_TYPE_UINT8;
+    result->body.uint8s = malloc(sizeof(MVMCodepoint8) * (bytes ? bytes : 1));
+    memcpy(result->body.uint8s, latin1, bytes);
 
-    for (i = 0; i < bytes; i++)
-        result->body.int32s[i] = latin1[i];
-    
     return result;
 }
 
@@ -1,98 +1,100 @@
 #include "moar.h"
 
-/*  TODO:
-- add a tunable global determining at what depth it should
-    start flattening.  Write a rope-tree-flattening function
-    (not like string_flatten) that puts all the sub strands
-    in one MVMStrand array.
-    (optimization)
-- add a tunable global determining under which size result
-    string should it just do the old copying behavior, for
-    join, concat, split, and repeat.
-    This might be related to MVMString object size?
-    (optimization)
-- make the uc, lc, tc functions intelligently
-    create ropes from the originals when deemed advantageous.
-    (optimization)
-*/
+/* Strings made by concatenating, joining, repeating or taking substrings
+ * are ropes: tables of strands, each referring to part of another string,
+ * unless they are short enough that copying is cheaper (see
+ * MVM_STRING_COPY_THRESHOLD). Each rope we make is checked by balance_rope,
+ * which keeps the depth of the tree bounded and stops ropes of many tiny
+ * strands from building up. */
 
 static MVMStrandIndex find_strand_index(MVMString *s, MVMStringIndex index);
 
-/* for physical strings, applies the consumer function directly. For
- * "ropes", performs the binary search as directed by the strands table
- * to find the first starting strand index of the desired substring.
- * Then recursively traverses more strands until the desired number of
- * characters are passed to the consumer function from the strand tree.
- * Both this and the consumer function return a boolean saying whether
- * to abort the traversal early. */
-MVMuint8 MVM_string_traverse_substring(MVMThreadContext *tc, MVMString *a, MVMStringIndex start, MVMStringIndex length, MVMStringIndex top_index, MVMSubstringConsumer consumer, void *data) {
+/* Starts walking the flat strings making up the given range of a string. */
+void MVM_string_strand_iter_init(MVMThreadContext *tc, MVMStrandIter *iter, MVMString *s, MVMStringIndex start, MVMStringIndex length) {
+    iter->depth        = 0;
+    iter->flat_pending = 0;
+    iter->string       = NULL;
+    iter->start        = 0;
+    iter->length       = 0;
+    if (!length)
+        return;
+    if (IS_ROPE(s)) {
+        iter->levels[0].rope   = s;
+        iter->levels[0].strand = find_strand_index(s, start);
+        iter->levels[0].pos    = start;
+        iter->levels[0].end    = start + length;
+        iter->depth            = 1;
+    }
+    else {
+        iter->string       = s;
+        iter->start        = start;
+        iter->length       = length;
+        iter->flat_pending = 1;
+    }
+}
 
-    switch(STR_FLAGS(a)) {
-        case MVM_STRING_TYPE_INT32:
-        case MVM_STRING_TYPE_UINT8:
-            return consumer(tc, a, start, length, top_index, data);
-        case MVM_STRING_TYPE_ROPE: {
-            MVMStrand *strands = a->body.strands;
-            MVMStrandIndex lower = 255;
-            MVMStringIndex index = start;
-            MVMStrandIndex strand_index = find_strand_index(a, index);
-            MVMStrand *strand = a->body.strands + strand_index;
-            for(;;) {
-                MVMuint8 return_val;
-                /* get the number of available codepoints from
-                 * this strand. */
-                MVMStringIndex substring_length =
-                    strands[strand_index + 1].compare_offset - index;
-                /* determine how many codepoints to actually consume */
-                if (length < substring_length)
-                    substring_length = length;
-                /* call ourself on the sub-strand */
-                return_val = MVM_string_traverse_substring(tc, strand->string,
-                    index - strand->compare_offset + strand->string_offset,
-                    substring_length, top_index + index, consumer, data);
-                /* if we've been instructed to, abort early */
-                if (return_val)
-                    return return_val;
-                /* reduce the number of codepoints requested by the number
-                 * consumed. */
-                length -= substring_length;
-                /* if we've consumed all the codepoints, return without
-                 * indicating abort early. */
-                if (!length)
-                    return 0;
-                /* advance the index by the number of codepoints consumed. */
-                index += substring_length;
-                /* advance in the strand table. The caller must guarantee
-                 * this won't overflow by checking lengths. */
-                strand = &strands[++strand_index];
-            }
+/* Moves to the next flat piece. Returns zero once there are none left. */
+MVMuint8 MVM_string_strand_iter_next(MVMThreadContext *tc, MVMStrandIter *iter) {
+    if (iter->flat_pending) {
+        iter->flat_pending = 0;
+        return 1;
+    }
+    while (iter->depth) {
+        MVMString      *rope = iter->levels[iter->depth - 1].rope;
+        MVMStrandIndex  strand_index = iter->levels[iter->depth - 1].strand;
+        MVMStringIndex  pos = iter->levels[iter->depth - 1].pos;
+        MVMStringIndex  end = iter->levels[iter->depth - 1].end;
+        MVMStrand      *strand;
+        MVMStringIndex  strand_end, child_start, length;
+
+        /* done with this rope; go back up to the one holding it */
+        if (pos >= end) {
+            iter->depth--;
+            continue;
         }
-        default:
-            MVM_exception_throw_adhoc(tc, "internal string corruption");
+
+        /* take as much of the next strand as the range covers */
+        strand      = &rope->body.strands[strand_index];
+        strand_end  = rope->body.strands[strand_index + 1].compare_offset;
+        length      = (strand_end < end ? strand_end : end) - pos;
+        child_start = pos - strand->compare_offset + strand->string_offset;
+        iter->levels[iter->depth - 1].strand = strand_index + 1;
+        iter->levels[iter->depth - 1].pos    = pos + length;
+
+        if (IS_ROPE(strand->string)) {
+            if (iter->depth > MVM_STRING_MAX_STRAND_DEPTH)
+                MVM_exception_throw_adhoc(tc, "internal string corruption (rope too deep)");
+            iter->levels[iter->depth].rope   = strand->string;
+            iter->levels[iter->depth].strand = find_strand_index(strand->string, child_start);
+            iter->levels[iter->depth].pos    = child_start;
+            iter->levels[iter->depth].end    = child_start + length;
+            iter->depth++;
+            continue;
+        }
+
+        iter->string = strand->string;
+        iter->start  = child_start;
+        iter->length = length;
+        return 1;
     }
-    MVM_exception_throw_adhoc(tc, "internal string corruption");
+    return 0;
 }
 
-/* stack record created with each invocation of the string descent. */
-typedef struct CompareCursor {
-    MVMString *string; /* string into which descended */
-    struct CompareCursor *parent; /* parent cursor */
-    MVMint16 *gaps; /* number of gaps can ascend */
-    MVMStringIndex string_idx; /* in string, not strand */
-    MVMStringIndex end_idx; /* index past last codepoint needed */
-    MVMStrandIndex strand_idx; /* current strand index */
-    MVMuint8 owns_buffer; /* whether it owns the last buffer.
-            for ropes, whether it's uninitialized. */
-    MVMuint8 isa; /* whether it's from string tree a */
-} CompareCursor;
-
-typedef struct {
-    CompareCursor *cursora, *cursorb; /* cursors */
-    MVMCodepoint32 *int32s; /* last physical string's buffer */
-    MVMCodepoint8 *uint8s; /* last physical string's buffer */
-    MVMStringIndex available; /* number of codepoints in the buffer */
-    MVMStringIndex needed; /* number of codepoints still needed */
-} CompareDescentState;
+/* Passes the flat pieces making up the given range of a string to the
+ * consumer function in turn, along with the position in the range (plus
+ * top_index) at which each starts. Both this and the consumer function
+ * return a boolean saying whether to abort the traversal early. */
+MVMuint8 MVM_string_traverse_substring(MVMThreadContext *tc, MVMString *a, MVMStringIndex start, MVMStringIndex length, MVMStringIndex top_index, MVMSubstringConsumer consumer, void *data) {
+    MVMStrandIter iter;
+    MVM_string_strand_iter_init(tc, &iter, a, start, length);
+    while (MVM_string_strand_iter_next(tc, &iter)) {
+        MVMuint8 return_val = consumer(tc, iter.string, iter.start, iter.length, top_index, data);
+        if (return_val)
+            return return_val;
+        top_index += iter.length;
+    }
+    return 0;
+}
 
 /* uses the computed binary search table to find the strand containing the index */
 static MVMStrandIndex find_strand_index(MVMString *s, MVMStringIndex index) {
@@ -107,163 +109,378 @@ static MVMStrandIndex find_strand_index(MVMString *s, MVMStringIndex index) {
     }
 }
 
-#define descend_sized_chew_success(member, other_member) \
-st->needed -= tocompare; \
-if (!st->needed) { \
-    *result = 2; \
-    return; \
-} \
-else if (wehave > tocompare) { \
-    st->member = c->string->body.member + c->string_idx + tocompare; \
-    st->available = wehave - tocompare; \
-    c->owns_buffer = 1; \
-    st->other_member = NULL; \
-} \
-else { \
-    st->other_member += tocompare; \
-    st->available -= tocompare; \
-} \
-
-#define descend_sized(member, other_member, size, other_size, cp, other_cp) \
-MVMStringIndex wehave = c->end_idx - c->string_idx; \
-if (st->available) { \
-    MVMStringIndex tocompare = st->available < wehave ? st->available : wehave; \
-    if (st->member) { \
-        if (memcmp(st->member, c->string->body.member + c->string_idx, \
-               wehave * sizeof(size))) { \
-            *result = 1; \
-            return; \
-        } \
-        descend_sized_chew_success(member, other_member) \
-    } \
-    else { \
-        size \
-            *cp = c->string->body.member + c->string_idx, \
-            *final = cp + tocompare; \
-        other_size *other_cp = st->other_member; \
-        for (; cp < final; ) { \
-            if (*cp32++ != (MVMCodepoint32) *cp8++) { \
-                *result = 1; \
-                return; \
-            } \
-        } \
-        descend_sized_chew_success(other_member, member) \
-    } \
-    if (c->isa) { st->cursora = c->parent; } \
-    else { st->cursorb = c->parent; } \
-    return; \
-} \
-st->member = c->string->body.member + c->string_idx; \
-st->other_member = NULL; \
-st->available = wehave; \
-c->owns_buffer = 1; \
-continue;
-
-/* If a is composed of strands, create a descent record, initialize it, and
- * descend into the substring. If result is set when it returns, return.
- * If a is a real string, grab some codepoints from a string, compare
- * with codepoints from the other buffer. If different, set result nonzero and
- * it will fast return. Otherwise, reset buffer indexes
- * to zero. Loop if `needed` for the current string is nonzero. */
-static void compare_descend(MVMThreadContext *tc, CompareDescentState *st,
-        MVMuint8 *result, CompareCursor *orig) {
-    /* while we still need to compare some things */
-    while (st->needed) {
-        /* pick a tree from which to get more characters. */
-        CompareCursor *c = st->cursora->owns_buffer ? st->cursorb : st->cursora;
-
-        if (*c->gaps) {
-            (*c->gaps)--;
-            if (c->isa) { st->cursora = c->parent; }
-            else { st->cursorb = c->parent; }
-            return;
-        }
-
-        /* get some characters, comparing as they're found */
-        switch(STR_FLAGS(c->string)) {
-            case MVM_STRING_TYPE_INT32: {
-                descend_sized(int32s, uint8s, MVMCodepoint32, MVMCodepoint8, cp32, cp8)
-            }
-            case MVM_STRING_TYPE_UINT8: {
-                descend_sized(uint8s, int32s, MVMCodepoint8, MVMCodepoint32, cp8, cp32)
-            }
-            case MVM_STRING_TYPE_ROPE: {
-                MVMStrand *strand;
-                MVMStringIndex next_compare_offset, child_length, child_idx, child_end_idx;
-                if (c->owns_buffer) { /* first time we've seen this rope */
-                    c->strand_idx = find_strand_index(c->string, c->string_idx);
-                    c->owns_buffer = 0;
-                }
-                if (c->string_idx == c->end_idx) {
-                    if (c->isa) { st->cursora = c->parent; }
-                    else { st->cursorb = c->parent; }
-                    if (orig == c)
-                        return;
-                    (*c->gaps)++;
-                    continue;
-                }
-                strand = c->string->body.strands + c->strand_idx;
-                child_idx = c->string_idx - strand->compare_offset;
-                next_compare_offset = (strand + 1)->compare_offset;
-                child_length = next_compare_offset - strand->compare_offset;
-                child_length = child_length > c->end_idx - c->string_idx
-                    ? c->end_idx - c->string_idx : child_length;
-                child_end_idx = child_idx + child_length;
-                c->string_idx += child_length;
-                c->strand_idx++;
-                {
-                    CompareCursor child = { strand->string, c, c->gaps, child_idx,
-                        child_end_idx, 0, IS_ROPE(strand->string), c->isa };
-                    if (c->isa) { st->cursora = &child; } else { st->cursorb = &child; }
-                    compare_descend(tc, st, result, &child);
-                }
-                if (*result) return;
-                continue;
-            }
-            default:
-                MVM_exception_throw_adhoc(tc, "internal string corruption");
-        }
+/* Compares length graphemes of two flat strings. */
+static MVMint64 pieces_equal(MVMString *a, MVMStringIndex starta, MVMString *b,
+        MVMStringIndex startb, MVMStringIndex length) {
+    MVMStringIndex i;
+    if (IS_WIDE(a) && IS_WIDE(b))
+        return memcmp(a->body.int32s + starta, b->body.int32s + startb,
+            length * sizeof(MVMCodepoint32)) == 0;
+    if (IS_8BIT(a) && IS_8BIT(b))
+        return memcmp(a->body.uint8s + starta, b->body.uint8s + startb,
+            length * sizeof(MVMCodepoint8)) == 0;
+    if (IS_WIDE(a)) {
+        for (i = 0; i < length; i++)
+            if (a->body.int32s[starta + i] != (MVMCodepoint32)b->body.uint8s[startb + i])
+                return 0;
+    }
+    else {
+        for (i = 0; i < length; i++)
+            if ((MVMCodepoint32)a->body.uint8s[starta + i] != b->body.int32s[startb + i])
+                return 0;
     }
-    *result = 2;
+    return 1;
 }
 
 /* returns nonzero if two substrings are equal, doesn't check bounds */
 MVMint64 MVM_string_substrings_equal_nocheck(MVMThreadContext *tc, MVMString *a,
         MVMint64 starta, MVMint64 length, MVMString *b, MVMint64 startb) {
-    MVMint16 gapsa = 0, gapsb = 0;
-    MVMuint8 result = 0;
-    CompareCursor
-        cursora = { a, NULL, &gapsa, starta, starta + length, 0, IS_ROPE(a), 1 },
-        cursorb = { b, NULL, &gapsb, startb, startb + length, 0, IS_ROPE(b), 0 };
-    CompareDescentState st = { &cursora, &cursorb, NULL, NULL, 0, length };
+    MVMStrandIter itera, iterb;
+
+    if (!length)
+        return 1;
+    MVM_string_strand_iter_init(tc, &itera, a, (MVMStringIndex)starta, (MVMStringIndex)length);
+    MVM_string_strand_iter_init(tc, &iterb, b, (MVMStringIndex)startb, (MVMStringIndex)length);
+    MVM_string_strand_iter_next(tc, &itera);
+    MVM_string_strand_iter_next(tc, &iterb);
 
-    compare_descend(tc, &st, &result, &cursora);
-    return result ? result - 1 : 1;
+    /* compare the overlap of the current pieces, then move past it */
+    while (1) {
+        MVMStringIndex n = itera.length < iterb.length ? itera.length : iterb.length;
+        if (!pieces_equal(itera.string, itera.start, iterb.string, iterb.start, n))
+            return 0;
+        itera.start += n; itera.length -= n;
+        iterb.start += n; iterb.length -= n;
+        if (!itera.length && !MVM_string_strand_iter_next(tc, &itera))
+            return 1;
+        if (!iterb.length)
+            MVM_string_strand_iter_next(tc, &iterb);
+    }
 }
 
 /* returns the codepoint without doing checks, for internal VM use only. */
 MVMCodepoint32 MVM_string_get_codepoint_at_nocheck(MVMThreadContext *tc, MVMString *a, MVMint64 index) {
     MVMStringIndex idx = (MVMStringIndex)index;
 
-    switch(STR_FLAGS(a)) {
-        case MVM_STRING_TYPE_INT32:
-            return a->body.int32s[idx];
-        case MVM_STRING_TYPE_UINT8:
-            return (MVMCodepoint32)a->body.uint8s[idx];
-        case MVM_STRING_TYPE_ROPE: {
-            MVMStrand *strand = a->body.strands + find_strand_index(a, idx);
-            return MVM_string_get_codepoint_at_nocheck(tc,
-                strand->string, idx - strand->compare_offset + strand->string_offset);
+    while (1) {
+        switch(STR_FLAGS(a)) {
+            case MVM_STRING_TYPE_INT32:
+                return a->body.int32s[idx];
+            case MVM_STRING_TYPE_UINT8:
+                return (MVMCodepoint32)a->body.uint8s[idx];
+            case MVM_STRING_TYPE_ROPE: {
+                MVMStrand *strand = a->body.strands + find_strand_index(a, idx);
+                idx = idx - strand->compare_offset + strand->string_offset;
+                a   = strand->string;
+                break;
+            }
+            default:
+                MVM_exception_throw_adhoc(tc, "internal string corruption");
+        }
+    }
+}
+
+/* Copies the graphemes in the given range of a string into a buffer. */
+static void copy_graphemes(MVMThreadContext *tc, MVMString *s, MVMStringIndex start,
+        MVMStringIndex length, MVMCodepoint32 *buffer) {
+    MVMStrandIter iter;
+    MVM_string_strand_iter_init(tc, &iter, s, start, length);
+    while (MVM_string_strand_iter_next(tc, &iter)) {
+        if (IS_WIDE(iter.string)) {
+            memcpy(buffer, iter.string->body.int32s + iter.start,
+                iter.length * sizeof(MVMCodepoint32));
+        }
+        else {
+            MVMCodepoint8  *from = iter.string->body.uint8s + iter.start;
+            MVMStringIndex  i;
+            for (i = 0; i < iter.length; i++)
+                buffer[i] = from[i];
         }
+        buffer += iter.length;
     }
-    MVM_exception_throw_adhoc(tc, "internal string corruption");
+}
+
+/* Checks if part of a string is made up only of 8-bit flat strings, so a
+ * copy of it can be 8-bit too. */
+static MVMuint8 is_all_8bit(MVMThreadContext *tc, MVMString *s, MVMStringIndex start,
+        MVMStringIndex length) {
+    MVMStrandIter iter;
+    MVM_string_strand_iter_init(tc, &iter, s, start, length);
+    while (MVM_string_strand_iter_next(tc, &iter))
+        if (IS_WIDE(iter.string))
+            return 0;
+    return 1;
+}
+
+/* Copies the graphemes of part of a string made up only of 8-bit flat
+ * strings into an 8-bit buffer. */
+static void copy_graphemes_8bit(MVMThreadContext *tc, MVMString *s, MVMStringIndex start,
+        MVMStringIndex length, MVMCodepoint8 *buffer) {
+    MVMStrandIter iter;
+    MVM_string_strand_iter_init(tc, &iter, s, start, length);
+    while (MVM_string_strand_iter_next(tc, &iter)) {
+        memcpy(buffer, iter.string->body.uint8s + iter.start, iter.length);
+        buffer += iter.length;
+    }
+}
+
+/* Needles of at least this many graphemes are searched for with
+ * Boyer-Moore-Horspool; shorter ones by scanning for their first grapheme
+ * (using memchr for 8-bit strings) and comparing the rest. */
+#define MVM_STRING_INDEX_HORSPOOL_MIN 4
+
+/* A needle prepared for searching. */
+typedef struct {
+    /* The needle's codepoints, and the same as bytes if they all fit (else
+     * NULL, as it can't occur in an 8-bit string). */
+    MVMCodepoint32 *cps;
+    MVMCodepoint8  *cp8s;
+    MVMStringIndex  length;
+
+    /* Horspool shifts, indexed by the low byte of a codepoint. Codepoints
+     * sharing a low byte share the smallest shift of any of them. For
+     * searches from the end, these are shifts towards the start. */
+    MVMStringIndex  shift[256];
+} Needle;
+
+/* A physical piece of a haystack. */
+typedef struct {
+    MVMString      *string;
+    MVMStringIndex  start;
+    MVMStringIndex  length;
+} Segment;
+
+typedef struct {
+    Segment        *segments;
+    MVMStringIndex  used;
+    MVMStringIndex  alloc;
+} SegmentState;
+
+static MVM_SUBSTRING_CONSUMER(segment_consumer) {
+    SegmentState *state = (SegmentState *)data;
+    if (state->used == state->alloc) {
+        state->alloc = state->alloc ? state->alloc * 2 : 16;
+        state->segments = realloc(state->segments, state->alloc * sizeof(Segment));
+    }
+    state->segments[state->used].string = string;
+    state->segments[state->used].start  = start;
+    state->segments[state->used].length = length;
+    state->used++;
     return 0;
 }
 
+static void needle_init(MVMThreadContext *tc, Needle *n, MVMString *needle, MVMuint8 reverse) {
+    MVMStringIndex m = NUM_GRAPHS(needle), i;
+
+    n->length = m;
+    n->cps    = malloc(m * sizeof(MVMCodepoint32));
+    copy_graphemes(tc, needle, 0, m, n->cps);
+
+    n->cp8s = malloc(m);
+    for (i = 0; i < m; i++) {
+        if (n->cps[i] < 0 || n->cps[i] > 255) {
+            MVM_checked_free_null(n->cp8s);
+            break;
+        }
+        n->cp8s[i] = (MVMCodepoint8)n->cps[i];
+    }
+
+    if (m >= MVM_STRING_INDEX_HORSPOOL_MIN) {
+        for (i = 0; i < 256; i++)
+            n->shift[i] = m;
+        if (reverse)
+            for (i = m - 1; i > 0; i--)
+                n->shift[n->cps[i] & 0xFF] = i;
+        else
+            for (i = 0; i < m - 1; i++)
+                n->shift[n->cps[i] & 0xFF] = m - 1 - i;
+    }
+}
+
+static void needle_destroy(Needle *n) {
+    MVM_checked_free_null(n->cps);
+    MVM_checked_free_null(n->cp8s);
+}
+
+/* Searches a flat buffer h for the needle, at positions lo to hi (both
+ * relative to h, with hi no further than its length less the needle's).
+ * Returns the first position (or with reverse, the last) or -1. */
+#define search_flat(name, type) \
+static MVMint64 name(const type *h, Needle *n, MVMint64 lo, MVMint64 hi, MVMuint8 reverse) { \
+    const MVMCodepoint32 *nc = n->cps; \
+    MVMint64 m = (MVMint64)n->length, p, i; \
+    if (m < MVM_STRING_INDEX_HORSPOOL_MIN) { \
+        if (reverse) { \
+            for (p = hi; p >= lo; p--) { \
+                if ((MVMCodepoint32)h[p] != nc[0]) continue; \
+                for (i = 1; i < m && (MVMCodepoint32)h[p + i] == nc[i]; i++); \
+                if (i == m) return p; \
+            } \
+        } \
+        else { \
+            for (p = lo; p <= hi; p++) { \
+                if ((MVMCodepoint32)h[p] != nc[0]) continue; \
+                for (i = 1; i < m && (MVMCodepoint32)h[p + i] == nc[i]; i++); \
+                if (i == m) return p; \
+            } \
+        } \
+    } \
+    else if (reverse) { \
+        for (p = hi; p >= lo; p -= (MVMint64)n->shift[(MVMCodepoint32)h[p] & 0xFF]) { \
+            if ((MVMCodepoint32)h[p] != nc[0]) continue; \
+            for (i = m - 1; i > 0 && (MVMCodepoint32)h[p + i] == nc[i]; i--); \
+            if (i == 0) return p; \
+        } \
+    } \
+    else { \
+        for (p = lo; p <= hi; p += (MVMint64)n->shift[(MVMCodepoint32)h[p + m - 1] & 0xFF]) { \
+            if ((MVMCodepoint32)h[p + m - 1] != nc[m - 1]) continue; \
+            for (i = 0; i < m - 1 && (MVMCodepoint32)h[p + i] == nc[i]; i++); \
+            if (i == m - 1) return p; \
+        } \
+    } \
+    return -1; \
+}
+search_flat(search_flat32, MVMCodepoint32)
+search_flat(search_flat8, MVMCodepoint8)
+
+/* Searches a flat string, from the given start, for the needle. */
+static MVMint64 search_segment(MVMString *s, MVMStringIndex start, Needle *n,
+        MVMint64 lo, MVMint64 hi, MVMuint8 reverse) {
+    MVMint64 m = (MVMint64)n->length;
+    if (lo > hi)
+        return -1;
+    if (IS_WIDE(s))
+        return search_flat32(s->body.int32s + start, n, lo, hi, reverse);
+
+    /* A needle with codepoints outside of 8 bits can't be in here. */
+    if (!n->cp8s)
+        return -1;
+
+    /* memchr is typically vectorized, so use it to find the first byte. */
+    if (!reverse && m < MVM_STRING_INDEX_HORSPOOL_MIN) {
+        const MVMCodepoint8 *h = s->body.uint8s + start;
+        MVMint64 p = lo;
+        while (p <= hi) {
+            const MVMCodepoint8 *found = memchr(h + p, n->cp8s[0], (size_t)(hi - p + 1));
+            if (!found)
+                return -1;
+            p = found - h;
+            if (memcmp(h + p + 1, n->cp8s + 1, (size_t)(m - 1)) == 0)
+                return p;
+            p++;
+        }
+        return -1;
+    }
+    return search_flat8(s->body.uint8s + start, n, lo, hi, reverse);
+}
+
+/* Checks if the needle occurs at the given offset into a segment, carrying
+ * on into the following segments as needed. */
+static MVMint64 matches_across(SegmentState *segs, MVMStringIndex seg_idx,
+        MVMStringIndex offset, Needle *n) {
+    MVMStringIndex i = 0;
+    while (i < n->length && seg_idx < segs->used) {
+        Segment *seg = &segs->segments[seg_idx];
+        for (; offset < seg->length && i < n->length; offset++, i++) {
+            MVMCodepoint32 cp = IS_WIDE(seg->string)
+                ? seg->string->body.int32s[seg->start + offset]
+                : (MVMCodepoint32)seg->string->body.uint8s[seg->start + offset];
+            if (cp != n->cps[i])
+                return 0;
+        }
+        seg_idx++;
+        offset = 0;
+    }
+    return i == n->length;
+}
+
+/* Finds the needle in the haystack at a position from lo to hi, which the
+ * caller has checked fit. Flat haystacks are searched directly. For ropes,
+ * we search each of the physical strings making up the range in turn,
+ * checking the few positions where a match would straddle two of them
+ * separately, so the rope need not be flattened. */
+static MVMint64 string_search(MVMThreadContext *tc, MVMString *haystack, MVMString *needle,
+        MVMint64 lo, MVMint64 hi, MVMuint8 reverse) {
+    Needle       n;
+    SegmentState segs = { NULL, 0, 0 };
+    MVMint64     result = -1, m, pos, i;
+
+    needle_init(tc, &n, needle, reverse);
+    m = (MVMint64)n.length;
+
+    if (!IS_ROPE(haystack)) {
+        result = search_segment(haystack, 0, &n, lo, hi, reverse);
+        needle_destroy(&n);
+        return result;
+    }
+
+    MVM_string_traverse_substring(tc, haystack, lo, hi + m - lo, 0, segment_consumer, &segs);
+    pos = lo;
+    if (reverse)
+        for (i = 0; i < (MVMint64)segs.used; i++)
+            pos += segs.segments[i].length;
+    for (i = 0; i < (MVMint64)segs.used; i++) {
+        /* With reverse, go through the segments from the end. */
+        MVMStringIndex seg_idx = reverse ? segs.used - 1 - i : i;
+        Segment *seg = &segs.segments[seg_idx];
+        MVMint64 seg_pos, inside_hi, straddle_lo, straddle_hi, p;
+        if (reverse) {
+            pos    -= seg->length;
+            seg_pos = pos;
+        }
+        else {
+            seg_pos = pos;
+            pos    += seg->length;
+        }
+
+        /* Positions in the segment at which the needle fits inside it, and
+         * those from which it runs into the next one. */
+        inside_hi   = seg_pos + (MVMint64)seg->length - m;
+        straddle_lo = inside_hi + 1 > seg_pos ? inside_hi + 1 : seg_pos;
+        straddle_hi = seg_pos + (MVMint64)seg->length - 1;
+        if (straddle_hi > hi)
+            straddle_hi = hi;
+        if (inside_hi > hi)
+            inside_hi = hi;
+
+        if (!reverse) {
+            p = search_segment(seg->string, seg->start, &n, 0, inside_hi - seg_pos, 0);
+            if (p >= 0) {
+                result = seg_pos + p;
+                break;
+            }
+            for (p = straddle_lo; p <= straddle_hi; p++)
+                if (matches_across(&segs, seg_idx, p - seg_pos, &n)) {
+                    result = p;
+                    break;
+                }
+            if (result >= 0)
+                break;
+        }
+        else {
+            for (p = straddle_hi; p >= straddle_lo; p--)
+                if (matches_across(&segs, seg_idx, p - seg_pos, &n)) {
+                    result = p;
+                    break;
+                }
+            if (result >= 0)
+                break;
+            p = search_segment(seg->string, seg->start, &n, 0, inside_hi - seg_pos, 1);
+            if (p >= 0) {
+                result = seg_pos + p;
+                break;
+            }
+        }
+    }
+
+    MVM_checked_free_null(segs.segments);
+    needle_destroy(&n);
+    return result;
+}
+
 /* Returns the location of one string in another or -1  */
 MVMint64 MVM_string_index(MVMThreadContext *tc, MVMString *haystack, MVMString *needle, MVMint64 start) {
-    MVMint64 result = -1;
-    size_t index    = (size_t)start;
     MVMStringIndex hgraphs = NUM_GRAPHS(haystack), ngraphs = NUM_GRAPHS(needle);
 
     if (!IS_CONCRETE((MVMObject *)haystack)) {
@@ -285,21 +502,15 @@ MVMint64 MVM_string_index(MVMThreadContext *tc, MVMString *haystack, MVMString *
 
     if (ngraphs > hgraphs || ngraphs < 1)
         return -1;
-    /* brute force for now. horrible, yes. halp. */
-    while (index <= hgraphs - ngraphs) {
-        if (MVM_string_substrings_equal_nocheck(tc, needle, 0, ngraphs, haystack, index)) {
-            result = (MVMint64)index;
-            break;
-        }
-        index++;
-    }
-    return result;
+
+    if (start > hgraphs - ngraphs)
+        return -1;
+
+    return string_search(tc, haystack, needle, start, hgraphs - ngraphs, 0);
 }
 
 /* Returns the location of one string in another or -1  */
 MVMint64 MVM_string_index_from_end(MVMThreadContext *tc, MVMString *haystack, MVMString *needle, MVMint64 start) {
-    MVMint64 result = -1;
-    size_t index;
     MVMStringIndex hgraphs = NUM_GRAPHS(haystack), ngraphs = NUM_GRAPHS(needle);
 
     if (!IS_CONCRETE((MVMObject *)haystack)) {
@@ -326,16 +537,228 @@ MVMint64 MVM_string_index_from_end(MVMThreadContext *tc, MVMString *haystack, MV
     if (ngraphs > hgraphs || ngraphs < 1)
         return -1;
 
-    index = start;
+    /* A match can't start any later than where the needle still fits. */
+    if (start > hgraphs - ngraphs)
+        start = hgraphs - ngraphs;
 
-    /* brute force for now. horrible, yes. halp. */
-    do {
-        if (MVM_string_substrings_equal_nocheck(tc, needle, 0, ngraphs, haystack, index)) {
-            result = (MVMint64)index;
-            break;
+    return string_search(tc, haystack, needle, 0, start, 1);
+}
+
+/* Makes a string we just allocated into a flat one holding the buffer. */
+static void set_flat(MVMString *s, MVMCodepoint32 *buffer, MVMStringIndex graphs) {
+    s->body.flags  = MVM_STRING_TYPE_INT32;
+    s->body.int32s = buffer;
+    s->body.graphs = graphs;
+}
+
+/* Likewise, for an 8-bit buffer. */
+static void set_flat_8bit(MVMString *s, MVMCodepoint8 *buffer, MVMStringIndex graphs) {
+    s->body.flags  = MVM_STRING_TYPE_UINT8;
+    s->body.uint8s = buffer;
+    s->body.graphs = graphs;
+}
+
+/* Makes a string we just allocated into a flat copy of the given part of
+ * another, which is 8-bit if all of that part is. */
+static void set_flat_copy(MVMThreadContext *tc, MVMString *result, MVMString *s,
+        MVMStringIndex start, MVMStringIndex length) {
+    if (is_all_8bit(tc, s, start, length)) {
+        MVMCodepoint8 *buffer = malloc(length);
+        copy_graphemes_8bit(tc, s, start, length, buffer);
+        set_flat_8bit(result, buffer, length);
+    }
+    else {
+        MVMCodepoint32 *buffer = malloc(sizeof(MVMCodepoint32) * length);
+        copy_graphemes(tc, s, start, length, buffer);
+        set_flat(result, buffer, length);
+    }
+}
+
+/* Points a strand at part of a string. A rope that is just part of one
+ * other string is skipped over, so it doesn't add to the depth. */
+static void set_strand(MVMStrand *strand, MVMString *s, MVMStringIndex start,
+        MVMStringIndex compare_offset) {
+    if (IS_ONE_STRING_ROPE(s)) {
+        start += s->body.strands->string_offset;
+        s      = s->body.strands->string;
+    }
+    strand->compare_offset = compare_offset;
+    strand->string         = s;
+    strand->string_offset  = start;
+}
+
+/* State for rebuilding a rope as a single strand table. Runs of short
+ * pieces are copied together into a buffer, which is only started once
+ * the run has a second piece; the runs copied are made into strings at
+ * the end. */
+typedef struct {
+    MVMStrand      *strands;
+    MVMStrandIndex  num_strands;
+    MVMStrandIndex  alloc_strands;
+    MVMStringIndex  graphs;
+
+    /* The run of short pieces being gathered. */
+    MVMString      *run_first;
+    MVMStringIndex  run_first_start;
+    MVMStringIndex  run_pieces;
+    MVMCodepoint32 *run_cps;
+    MVMStringIndex  run_used;
+    MVMStringIndex  run_alloc;
+    MVMuint8        run_8bit;
+
+    /* The runs copied so far, the strands they go in, and which of them
+     * were narrowed to 8 bits as all of their pieces were 8-bit. */
+    void           **copies;
+    MVMStrandIndex  *copy_strands;
+    MVMuint8        *copy_8bit;
+    MVMStrandIndex   num_copies;
+    MVMStrandIndex   alloc_copies;
+} RopeRebuild;
+
+static void rebuild_add_strand(RopeRebuild *rb, MVMString *string, MVMStringIndex start,
+        MVMStringIndex length) {
+    /* leave room for the final row too */
+    if (rb->num_strands + 1 >= rb->alloc_strands) {
+        rb->alloc_strands = rb->alloc_strands ? rb->alloc_strands * 2 : 8;
+        rb->strands = realloc(rb->strands, rb->alloc_strands * sizeof(MVMStrand));
+    }
+    rb->strands[rb->num_strands].compare_offset = rb->graphs;
+    rb->strands[rb->num_strands].string         = string;
+    rb->strands[rb->num_strands].string_offset  = start;
+    rb->num_strands++;
+    rb->graphs += length;
+}
+
+static void rebuild_add_short(MVMThreadContext *tc, RopeRebuild *rb, MVMString *string,
+        MVMStringIndex start, MVMStringIndex length) {
+    if (!rb->run_pieces) {
+        rb->run_first       = string;
+        rb->run_first_start = start;
+        rb->run_used        = length;
+        rb->run_pieces      = 1;
+        rb->run_8bit        = !IS_WIDE(string);
+        return;
+    }
+    if (rb->run_used + length > rb->run_alloc) {
+        MVMuint8 first = !rb->run_cps;
+        rb->run_alloc = (rb->run_used + length) * 2;
+        rb->run_cps   = realloc(rb->run_cps, rb->run_alloc * sizeof(MVMCodepoint32));
+        if (first)
+            copy_graphemes(tc, rb->run_first, rb->run_first_start, rb->run_used, rb->run_cps);
+    }
+    copy_graphemes(tc, string, start, length, rb->run_cps + rb->run_used);
+    rb->run_used += length;
+    rb->run_pieces++;
+    rb->run_8bit = rb->run_8bit && !IS_WIDE(string);
+}
+
+static void rebuild_end_run(RopeRebuild *rb) {
+    if (!rb->run_pieces)
+        return;
+    if (rb->run_pieces == 1) {
+        rebuild_add_strand(rb, rb->run_first, rb->run_first_start, rb->run_used);
+    }
+    else {
+        if (rb->num_copies == rb->alloc_copies) {
+            rb->alloc_copies = rb->alloc_copies ? rb->alloc_copies * 2 : 4;
+            rb->copies       = realloc(rb->copies, rb->alloc_copies * sizeof(void *));
+            rb->copy_strands = realloc(rb->copy_strands, rb->alloc_copies * sizeof(MVMStrandIndex));
+            rb->copy_8bit    = realloc(rb->copy_8bit, rb->alloc_copies);
         }
-    } while (index-- > 0);
-    return result;
+        if (rb->run_8bit) {
+            MVMCodepoint8  *narrow = malloc(rb->run_used);
+            MVMStringIndex  i;
+            for (i = 0; i < rb->run_used; i++)
+                narrow[i] = (MVMCodepoint8)rb->run_cps[i];
+            free(rb->run_cps);
+            rb->copies[rb->num_copies] = narrow;
+        }
+        else {
+            rb->copies[rb->num_copies] = rb->run_cps;
+        }
+        rb->copy_strands[rb->num_copies] = rb->num_strands;
+        rb->copy_8bit[rb->num_copies]    = rb->run_8bit;
+        rb->num_copies++;
+        rebuild_add_strand(rb, NULL, 0, rb->run_used);
+    }
+    rb->run_pieces = 0;
+    rb->run_cps    = NULL;
+    rb->run_used   = 0;
+    rb->run_alloc  = 0;
+}
+
+/* Rebuilds a rope we just made as one of depth 1, with each strand
+ * referring straight to a flat string, and runs of pieces shorter than
+ * MVM_STRING_COPY_THRESHOLD copied together into new flat strings. This
+ * allocates, so the rope may move; it is returned from where it is now. */
+static MVMString * rebalance(MVMThreadContext *tc, MVMString *s) {
+    RopeRebuild    rb;
+    MVMStrandIter  iter;
+    MVMStrandIndex i;
+
+    memset(&rb, 0, sizeof(RopeRebuild));
+    MVM_string_strand_iter_init(tc, &iter, s, 0, NUM_GRAPHS(s));
+    while (MVM_string_strand_iter_next(tc, &iter)) {
+        if (iter.length < MVM_STRING_COPY_THRESHOLD) {
+            rebuild_add_short(tc, &rb, iter.string, iter.start, iter.length);
+        }
+        else {
+            rebuild_end_run(&rb);
+            rebuild_add_strand(&rb, iter.string, iter.start, iter.length);
+        }
+    }
+    rebuild_end_run(&rb);
+
+    /* If it all got copied together, the rope just becomes flat. */
+    free(s->body.strands);
+    if (rb.num_strands == 1 && rb.num_copies == 1) {
+        if (rb.copy_8bit[0])
+            set_flat_8bit(s, rb.copies[0], rb.graphs);
+        else
+            set_flat(s, rb.copies[0], rb.graphs);
+        free(rb.strands);
+        free(rb.copies);
+        free(rb.copy_strands);
+        free(rb.copy_8bit);
+        return s;
+    }
+    rb.strands[rb.num_strands].graphs       = rb.graphs;
+    rb.strands[rb.num_strands].string       = NULL;
+    rb.strands[rb.num_strands].strand_depth = 1;
+    s->body.strands     = rb.strands;
+    s->body.num_strands = rb.num_strands;
+
+    /* Make strings of the copied runs. Until then their strands are NULL,
+     * which the GC skips over. */
+    MVMROOT(tc, s, {
+        for (i = 0; i < rb.num_copies; i++) {
+            MVMString      *copy   = (MVMString *)REPR(s)->allocate(tc, STABLE(s));
+            MVMStrand      *strand = &s->body.strands[rb.copy_strands[i]];
+            MVMStringIndex  graphs = strand[1].compare_offset - strand->compare_offset;
+            if (rb.copy_8bit[i])
+                set_flat_8bit(copy, rb.copies[i], graphs);
+            else
+                set_flat(copy, rb.copies[i], graphs);
+            MVM_ASSIGN_REF(tc, &(s->common.header), strand->string, copy);
+        }
+    });
+    free(rb.copies);
+    free(rb.copy_strands);
+    free(rb.copy_8bit);
+    return s;
+}
+
+/* Applies the rope policy to a rope we just made: short ones are made
+ * flat, and ones that got too deep, or are made of many strands that are
+ * short on average, are rebuilt. Returns the rope, which may have moved. */
+static MVMString * balance_rope(MVMThreadContext *tc, MVMString *s) {
+    MVMStringIndex graphs = NUM_GRAPHS(s);
+    if (graphs < MVM_STRING_COPY_THRESHOLD)
+        MVM_string_flatten(tc, s);
+    else if (STRAND_DEPTH(s) > MVM_STRING_MAX_STRAND_DEPTH || (s->body.num_strands > 2
+            && s->body.num_strands * MVM_STRING_COPY_THRESHOLD > graphs))
+        s = rebalance(tc, s);
+    return s;
 }
 
 /* Returns a substring of the given string */
@@ -379,27 +802,29 @@ MVMString * MVM_string_substring(MVMThreadContext *tc, MVMString *a, MVMint64 of
     if (start_pos == end_pos)
         return tc->instance->str_consts.empty;
 
+    if (start_pos == 0 && end_pos == agraphs)
+        return a;
+
     MVM_gc_root_temp_push(tc, (MVMCollectable **)&a);
     result = (MVMString *)REPR(a)->allocate(tc, STABLE(a));
     MVM_gc_root_temp_pop(tc);
 
-    strands = result->body.strands = calloc(sizeof(MVMStrand), 2);
-    /* if we're substringing a substring, substring the same one */
-    if (IS_ONE_STRING_ROPE(a)) {
-        strands->string_offset = (MVMStringIndex)start_pos + a->body.strands->string_offset;
-        strands->string = a->body.strands->string;
-    }
-    else {
-        strands->string_offset = (MVMStringIndex)start_pos;
-        strands->string = a;
+    /* short substrings are copied, so they don't keep the original alive */
+    if (end_pos - start_pos < MVM_STRING_COPY_THRESHOLD) {
+        set_flat_copy(tc, result, a, start_pos, end_pos - start_pos);
+        return result;
     }
+
+    /* if we're substringing a substring, substring the same one */
+    strands = result->body.strands = calloc(sizeof(MVMStrand), 2);
+    set_strand(strands, a, (MVMStringIndex)start_pos, 0);
     /* result->body.codes  = 0; /* Populate this lazily. */
     result->body.flags = MVM_STRING_TYPE_ROPE;
     result->body.num_strands = 1;
     strands[1].graphs = end_pos - start_pos;
     _STRAND_DEPTH(result) = STRAND_DEPTH(strands->string) + 1;
 
-    MVM_string_flatten(tc, result);
+    result = balance_rope(tc, result);
 
     return result;
 }
@@ -421,25 +846,26 @@ MVMString * MVM_string_replace(MVMThreadContext *tc, MVMString *original, MVMint
 
     MVM_gc_root_temp_pop_n(tc, 3);
 
-    MVM_string_flatten(tc, result);
-
     return result;
 }
 
 /* Append one string to another. */
-/* XXX inline parent's strands if it's a rope too? */
 MVMString * MVM_string_concatenate(MVMThreadContext *tc, MVMString *a, MVMString *b) {
     MVMString *result;
-    MVMStrandIndex strand_count = 0;
     MVMStrand *strands;
-    MVMStringIndex index = 0;
-    MVMStrandIndex max_strand_depth = 0;
-    MVMStringIndex agraphs = NUM_GRAPHS(a), bgraphs = NUM_GRAPHS(b), rgraphs;
+    MVMStringIndex agraphs, bgraphs, adepth, bdepth;
 
     if (!IS_CONCRETE((MVMObject *)a) || !IS_CONCRETE((MVMObject *)b)) {
         MVM_exception_throw_adhoc(tc, "Concatenate needs concrete strings");
     }
 
+    agraphs = NUM_GRAPHS(a);
+    bgraphs = NUM_GRAPHS(b);
+    if (!bgraphs)
+        return a;
+    if (!agraphs)
+        return b;
+
     MVM_gc_root_temp_push(tc, (MVMCollectable **)&a);
     MVM_gc_root_temp_push(tc, (MVMCollectable **)&b);
     result = (MVMString *)REPR(a)->allocate(tc, STABLE(a));
@@ -447,46 +873,40 @@ MVMString * MVM_string_concatenate(MVMThreadContext *tc, MVMString *a, MVMString
 
     /* there could be unattached combining chars at the beginning of b,
        so, XXX TODO handle this */
+    if (agraphs + bgraphs < MVM_STRING_COPY_THRESHOLD) {
+        if (is_all_8bit(tc, a, 0, agraphs) && is_all_8bit(tc, b, 0, bgraphs)) {
+            MVMCodepoint8 *buffer = malloc(agraphs + bgraphs);
+            copy_graphemes_8bit(tc, a, 0, agraphs, buffer);
+            copy_graphemes_8bit(tc, b, 0, bgraphs, buffer + agraphs);
+            set_flat_8bit(result, buffer, agraphs + bgraphs);
+        }
+        else {
+            MVMCodepoint32 *buffer = malloc(sizeof(MVMCodepoint32) * (agraphs + bgraphs));
+            copy_graphemes(tc, a, 0, agraphs, buffer);
+            copy_graphemes(tc, b, 0, bgraphs, buffer + agraphs);
+            set_flat(result, buffer, agraphs + bgraphs);
+        }
+        return result;
+    }
+
+    strands = result->body.strands = calloc(sizeof(MVMStrand), 3);
+    set_strand(&strands[0], a, 0, 0);
+    set_strand(&strands[1], b, 0, agraphs);
+    strands[2].graphs = agraphs + bgraphs;
+    result->body.num_strands = 2;
     result->body.flags = MVM_STRING_TYPE_ROPE;
-    rgraphs = agraphs + bgraphs;
-
-    if (agraphs)
-        strand_count = 1;
-    if (bgraphs)
-        ++strand_count;
-    strands = result->body.strands = calloc(sizeof(MVMStrand), strand_count + 1);
-    strand_count = 0;
-    if (agraphs) {
-        strands->string = a;
-        strands->string_offset = 0;
-        strands->compare_offset = index;
-        index = agraphs;
-        strand_count = 1;
-        max_strand_depth = STRAND_DEPTH(a);
-    }
-    if (bgraphs) {
-        strands[strand_count].string = b;
-        strands[strand_count].string_offset = 0;
-        strands[strand_count].compare_offset = index;
-        index += bgraphs;
-        ++strand_count;
-        if (STRAND_DEPTH(b) > max_strand_depth)
-            max_strand_depth = STRAND_DEPTH(b);
-    }
-    strands[strand_count].graphs = index;
-    result->body.num_strands = strand_count;
-    result->body.flags = MVM_STRING_TYPE_ROPE;
-    _STRAND_DEPTH(result) = max_strand_depth + 1;
+    adepth = STRAND_DEPTH(strands[0].string);
+    bdepth = STRAND_DEPTH(strands[1].string);
+    _STRAND_DEPTH(result) = (adepth > bdepth ? adepth : bdepth) + 1;
 
-    MVM_string_flatten(tc, result);
+    result = balance_rope(tc, result);
 
     return result;
 }
 
 MVMString * MVM_string_repeat(MVMThreadContext *tc, MVMString *a, MVMint64 count) {
     MVMString *result;
-    MVMint64 bkup_count = count;
-    MVMStringIndex string_offset = 0, graphs = 0, rgraphs;
+    MVMStringIndex graphs, rgraphs, i;
 
     if (!IS_CONCRETE((MVMObject *)a)) {
         MVM_exception_throw_adhoc(tc, "repeat needs a concrete string");
@@ -498,42 +918,44 @@ MVMString * MVM_string_repeat(MVMThreadContext *tc, MVMString *a, MVMint64 count
     if (count > (1<<30))
         MVM_exception_throw_adhoc(tc, "repeat count > %lld arbitrarily unsupported...", (1<<30));
 
+    graphs  = NUM_GRAPHS(a);
+    rgraphs = graphs * count;
+    if (!rgraphs)
+        return tc->instance->str_consts.empty;
+    if (count == 1)
+        return a;
+
     MVM_gc_root_temp_push(tc, (MVMCollectable **)&a);
     result = (MVMString *)REPR(a)->allocate(tc, STABLE(a));
     MVM_gc_root_temp_pop(tc);
 
-    if (IS_ONE_STRING_ROPE(a)) {
-        string_offset = a->body.strands->string_offset;
-        graphs = a->body.strands[1].graphs;
-        a = a->body.strands->string;
+    /* A strand takes more space than a short string's graphemes do, so
+     * repeat those by copying. */
+    if (graphs < MVM_STRING_COPY_THRESHOLD && is_all_8bit(tc, a, 0, graphs)) {
+        MVMCodepoint8 *buffer = malloc(rgraphs);
+        copy_graphemes_8bit(tc, a, 0, graphs, buffer);
+        for (i = 1; i < (MVMStringIndex)count; i++)
+            memcpy(buffer + i * graphs, buffer, graphs);
+        set_flat_8bit(result, buffer, rgraphs);
     }
-    else {
-        graphs = NUM_GRAPHS(a);
+    else if (graphs < MVM_STRING_COPY_THRESHOLD) {
+        MVMCodepoint32 *buffer = malloc(sizeof(MVMCodepoint32) * rgraphs);
+        copy_graphemes(tc, a, 0, graphs, buffer);
+        for (i = 1; i < (MVMStringIndex)count; i++)
+            memcpy(buffer + i * graphs, buffer, sizeof(MVMCodepoint32) * graphs);
+        set_flat(result, buffer, rgraphs);
     }
-
-    rgraphs = graphs * count;
-
-    /* XXX compute tradeoff here of space usage of the strands table vs real string */
-    if (rgraphs) {
+    else {
         MVMStrand *strands = result->body.strands = calloc(sizeof(MVMStrand), count + 1);
+        for (i = 0; i < (MVMStringIndex)count; i++)
+            set_strand(&strands[i], a, 0, i * graphs);
+        strands[count].graphs = rgraphs;
+        result->body.num_strands = count;
         result->body.flags = MVM_STRING_TYPE_ROPE;
-
-        while (count--) {
-            strands[count].compare_offset = count * graphs;
-            strands[count].string = a;
-            strands[count].string_offset = string_offset;
-        }
-        strands[bkup_count].graphs = rgraphs;
-        result->body.num_strands = bkup_count;
-        _STRAND_DEPTH(result) = STRAND_DEPTH(a) + 1;
-    }
-    else {
-        result->body.flags = MVM_STRING_TYPE_UINT8;
-        /* leave graphs 0 and storage null */
+        _STRAND_DEPTH(result) = STRAND_DEPTH(strands->string) + 1;
+        result = balance_rope(tc, result);
     }
 
-    MVM_string_flatten(tc, result);
-
     return result;
 }
 
@@ -659,8 +1081,22 @@ typedef struct MVMCaseChangeState {
     MVMString *dest;
     MVMStringIndex size;
     MVMint32 case_change_type;
+    MVMuint8 changed;
 } MVMCaseChangeState;
 
+/* Widens the string being built by a case change to 32 bits, keeping the
+ * room allocated for it. */
+static void case_change_widen(MVMCaseChangeState *state) {
+    MVMString      *dest   = state->dest;
+    MVMCodepoint32 *buffer = malloc(sizeof(MVMCodepoint32) * (state->size ? state->size : 1));
+    MVMStringIndex  i;
+    for (i = 0; i < dest->body.graphs; i++)
+        buffer[i] = dest->body.uint8s[i];
+    free(dest->body.uint8s);
+    dest->body.flags  = MVM_STRING_TYPE_INT32;
+    dest->body.int32s = buffer;
+}
+
 #define change_case_iterate(member, dest_member, dest_size) \
 for (i = string->body.member + start; i < string->body.member + start + length; ) { \
     if (dest->body.graphs == state->size) { \
@@ -669,8 +1105,11 @@ for (i = string->body.member + start; i < string->body.member + start + length;
         dest->body.dest_member = realloc(dest->body.dest_member, \
             state->size * sizeof(dest_size)); \
     } \
-    dest->body.dest_member[dest->body.graphs++] = \
-        MVM_unicode_get_case_change(tc, (MVMCodepoint32) *i++, state->case_change_type); \
+    cp = (MVMCodepoint32) *i++; \
+    changed_cp = MVM_unicode_get_case_change(tc, cp, state->case_change_type); \
+    if (changed_cp != cp) \
+        state->changed = 1; \
+    dest->body.dest_member[dest->body.graphs++] = changed_cp; \
 }
 
 /* XXX make this handle case changes that change the number of characters.
@@ -680,23 +1119,22 @@ for (i = string->body.member + start; i < string->body.member + start + length;
 MVM_SUBSTRING_CONSUMER(MVM_string_case_change_consumer) {
     MVMCaseChangeState *state = (MVMCaseChangeState *)data;
     MVMString *dest = state->dest;
+    MVMCodepoint32 cp, changed_cp;
     switch (STR_FLAGS(string)) {
         case MVM_STRING_TYPE_INT32: {
             MVMCodepoint32 *i;
-            if (!IS_WIDE(dest)) {
-                MVM_string_flatten(tc, dest);
-            }
+            if (!IS_WIDE(dest))
+                case_change_widen(state);
             change_case_iterate(int32s, int32s, MVMCodepoint32)
             break;
         }
         case MVM_STRING_TYPE_UINT8: {
+            /* Case changes can take 8-bit codepoints out of 8 bits (such
+             * as U+00FF to U+0178), so the result is always 32-bit. */
             MVMCodepoint8 *i;
-            if (IS_WIDE(dest)) {
-                change_case_iterate(uint8s, int32s, MVMCodepoint32)
-            }
-            else { /* hopefully most common/fast case of ascii->ascii */
-                change_case_iterate(uint8s, uint8s, MVMCodepoint8)
-            }
+            if (!IS_WIDE(dest))
+                case_change_widen(state);
+            change_case_iterate(uint8s, int32s, MVMCodepoint32)
             break;
         }
         default:
@@ -710,7 +1148,7 @@ MVM_SUBSTRING_CONSUMER(MVM_string_case_change_consumer) {
 MVMString * funcname(MVMThreadContext *tc, MVMString *s) { \
     MVMString *result; \
     MVMStringIndex i; \
-    MVMCaseChangeState state = { NULL, 0, type }; \
+    MVMCaseChangeState state = { NULL, 0, type, 0 }; \
     \
     if (!IS_CONCRETE((MVMObject *)s)) { \
         MVM_exception_throw_adhoc(tc, error); \
@@ -723,6 +1161,13 @@ MVMString * funcname(MVMThreadContext *tc, MVMString *s) { \
     MVM_string_traverse_substring(tc, s, 0, NUM_GRAPHS(s), 0, \
         MVM_string_case_change_consumer, &state); \
      \
+    /* if nothing changed, the original will do */ \
+    if (!state.changed) { \
+        MVM_checked_free_null(result->body.storage); \
+        result->body.graphs = 0; \
+        return s; \
+    } \
+     \
     return result; \
 }
 
@@ -738,7 +1183,7 @@ MVMString * MVM_string_decode(MVMThreadContext *tc,
 
     switch(encoding_flag) {
         case MVM_encoding_type_utf8:
-            return MVM_string_utf8_decode(tc, type_object, Cbuf, byte_length);
+            return MVM_string_utf8_decode_compact(tc, type_object, Cbuf, byte_length);
         case MVM_encoding_type_ascii:
             return MVM_string_ascii_decode(tc, type_object, Cbuf, byte_length);
         case MVM_encoding_type_latin1:
@@ -800,6 +1245,8 @@ void MVM_string_encode_to_buf(MVMThreadContext *tc, MVMString *s, MVMString *enc
         MVM_exception_throw_adhoc(tc, "encode requires a native int array");
     if (((MVMArray *)buf)->body.slots.any)
         MVM_exception_throw_adhoc(tc, "encode requires an empty array");
+    if (((MVMArray *)buf)->body.mapping)
+        MVM_exception_throw_adhoc(tc, "encode cannot write into a memory-mapped array");
 
     /* At least find_encoding may allocate on first call, so root just
      * in case. */
@@ -1018,7 +1465,7 @@ MVMString * MVM_string_join(MVMThreadContext *tc, MVMString *separator, MVMObjec
     if (NUM_GRAPHS(result) != position)
         MVM_exception_throw_adhoc(tc, "join had an internal error");
 
-    MVM_string_flatten(tc, result);
+    result = balance_rope(tc, result);
 
     return result;
 }
@@ -1090,7 +1537,7 @@ void MVM_string_flatten(MVMThreadContext *tc, MVMString *s) {
     /* XXX This is temporary until we can get the hashing mechanism
         to compute the hash (and test for equivalence!) using the
         codepoint iterator interface.  It's not thread-safe. */
-    MVMStringIndex position = 0, sgraphs = NUM_GRAPHS(s);
+    MVMStringIndex sgraphs = NUM_GRAPHS(s);
     void *storage = s->body.storage;
     MVMCodepoint32 *buffer;
     if (IS_WIDE(s))
@@ -1099,35 +1546,11 @@ void MVM_string_flatten(MVMThreadContext *tc, MVMString *s) {
         if (storage) free(storage);
         s->body.int32s = malloc(1); /* just in case a hash tries to hash */
         s->body.flags = MVM_STRING_TYPE_INT32;
+        s->body.graphs = 0;
         return;
     }
     buffer = malloc(sizeof(MVMCodepoint32) * sgraphs);
-    if (IS_ROPE(s) && STRAND_DEPTH(s) == 1) {
-        MVMStrandIndex strand;
-        MVMStrandIndex last  = s->body.num_strands;
-        for (strand = 0; strand < last; strand++) {
-            MVMStrand *snd = &s->body.strands[strand];
-            MVMStringIndex end = (s->body.strands[strand + 1].compare_offset - snd->compare_offset);
-            if (IS_WIDE(snd->string)) {
-                memcpy(buffer + snd->compare_offset,
-                       snd->string->body.int32s + snd->string_offset,
-                       end * 4);
-            } else if (IS_ASCII(snd->string)) {
-                MVMStringIndex copy_idx;
-                // we have to turn uint8 into int32 here.
-                for (copy_idx = 0; copy_idx < end; copy_idx++) {
-                    buffer[snd->compare_offset + copy_idx] = snd->string->body.uint8s[copy_idx + snd->string_offset];
-                }
-            } else {
-                MVM_exception_throw_adhoc(tc, "Unexpected rope in string_flatten.");
-            }
-        }
-    } else {
-        for (; position < sgraphs; position++) {
-                /* XXX make this use the iterator */
-            buffer[position] = MVM_string_get_codepoint_at_nocheck(tc, s, position);
-        }
-    }
+    copy_graphemes(tc, s, 0, sgraphs, buffer);
     s->body.flags = MVM_STRING_TYPE_INT32;
     s->body.graphs = sgraphs;
     s->body.int32s = buffer;
@@ -1314,223 +1737,95 @@ MVMString * MVM_string_bitxor(MVMThreadContext *tc, MVMString *a, MVMString *b)
     return res;
 }
 
-/* The following statics hold on to various unicode property values we will
- * resolve once so we don't have to do it repeatedly. */
-static MVMint64 UPV_Nd = 0;
-static MVMint64 UPV_Lu = 0;
-static MVMint64 UPV_Ll = 0;
-static MVMint64 UPV_Lt = 0;
-static MVMint64 UPV_Lm = 0;
-static MVMint64 UPV_Lo = 0;
-static MVMint64 UPV_Zs = 0;
-static MVMint64 UPV_Zl = 0;
-static MVMint64 UPV_Pc = 0;
-static MVMint64 UPV_Pd = 0;
-static MVMint64 UPV_Ps = 0;
-static MVMint64 UPV_Pe = 0;
-static MVMint64 UPV_Pi = 0;
-static MVMint64 UPV_Pf = 0;
-static MVMint64 UPV_Po = 0;
-
-/* Resolves various unicode property values that we'll need. */
-void MVM_string_cclass_init(MVMThreadContext *tc) {
-    UPV_Nd = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Nd"));
-    UPV_Lu = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Lu"));
-    UPV_Ll = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Ll"));
-    UPV_Lt = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Lt"));
-    UPV_Lm = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Lm"));
-    UPV_Lo = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Lo"));
-    UPV_Zs = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Zs"));
-    UPV_Zl = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Zl"));
-    UPV_Pc = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Pc"));
-    UPV_Pd = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Pd"));
-    UPV_Ps = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Ps"));
-    UPV_Pe = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Pe"));
-    UPV_Pi = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Pi"));
-    UPV_Pf = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Pf"));
-    UPV_Po = MVM_unicode_name_to_property_value_code(tc,
-        MVM_UNICODE_PROPERTY_GENERAL_CATEGORY,
-        MVM_string_ascii_decode_nt(tc, tc->instance->VMString, "Po"));
+/* The character classes that have a bit in the masks from the Unicode
+ * database. */
+#define CCLASS_BITS (MVM_CCLASS_UPPERCASE | MVM_CCLASS_LOWERCASE | MVM_CCLASS_ALPHABETIC \
+    | MVM_CCLASS_NUMERIC | MVM_CCLASS_HEXADECIMAL | MVM_CCLASS_WHITESPACE | MVM_CCLASS_PRINTING \
+    | MVM_CCLASS_BLANK | MVM_CCLASS_CONTROL | MVM_CCLASS_PUNCTUATION | MVM_CCLASS_ALPHANUMERIC \
+    | MVM_CCLASS_NEWLINE | MVM_CCLASS_WORD)
+
+/* Turns a character class into the bits of a codepoint's character class
+ * mask that say it's in that class. Anything that isn't one of the classes
+ * matches nothing; every codepoint is either control or printing, and so
+ * has some bit set to match any. */
+static MVMuint16 cclass_to_bits(MVMint64 cclass) {
+    if (cclass == MVM_CCLASS_ANY)
+        return 0xFFFF;
+    if (cclass <= 0 || (cclass & (cclass - 1)) || !(cclass & CCLASS_BITS))
+        return 0;
+    return (MVMuint16)cclass;
 }
 
 /* Checks if the character at the specified offset is a member of the
  * indicated character class. */
 MVMint64 MVM_string_is_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMString *s, MVMint64 offset) {
+    MVMCodepoint32 cp;
+
     if (offset < 0 || offset >= NUM_GRAPHS(s))
         return 0;
- 
-    MVMCodepoint32 cp = MVM_string_get_codepoint_at(tc, s, offset);
-    if (cp < 0) {
-        MVM_exception_throw_adhoc(tc, "Negative character fed to cclass: '%d'", cp);
-    }
 
-    switch (cclass) {
-        case MVM_CCLASS_ANY:
-            return 1;
-
-        case MVM_CCLASS_UPPERCASE:
-            return MVM_unicode_codepoint_has_property_value(tc, cp,
-                MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Lu);
-
-        case MVM_CCLASS_LOWERCASE:
-            return MVM_unicode_codepoint_has_property_value(tc, cp,
-                MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Ll);
-
-        case MVM_CCLASS_WORD:
-            if (cp <= 'z') {  /* short circuit common case */
-		if (cp >= 'a' || cp == '_' || (cp >= 'A' && cp <= 'Z') || (cp >= '0' && cp <= '9'))
-		    return 1;
-		else
-		    return 0;
-	    }
-            /* Deliberate fall-through; word is _ or digit or alphabetic. */
-
-        case MVM_CCLASS_ALPHANUMERIC:
-	    if (cp <= '9' && cp >= '0')  /* short circuit common case */
-		return 1;
-            if (MVM_unicode_codepoint_has_property_value(tc, cp,
-                    MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Nd))
-                return 1;
-            /* Deliberate fall-through; alphanumeric is digit or alphabetic. */
-
-        case MVM_CCLASS_ALPHABETIC:
-            if (cp <= 'z') {  /* short circuit common case */
-		if (cp >= 'a' || (cp >= 'A' && cp <= 'Z'))
-		    return 1;
-		else
-		    return 0;
-	    }
-            return
-                MVM_unicode_codepoint_has_property_value(tc, cp,
-                    MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Lo) /* lots of CJK chars */
-             || MVM_unicode_codepoint_has_property_value(tc, cp,
-                    MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Ll) /* (ascii handled above) */
-             || MVM_unicode_codepoint_has_property_value(tc, cp,
-                    MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Lu)
-             || MVM_unicode_codepoint_has_property_value(tc, cp,
-                    MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Lt)
-             || MVM_unicode_codepoint_has_property_value(tc, cp,
-                    MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Lm);
-
-        case MVM_CCLASS_NUMERIC:
-	    if (cp <= '9' && cp >= '0')  /* short circuit common case */
-		return 1;
-            return MVM_unicode_codepoint_has_property_value(tc, cp,
-                MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Nd);
-
-        case MVM_CCLASS_HEXADECIMAL:
-            return MVM_unicode_codepoint_has_property_value(tc, cp,
-                MVM_UNICODE_PROPERTY_ASCII_HEX_DIGIT, 1);
-
-        case MVM_CCLASS_WHITESPACE:
-	    if (cp <= '~') {
-		if (cp == ' ' || (cp <= 13 && cp >= 9))
-		    return 1;
-		else
-		    return 0;
-	    }
-            return MVM_unicode_codepoint_has_property_value(tc, cp,
-                MVM_UNICODE_PROPERTY_WHITE_SPACE, 1);
-
-        case MVM_CCLASS_BLANK:
-            if (cp == '\t')
-                return 1;
-            return MVM_unicode_codepoint_has_property_value(tc, cp,
-                MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Zs);
-
-        case MVM_CCLASS_CONTROL: {
-            return (cp >= 0 && cp < 32) || (cp >= 127 && cp < 160);
-        }
+    cp = MVM_string_get_codepoint_at(tc, s, offset);
+    return (MVM_unicode_codepoint_cclass_mask(tc, cp) & cclass_to_bits(cclass)) != 0;
+}
 
-        case MVM_CCLASS_PRINTING: {
-            return !(cp >= 0 && cp < 32) || (cp >= 127 && cp < 160);
-        }
+/* When scanning a string for a character class, the first grapheme is
+ * tested on its own, since the scan often ends right there; after that,
+ * graphemes are classified a chunk at a time, starting small and growing
+ * to the most we classify at once. */
+#define CCLASS_SCAN_CHUNK_MIN 8
+#define CCLASS_SCAN_CHUNK_MAX 256
+
+/* Searches for the next char whose membership of the specified character
+ * class is as wanted. */
+static MVMint64 scan_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMString *s, MVMint64 offset, MVMint64 count, MVMint64 want) {
+    MVMCodepoint32 codepoints[CCLASS_SCAN_CHUNK_MAX];
+    MVMuint16      masks[CCLASS_SCAN_CHUNK_MAX];
+    MVMuint16      bits   = cclass_to_bits(cclass);
+    MVMint64       length = NUM_GRAPHS(s);
+    MVMint64       end    = offset + count;
+    MVMint64       size   = CCLASS_SCAN_CHUNK_MIN;
+    MVMint64       pos, chunk;
 
-        case MVM_CCLASS_PUNCTUATION:
-            return
-                MVM_unicode_codepoint_has_property_value(tc, cp,
-                    MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Pc)
-             || MVM_unicode_codepoint_has_property_value(tc, cp,
-                    MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Pd)
-             || MVM_unicode_codepoint_has_property_value(tc, cp,
-                    MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Ps)
-             || MVM_unicode_codepoint_has_property_value(tc, cp,
-                    MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Pe)
-             || MVM_unicode_codepoint_has_property_value(tc, cp,
-                    MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Pi)
-             || MVM_unicode_codepoint_has_property_value(tc, cp,
-                    MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Pf)
-             || MVM_unicode_codepoint_has_property_value(tc, cp,
-                    MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Po);
-
-        case MVM_CCLASS_NEWLINE: {
-            if (cp == '\n' || cp == '\r' || cp == 0x85)
-                return 1;
-            return MVM_unicode_codepoint_has_property_value(tc, cp,
-                MVM_UNICODE_PROPERTY_GENERAL_CATEGORY, UPV_Zl);
-        }
+    end = length < end ? length : end;
 
-        default:
-            return 0;
+    /* Positions before the start of the string are in no class. */
+    if (offset < 0) {
+        if (!want && offset < end)
+            return offset;
+        offset = 0;
     }
+    if (offset >= end)
+        return end;
+
+    pos = offset;
+    if (((MVM_unicode_codepoint_cclass_mask(tc,
+            MVM_string_get_codepoint_at_nocheck(tc, s, pos)) & bits) != 0) == want)
+        return pos;
+
+    for (pos++; pos < end; pos += chunk) {
+        MVMint64 done, i;
+        chunk = end - pos < size ? end - pos : size;
+        copy_graphemes(tc, s, pos, chunk, codepoints);
+        done = MVM_unicode_codepoints_cclass_masks(tc, codepoints, masks, chunk);
+        for (i = 0; i < done; i++)
+            if (((masks[i] & bits) != 0) == want)
+                return pos + i;
+        if (done < chunk)
+            MVM_unicode_codepoint_cclass_mask(tc, codepoints[done]); /* throws */
+        size = size * 4 < CCLASS_SCAN_CHUNK_MAX ? size * 4 : CCLASS_SCAN_CHUNK_MAX;
+    }
+
+    return end;
 }
 
 /* Searches for the next char that is in the specified character class. */
 MVMint64 MVM_string_find_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMString *s, MVMint64 offset, MVMint64 count) {
-    MVMint64 length = NUM_GRAPHS(s);
-    MVMint64 end    = offset + count;
-    MVMint64 pos;
-
-    end = length < end ? length : end;
-
-    for (pos = offset; pos < end; pos++)
-        if (MVM_string_is_cclass(tc, cclass, s, pos) > 0)
-            return pos;
-
-    return end;
+    return scan_cclass(tc, cclass, s, offset, count, 1);
 }
 
 /* Searches for the next char that is not in the specified character class. */
 MVMint64 MVM_string_find_not_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMString *s, MVMint64 offset, MVMint64 count) {
-    MVMint64 length = NUM_GRAPHS(s);
-    MVMint64 end    = offset + count;
-    MVMint64 pos;
-
-    end = length < end ? length : end;
-
-    for (pos = offset; pos < end; pos++)
-        if (MVM_string_is_cclass(tc, cclass, s, pos) == 0)
-            return pos;
-
-    return end;
+    return scan_cclass(tc, cclass, s, offset, count, 0);
 }
 
 static MVMint16   encoding_name_init         = 0;
@@ -30,9 +30,9 @@ typedef MVM_SUBSTRING_CONSUMER((*MVMSubstringConsumer));
 /* whether it's a string of full-blown 4-byte (positive and/or negative)
     codepoints. */
 #define IS_WIDE(str) (STR_FLAGS((str)) == MVM_STRING_TYPE_INT32)
-/* whether it's a string of only codepoints that fit in 8 bits, so
-    are stored compactly in a byte array. */
-#define IS_ASCII(str) (STR_FLAGS((str)) == MVM_STRING_TYPE_UINT8)
+/* whether it's a string of only codepoints that fit in 8 bits (any of
+    0-255, not just ASCII), so are stored compactly in a byte array. */
+#define IS_8BIT(str) (STR_FLAGS((str)) == MVM_STRING_TYPE_UINT8)
 /* whether it's a composite of strand segments */
 #define IS_ROPE(str) (STR_FLAGS((str)) == MVM_STRING_TYPE_ROPE)
 /* potentially lvalue version of the below */
@@ -42,6 +42,40 @@ typedef MVM_SUBSTRING_CONSUMER((*MVMSubstringConsumer));
 /* whether the rope is composed of only one segment of another string */
 #define IS_ONE_STRING_ROPE(str) (IS_ROPE((str)) && (str)->body.num_strands == 1)
 
+/* Ropes deeper than this are rebuilt with all of their strands referring
+    straight to flat strings, so that lookups don't have to descend too far. */
+#define MVM_STRING_MAX_STRAND_DEPTH 16
+
+/* Results of concat, join, repeat and substring shorter than this many
+    graphemes are copied into a flat string rather than made into a rope.
+    Runs of strands shorter than this are copied together when a rope is
+    rebuilt. */
+#define MVM_STRING_COPY_THRESHOLD 64
+
+/* Walks the flat strings that part of a string is made up of, in order,
+    keeping its own stack rather than recursing into ropes. After each
+    successful MVM_string_strand_iter_next, string, start and length give
+    the next piece. */
+struct MVMStrandIter {
+    /* The ropes being walked, outermost first; for each, the strand to
+        go into next and the range of the rope still to be walked. */
+    struct {
+        MVMString      *rope;
+        MVMStrandIndex  strand;
+        MVMStringIndex  pos;
+        MVMStringIndex  end;
+    } levels[MVM_STRING_MAX_STRAND_DEPTH + 1];
+    MVMuint32 depth;
+
+    /* Set if the walk started on a flat string not yet handed out. */
+    MVMuint8 flat_pending;
+
+    /* The current piece. */
+    MVMString      *string;
+    MVMStringIndex  start;
+    MVMStringIndex  length;
+};
+
 struct MVMConcatState {
     MVMuint32 some_state;
 };
@@ -62,6 +96,8 @@ struct MVMConcatState {
 #define MVM_CCLASS_NEWLINE      4096
 #define MVM_CCLASS_WORD         8192
 
+void MVM_string_strand_iter_init(MVMThreadContext *tc, MVMStrandIter *iter, MVMString *s, MVMStringIndex start, MVMStringIndex length);
+MVMuint8 MVM_string_strand_iter_next(MVMThreadContext *tc, MVMStrandIter *iter);
 MVMCodepoint32 MVM_string_get_codepoint_at_nocheck(MVMThreadContext *tc, MVMString *a, MVMint64 index);
 MVMint64 MVM_string_equal(MVMThreadContext *tc, MVMString *a, MVMString *b);
 MVMint64 MVM_string_index(MVMThreadContext *tc, MVMString *haystack, MVMString *needle, MVMint64 start);
@@ -92,6 +128,8 @@ MVMint64 MVM_unicode_codepoint_has_property_value(MVMThreadContext *tc, MVMCodep
 MVMString * MVM_unicode_codepoint_get_property_str(MVMThreadContext *tc, MVMCodepoint32 codepoint, MVMint64 property_code);
 MVMint64 MVM_unicode_codepoint_get_property_int(MVMThreadContext *tc, MVMCodepoint32 codepoint, MVMint64 property_code);
 MVMint64 MVM_unicode_codepoint_get_property_bool(MVMThreadContext *tc, MVMCodepoint32 codepoint, MVMint64 property_code);
+MVMuint16 MVM_unicode_codepoint_cclass_mask(MVMThreadContext *tc, MVMCodepoint32 codepoint);
+MVMint64 MVM_unicode_codepoints_cclass_masks(MVMThreadContext *tc, const MVMCodepoint32 *codepoints, MVMuint16 *masks, MVMint64 count);
 MVMString * MVM_unicode_get_name(MVMThreadContext *tc, MVMint64 codepoint);
 void MVM_string_flatten(MVMThreadContext *tc, MVMString *s);
 MVMString * MVM_string_escape(MVMThreadContext *tc, MVMString *s);
@@ -100,7 +138,6 @@ MVMint64 MVM_string_compare(MVMThreadContext *tc, MVMString *a, MVMString *b);
 MVMString * MVM_string_bitand(MVMThreadContext *tc, MVMString *a, MVMString *b);
 MVMString * MVM_string_bitor(MVMThreadContext *tc, MVMString *a, MVMString *b);
 MVMString * MVM_string_bitxor(MVMThreadContext *tc, MVMString *a, MVMString *b);
-void MVM_string_cclass_init(MVMThreadContext *tc);
 MVMint64 MVM_string_is_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMString *s, MVMint64 offset);
 MVMint64 MVM_string_find_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMString *s, MVMint64 offset, MVMint64 count);
 MVMint64 MVM_string_find_not_cclass(MVMThreadContext *tc, MVMint64 cclass, MVMString *s, MVMint64 offset, MVMint64 count);
@@ -833,6 +833,797 @@ static const MVMint32 case_changes[2091][3] = {
     /*2087*/{0x10424,0x0,0x10424}/* 1044C */,/*2088*/{0x10425,0x0,0x10425}/* 1044D */,
     /*2089*/{0x10426,0x0,0x10426}/* 1044E */,/*2090*/{0x10427,0x0,0x10427}/* 1044F */
 };
+static const MVMuint8 cclass_stage1[272] = {
+    0,1,2,3,4,5,5,5,5,6,7,5,5,8,9,10,11,12,13,14,9,9,15,9,9,9,9,16,9,17,18,9,5,5,5,5,5,5,5,5,5,5,5,19,9,9,9,20,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9
+};
+static const MVMuint8 cclass_stage2[21][64] = {
+    /*0*/{0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,12,35,36,37,38,39,40,41,
+    42,43,44,45,46,47,48,47,49,50,51,52,53,54,55,56,57,58,59,60,61},
+    /*1*/{62,63,64,65,26,26,26,26,26,66,67,68,69,70,71,72,73,26,26,26,26,26,26,26,26,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,
+    89,90,91,12,92,93,94,95,96,97,12,98,99,100,101,12,102,102,103,102,104,105,106,107},
+    /*2*/{108,109,110,12,111,112,113,12,12,12,12,12,114,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,115,12,116,12,12,12,12,12,
+    12,117,118,12,12,12,12,12,12,12,12,119,120,102,121,122,123,124,125,126,12,12,12,12,12,12,12},
+    /*3*/{127,128,129,130,131,26,132,133,12,12,12,12,12,12,12,12,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26},
+    /*4*/{26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,12,26,26,26,26,26,26,26,26},
+    /*5*/{26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26},
+    /*6*/{26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,134},
+    /*7*/{26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,134,135,26,26,26,26,136,137,138,139,140,141,142,143,144,145,146,
+    147,148,149,150,151,152,153,154,155,156,12,12,157,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26},
+    /*8*/{26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,158,159,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+    /*9*/{12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+    /*10*/{12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,26,26,26,26,
+    26,160,26,161,162,163,164,165,26,26,26,26,166,167,168,169,170,171,26,172,173,174,175,176},
+    /*11*/{177,178,26,179,180,12,12,12,12,12,181,182,183,184,185,186,187,188,189,12,12,12,12,12,12,12,12,12,12,12,12,12,190,191,12,
+    12,192,12,193,12,194,195,12,12,196,197,12,12,26,198,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+    /*12*/{199,200,201,202,203,204,205,206,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,207,208,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+    /*13*/{26,26,26,26,26,26,26,26,26,26,26,26,26,209,12,12,12,210,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+    /*14*/{26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,209,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+    /*15*/{12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,26,26,26,26,26,26,26,26,
+    211,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,26,212,213,12},
+    /*16*/{214,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+    /*17*/{12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+    /*18*/{12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,231,232,233,12,12,12,12,12},
+    /*19*/{26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,234,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+    /*20*/{12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,26,26,26,26,26,26,26,26,
+    234,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12}
+};
+static const MVMuint16 cclass_stage3[235][64] = {
+    /*0*/{512,512,512,512,512,512,512,512,512,800,4640,544,544,4640,512,512,512,512,512,512,512,512,512,512,512,512,512,512,512,
+    512,512,512,352,1088,1088,1088,64,1088,1088,1088,1088,1088,1088,64,1088,1088,1088,1088,10328,10328,10328,10328,10328,
+    10328,10328,10328,10328,10328,1088,1088,64,64,64,1088},
+    /*1*/{1088,10325,10325,10325,10325,10325,10325,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,1088,1088,1088,64,9280,64,10326,10326,10326,10326,10326,10326,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,1088,64,1088,
+    64,576},
+    /*2*/{576,576,576,576,576,4704,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,576,
+    576,576,352,1088,64,64,64,64,64,1088,64,64,10308,1088,64,64,64,64,64,64,64,64,64,10310,1088,1088,64,64,10308,1088,64,64,
+    64,1088},
+    /*3*/{10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,64,10309,10309,10309,10309,10309,10309,10309,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,64,10310,10310,10310,10310,
+    10310,10310,10310,10310},
+    /*4*/{10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10310,10309,10310,10309,
+    10310,10309,10310,10309},
+    /*5*/{10310,10309,10310,10309,10310,10309,10310,10309,10310,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10309,10310,10309,
+    10310,10309,10310,10310},
+    /*6*/{10310,10309,10309,10310,10309,10310,10309,10309,10310,10309,10309,10309,10310,10310,10309,10309,10309,10309,10310,10309,
+    10309,10310,10309,10309,10309,10310,10310,10310,10309,10309,10310,10309,10309,10310,10309,10310,10309,10310,10309,10309,
+    10310,10309,10310,10310,10309,10310,10309,10309,10310,10309,10309,10309,10310,10309,10310,10309,10309,10310,10310,10308,
+    10309,10310,10310,10310},
+    /*7*/{10308,10308,10308,10308,10309,10308,10310,10309,10308,10310,10309,10308,10310,10309,10310,10309,10310,10309,10310,10309,
+    10310,10309,10310,10309,10310,10309,10310,10309,10310,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10310,10309,10308,10310,10309,10310,10309,10309,10309,10310,10309,10310,
+    10309,10310,10309,10310},
+    /*8*/{10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10310,10310,10310,10310,10310,10310,10309,10309,
+    10310,10309,10309,10310},
+    /*9*/{10310,10309,10310,10309,10309,10309,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310},
+    /*10*/{10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10308,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308},
+    /*11*/{10308,10308,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,10308,64,10308,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64},
+    /*12*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*13*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,10309,10310,10309,10310,10308,64,10309,10310,64,64,10308,10310,10310,10310,1088,64},
+    /*14*/{64,64,64,64,64,64,10309,1088,10309,10309,10309,64,10309,64,10309,10309,10310,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,64,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310},
+    /*15*/{10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10309,10310,10310,10309,10309,
+    10309,10310,10310,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10310,10310,10310,10310,10309,10310,64,10309,10310,10309,10309,10310,
+    10310,10309,10309,10309},
+    /*16*/{10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,10309,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310},
+    /*17*/{10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310},
+    /*18*/{10309,10310,64,64,64,64,64,64,64,64,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310},
+    /*19*/{10309,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310},
+    /*20*/{10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    64,64,64,64,64,64,64,64,64,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309},
+    /*21*/{10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,64,64,10308,1088,1088,1088,1088,1088,1088,64,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310},
+    /*22*/{10310,10310,10310,10310,10310,10310,10310,10310,64,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,64},
+    /*23*/{1088,64,64,1088,64,64,1088,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,10308,
+    10308,10308,1088,1088,64,64,64,64,64,64,64,64,64,64,64},
+    /*24*/{64,64,64,64,64,64,64,64,64,1088,1088,64,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,64,64,1088,1088,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*25*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,1088,1088,1088,1088,10308,10308,64,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*26*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308},
+    /*27*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    1088,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,64,64,64,64,64,64,64,10308,10308,10312,10312,10312,
+    10312,10312,10312,10312,10312,10312,10312,10308,10308,10308,64,64,10308},
+    /*28*/{1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,64,64,10308,64,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*29*/{64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*30*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,
+    64,64,64,64,64,64,64,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*31*/{10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,64,64,64,64,64,64,64,64,64,10308,10308,64,1088,1088,1088,10308,64,64,64,64,64},
+    /*32*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,64,64,64,64,10308,64,64,64,64,64,64,64,64,64,10308,64,64,64,10308,64,64,64,64,64,64,64,1088,1088,1088,1088,
+    1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,64},
+    /*33*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,64,64,64,64,64,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64},
+    /*34*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,64,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*35*/{64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,10308,64,64},
+    /*36*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,64,64,1088,1088,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,1088,10308,10308,10308,
+    10308,10308,10308,10308,64,10308,10308,10308,10308,10308,10308,10308},
+    /*37*/{64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,64,64,10308,10308,64,64,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,
+    10308,10308,10308,10308,10308,64,10308,64,64,64,10308,10308,10308,10308,64,64,64,10308,64,64},
+    /*38*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,64,10308,10308,10308,
+    64,64,64,64,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64},
+    /*39*/{64,64,64,64,64,10308,10308,10308,10308,10308,10308,64,64,64,64,10308,10308,64,64,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,
+    10308,10308,10308,10308,64,10308,10308,64,10308,10308,64,10308,10308,64,64,64,64,64,64},
+    /*40*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,64,10308,64,64,64,64,
+    64,64,64,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,64,64,10308,10308,10308,64,64,64,64,64,64,64,64,64,
+    64,64},
+    /*41*/{64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,64,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,
+    10308,10308,10308,10308,10308,10308,64,10308,10308,64,10308,10308,10308,10308,10308,64,64,64,10308,64,64},
+    /*42*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,64,64,64,
+    64,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*43*/{64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,64,64,10308,10308,64,64,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,
+    10308,10308,10308,10308,10308,64,10308,10308,64,10308,10308,10308,10308,10308,64,64,64,10308,64,64},
+    /*44*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,64,10308,10308,10308,64,
+    64,64,64,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,64,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*45*/{64,64,64,10308,64,10308,10308,10308,10308,10308,10308,64,64,64,10308,10308,10308,64,10308,10308,10308,10308,64,64,64,
+    10308,10308,64,10308,64,10308,10308,64,64,64,10308,10308,64,64,64,10308,10308,10308,64,64,64,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64},
+    /*46*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*47*/{64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,64,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,10308,64,64,64,10308,64,64},
+    /*48*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,64,64,64,64,64,64,10308,10308,64,64,
+    64,64,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*49*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,64,10308,10308,64,64,64,
+    64,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,64,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*50*/{64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,64,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,10308,64,64},
+    /*51*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,64,64,64,
+    64,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,64,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,
+    10308,10308},
+    /*52*/{64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,64,64},
+    /*53*/{10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,64,64,64,64,64,64,64,64,64,64,64},
+    /*54*/{64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*55*/{10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,1088,10312,10312,10312,10312,10312,10312,10312,10312,
+    10312,10312,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64},
+    /*56*/{64,10308,10308,64,10308,64,64,10308,10308,64,10308,64,64,10308,64,64,64,64,64,64,10308,10308,10308,10308,64,10308,10308,
+    10308,10308,10308,10308,10308,64,10308,10308,10308,64,10308,64,10308,64,64,10308,10308,64,10308,10308,10308,10308,64,
+    10308,10308,64,64,64,64,64,64,64,64,64,10308,64,64},
+    /*57*/{10308,10308,10308,10308,10308,64,10308,64,64,64,64,64,64,64,64,64,10312,10312,10312,10312,10312,10312,10312,10312,10312,
+    10312,64,64,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64},
+    /*58*/{10308,64,64,64,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,64,1088,64,64,64,64,64,64,64,
+    64,64,64,64,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    1088,1088,1088,1088,64,64},
+    /*59*/{10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*60*/{64,64,64,64,64,1088,64,64,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*61*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,1088,1088,1088,1088,64,64,64,64,1088,1088,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*62*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308},
+    /*63*/{10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,1088,1088,1088,1088,1088,1088,10308,10308,10308,10308,10308,
+    10308,64,64,64,64,10308,10308,10308,10308,64,64,64,10308,64,64,64,10308,10308,64,64,64,64,64,64,64,10308,10308,10308,64,
+    64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*64*/{10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,10308,64,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,64,
+    64,64,64,64,64,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309},
+    /*65*/{10309,10309,10309,10309,10309,10309,64,10309,64,64,64,64,64,10309,64,64,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,1088,10308,10308,10308,10308},
+    /*66*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,64,64,10308,10308,10308,10308,10308,
+    10308,10308,64,10308,64,10308,10308,10308,10308,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308},
+    /*67*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,64,64,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,64,64,10308,10308,10308,10308,10308,10308,
+    10308,64},
+    /*68*/{10308,64,10308,10308,10308,10308,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308},
+    /*69*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,
+    10308,10308,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308},
+    /*70*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,1088,1088,1088,1088,1088,1088,1088,1088,1088,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*71*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*72*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64},
+    /*73*/{1088,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308},
+    /*74*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,1088,1088,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308},
+    /*75*/{352,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,1088,1088,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308},
+    /*76*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,1088,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*77*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,64,64,64,1088,1088,64,64,64,64,64,64,64,64,64},
+    /*78*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,
+    10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*79*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*80*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,1088,1088,10308,1088,1088,1088,64,10308,64,64,64,10312,
+    10312,10312,10312,10312,10312,10312,10312,10312,10312,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*81*/{1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,64,64,64,64,64,10312,10312,10312,10312,10312,10312,10312,10312,
+    10312,10312,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*82*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64},
+    /*83*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,64,10308,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308},
+    /*84*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64},
+    /*85*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*86*/{64,64,64,64,1088,1088,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,64,64,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64},
+    /*87*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*88*/{64,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,10312,10312,10312,10312,10312,10312,10312,10312,
+    10312,10312,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64},
+    /*89*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,64,64,64,64,64,64,64,1088,1088,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*90*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64},
+    /*91*/{10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,64,64,64,64,64,64,10312,10312,10312,10312,10312,10312,10312,
+    10312,10312,10312,64,64,64,64,64,64,1088,1088,1088,1088,1088,1088,1088,10308,1088,1088,1088,1088,1088,1088,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*92*/{64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*93*/{64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,10312,10312,10312,10312,10312,10312,10312,10312,
+    10312,10312,1088,1088,1088,1088,1088,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64},
+    /*94*/{64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,
+    10308,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10308,10308,10308,10308,10308,10308},
+    /*95*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,1088,1088,1088},
+    /*96*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,1088,1088,1088,1088},
+    /*97*/{10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,64,64,64,10308,10308,10308,10312,10312,10312,10312,10312,
+    10312,10312,10312,10312,10312,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,1088,1088},
+    /*98*/{1088,1088,1088,1088,1088,1088,1088,1088,64,64,64,64,64,64,64,64,64,64,64,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,10308,10308,10308,10308,64,10308,10308,10308,10308,64,64,64,10308,10308,64,64,64,64,64,64,64,64,64},
+    /*99*/{10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308},
+    /*100*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10308,10310,10310,10310,
+    10310,10310,10310,10310},
+    /*101*/{10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308},
+    /*102*/{10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310},
+    /*103*/{10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10310,10310,10310,10310,10310,10310,10310,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310},
+    /*104*/{10310,10310,10310,10310,10310,10310,10310,10310,10309,10309,10309,10309,10309,10309,10309,10309,10310,10310,10310,10310,
+    10310,10310,64,64,10309,10309,10309,10309,10309,10309,64,64,10310,10310,10310,10310,10310,10310,10310,10310,10309,10309,
+    10309,10309,10309,10309,10309,10309,10310,10310,10310,10310,10310,10310,10310,10310,10309,10309,10309,10309,10309,10309,
+    10309,10309},
+    /*105*/{10310,10310,10310,10310,10310,10310,64,64,10309,10309,10309,10309,10309,10309,64,64,10310,10310,10310,10310,10310,10310,
+    10310,10310,64,10309,64,10309,64,10309,64,10309,10310,10310,10310,10310,10310,10310,10310,10310,10309,10309,10309,10309,
+    10309,10309,10309,10309,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,64,64},
+    /*106*/{10310,10310,10310,10310,10310,10310,10310,10310,10308,10308,10308,10308,10308,10308,10308,10308,10310,10310,10310,10310,
+    10310,10310,10310,10310,10308,10308,10308,10308,10308,10308,10308,10308,10310,10310,10310,10310,10310,10310,10310,10310,
+    10308,10308,10308,10308,10308,10308,10308,10308,10310,10310,10310,10310,10310,64,10310,10310,10309,10309,10309,10309,
+    10308,64,10310,64},
+    /*107*/{64,64,10310,10310,10310,64,10310,10310,10309,10309,10309,10309,10308,64,64,64,10310,10310,10310,10310,64,64,10310,10310,
+    10309,10309,10309,10309,64,64,64,64,10310,10310,10310,10310,10310,10310,10310,10310,10309,10309,10309,10309,10309,64,64,
+    64,64,64,10310,10310,10310,64,10310,10310,10309,10309,10309,10309,10308,64,64,64},
+    /*108*/{352,352,352,352,352,352,352,352,352,352,352,64,64,64,64,64,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,
+    1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,4192,96,64,64,64,64,64,352,1088,1088,1088,1088,1088,1088,
+    1088,1088,1088,1088,1088,1088,1088,1088,1088,1088},
+    /*109*/{1088,1088,1088,1088,64,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,64,1088,1088,1088,1088,1088,1088,
+    1088,1088,1088,1088,1088,1088,352,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,64,64,64,64,64,64,64,64,64,64,
+    64,1088,1088,10308},
+    /*110*/{64,64,64,64,64,64,64,64,64,64,64,64,64,1088,1088,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*111*/{64,64,10309,64,64,64,64,10309,64,64,10310,10309,10309,10309,10310,10310,10309,10309,10309,10310,64,10309,64,64,64,10309,
+    10309,10309,10309,10309,64,64,64,64,64,64,10309,64,10309,64,10309,64,10309,10309,10309,10309,64,10310,10309,10309,10309,
+    10309,10310,10308,10308,10308,10308,10310,64,64,10310,10310,10309,10309},
+    /*112*/{64,64,64,64,64,10309,10310,10310,10310,10310,64,64,64,64,10310,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*113*/{64,64,64,10309,10310,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*114*/{64,64,64,64,64,64,64,64,1088,1088,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*115*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,64,64,64,64,64,64,64,64,64,64},
+    /*116*/{64,64,64,64,64,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*117*/{64,64,64,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*118*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,1088,1088,1088,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,1088,64,64},
+    /*119*/{10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,64,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310},
+    /*120*/{10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,64,10309,10310,10309,10309,10309,10310,10310,10309,
+    10310,10309,10310,10309,10310,10309,10309,10309,10309,10310,10309,10310,10310,10309,10310,10310,10310,10310,10310,10310,
+    10308,10308,10309,10309},
+    /*121*/{10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10310,64,64,64,64,64,64,
+    10309,10310,10309,10310,64,64,64,10309,10310,64,64,64,64,64,1088,1088,1088,1088,64,1088,1088},
+    /*122*/{10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,64,10310,64,
+    64,64,64,64,10310,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*123*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    64,64,64,64,64,64,64,10308,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*124*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,10308,
+    10308,10308,64,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,10308,10308,10308,64},
+    /*125*/{10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,10308,
+    10308,10308,64,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64},
+    /*126*/{1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,
+    1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,10308,
+    1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,64,64,64,64},
+    /*127*/{352,1088,1088,1088,64,10308,10308,64,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,64,64,1088,1088,1088,1088,1088,
+    1088,1088,1088,1088,1088,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,10308,10308,10308,10308,10308,64,
+    64,64,64,64,10308,10308,1088,64,64},
+    /*128*/{64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308},
+    /*129*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,64,64,64,64,64,64,10308,10308,10308,1088,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308},
+    /*130*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,1088,
+    10308,10308,10308,10308},
+    /*131*/{64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308},
+    /*132*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64},
+    /*133*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*134*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*135*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,1088,1088},
+    /*136*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,1088,1088,1088,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10312,10312,10312,10312,10312,10312,10312,10312,
+    10312,10312,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*137*/{10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10308,64,64,64,64,1088,64,64,64,64,64,64,64,64,64,64,1088,10308},
+    /*138*/{10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*139*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,
+    64,64,64,64,64,64,64,64,1088,1088,1088,1088,1088,1088,64,64,64,64,64,64,64,64},
+    /*140*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,64,64,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10310,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310},
+    /*141*/{10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,
+    10309,10310,10309,10310,10309,10310,10309,10310,10308,10310,10310,10310,10310,10310,10310,10310,10310,10309,10310,10309,
+    10310,10309,10309,10310},
+    /*142*/{10309,10310,10309,10310,10309,10310,10309,10310,10308,64,64,10309,10310,10309,10310,64,10309,10310,10309,10310,64,64,64,
+    64,64,64,64,64,64,64,64,64,10309,10310,10309,10310,10309,10310,10309,10310,10309,10310,10309,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64},
+    /*143*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,10310,10308,10308,10308,10308,10308},
+    /*144*/{10308,10308,64,10308,10308,10308,64,10308,10308,10308,10308,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*145*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,1088,1088,1088,1088,64,64,64,64,64,64,64,64},
+    /*146*/{64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*147*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,1088,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,1088,1088,1088,10308,
+    64,64,64,64},
+    /*148*/{10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,
+    64,64,64,64,1088,1088,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*149*/{10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64},
+    /*150*/{64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*151*/{64,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,64,10308,10312,10312,10312,10312,10312,10312,10312,
+    10312,10312,10312,64,64,64,64,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64},
+    /*152*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*153*/{10308,10308,10308,64,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,10312,10312,10312,10312,10312,10312,
+    10312,10312,10312,10312,64,64,1088,1088,1088,1088,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,10308,64,64,64,64,64},
+    /*154*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,64,10308,64,64,64,10308,10308,64,64,10308,10308,10308,10308,10308,64,64},
+    /*155*/{10308,64,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,10308,1088,1088,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,1088,1088,10308,10308,10308,64,64,64,64,64,64,
+    64,64,64,64,64},
+    /*156*/{64,10308,10308,10308,10308,10308,10308,64,64,10308,10308,10308,10308,10308,10308,64,64,10308,10308,10308,10308,10308,
+    10308,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,10308,10308,10308,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*157*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,1088,
+    64,64,64,64,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,64,64,64,64,64,64},
+    /*158*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,
+    64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*159*/{10308,10308,10308,10308,10308,10308,10308,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64},
+    /*160*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308},
+    /*161*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64},
+    /*162*/{10310,10310,10310,10310,10310,10310,10310,64,64,64,64,64,64,64,64,64,64,64,64,10310,10310,10310,10310,10310,64,64,64,64,
+    64,10308,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,10308,64,10308,64},
+    /*163*/{10308,10308,64,10308,10308,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308},
+    /*164*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*165*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*166*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,1088,1088},
+    /*167*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*168*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308},
+    /*169*/{10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    64,64,64,64},
+    /*170*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,
+    1088},
+    /*171*/{1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,64,1088,1088,1088,1088,
+    1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,64,1088,64,64,64,64,1088,64,1088,1088,64,64,64,64,10308,10308,10308,
+    10308,10308,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*172*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,64,64,64},
+    /*173*/{64,1088,1088,1088,64,1088,1088,1088,1088,1088,1088,64,1088,1088,1088,1088,10312,10312,10312,10312,10312,10312,10312,
+    10312,10312,10312,1088,1088,64,64,64,1088,1088,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,1088,1088,1088,64,1088},
+    /*174*/{64,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,1088,64,1088,64,1088,1088,1088,1088,1088,1088,1088,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308},
+    /*175*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,64},
+    /*176*/{64,64,10308,10308,10308,10308,10308,10308,64,64,10308,10308,10308,10308,10308,10308,64,64,10308,10308,10308,10308,10308,
+    10308,64,64,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64},
+    /*177*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,
+    10308,10308,64,10308},
+    /*178*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64},
+    /*179*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,
+    64,64,64},
+    /*180*/{1088,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*181*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308},
+    /*182*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64},
+    /*183*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308},
+    /*184*/{10308,64,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*185*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,1088,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308},
+    /*186*/{10308,10308,10308,10308,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,1088,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*187*/{10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310},
+    /*188*/{10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308},
+    /*189*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,10312,10312,10312,10312,10312,10312,10312,10312,10312,
+    10312,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*190*/{10308,10308,10308,10308,10308,10308,64,64,10308,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,64,64,64,10308,64,64,10308},
+    /*191*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,64,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64},
+    /*192*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,64,64,64,64,64,64,64,64,64,1088,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,1088},
+    /*193*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,10308,
+    10308},
+    /*194*/{10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,64,10308,10308,10308,64,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*195*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,1088,1088,1088,1088,1088,1088,1088,1088,1088,64,64,64,64,64,64,64,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,64,64,1088},
+    /*196*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,1088,1088,1088,1088,1088,
+    1088,1088},
+    /*197*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,64,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*198*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*199*/{64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64},
+    /*200*/{64,64,64,64,64,64,64,1088,1088,1088,1088,1088,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*201*/{64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,1088,1088,64,1088,1088},
+    /*202*/{1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,10312,10312,
+    10312,10312,10312,10312,10312,10312,10312,10312,64,64,64,64,64,64},
+    /*203*/{64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312},
+    /*204*/{1088,1088,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*205*/{64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*206*/{64,10308,10308,10308,10308,1088,1088,1088,1088,64,64,64,64,64,64,64,10312,10312,10312,10312,10312,10312,10312,10312,
+    10312,10312,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64},
+    /*207*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*208*/{10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*209*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*210*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,1088,1088,1088,1088,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*211*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,
+    64},
+    /*212*/{10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*213*/{64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*214*/{10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64},
+    /*215*/{10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309},
+    /*216*/{10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10310,10310,10310,10310,10310,10310,
+    10310,64,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309},
+    /*217*/{10309,10309,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10309,64,10309,10309,64,64,10309,64,64,10309,10309,64,64,10309,10309,
+    10309,10309,64,10309,10309,10309,10309,10309,10309,10309,10309,10310,10310,10310,10310,64,10310,64,10310,10310,10310},
+    /*218*/{10310,10310,10310,10310,64,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310},
+    /*219*/{10310,10310,10310,10310,10309,10309,64,10309,10309,10309,10309,64,64,10309,10309,10309,10309,10309,10309,10309,10309,64,
+    10309,10309,10309,10309,10309,10309,10309,64,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10309,10309,64,10309,10309,10309,
+    10309,64},
+    /*220*/{10309,10309,10309,10309,10309,64,10309,64,64,64,10309,10309,10309,10309,10309,10309,10309,64,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309},
+    /*221*/{10309,10309,10309,10309,10309,10309,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10310,10310,
+    10310,10310,10310,10310},
+    /*222*/{10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310},
+    /*223*/{10310,10310,10310,10310,10310,10310,10310,10310,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10309,10309,10309,10309},
+    /*224*/{10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309},
+    /*225*/{10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,64,64,10309,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309},
+    /*226*/{10309,64,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310,10310,10310,10310,64,10310,10310,10310,10310,10310,10310,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,64,
+    10310,10310,10310,10310},
+    /*227*/{10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,64,10310,10310,10310,10310,10310,10310,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,64,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310},
+    /*228*/{10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,64,10310,10310,10310,10310,
+    10310,10310,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,64,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310},
+    /*229*/{10310,10310,10310,10310,10310,10310,10310,10310,10310,64,10310,10310,10310,10310,10310,10310,10309,10309,10309,10309,
+    10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,10309,
+    10309,64,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,10310,
+    10310,10310,10310,10310},
+    /*230*/{10310,10310,10310,64,10310,10310,10310,10310,10310,10310,10309,10310,64,64,10312,10312,10312,10312,10312,10312,10312,
+    10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,
+    10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,10312,
+    10312,10312,10312},
+    /*231*/{10308,10308,10308,10308,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,64,10308,64,64,10308,64,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,64,10308,64,10308,64,64,64,64},
+    /*232*/{64,64,10308,64,64,64,64,10308,64,10308,64,10308,64,10308,10308,10308,64,10308,10308,64,10308,64,64,10308,64,10308,64,
+    10308,64,10308,64,10308,64,10308,10308,64,10308,64,64,10308,10308,10308,10308,64,10308,10308,10308,10308,10308,10308,
+    10308,64,10308,10308,10308,10308,64,10308,10308,10308,10308,64,10308,64},
+    /*233*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,10308,10308,10308,64,10308,10308,10308,10308,10308,64,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64},
+    /*234*/{10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,
+    10308,10308,10308,10308,10308,10308,10308,10308,10308,10308,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64}
+};
 static const MVMuint16 codepoint_bitfield_indexes[43829] = {
     /*0*/1/* 0000 */,/*1*/1/* 0001 */,/*2*/1/* 0002 */,/*3*/1/* 0003 */,/*4*/1/* 0004 */,/*5*/1/* 0005 */,/*6*/1/* 0006 */,
     /*7*/1/* 0007 */,/*8*/1/* 0008 */,/*9*/2/* 0009 */,/*10*/3/* 000A */,/*11*/4/* 000B */,/*12*/5/* 000C */,
@@ -42259,6 +43050,14 @@ MVMint32 MVM_unicode_is_in_block(MVMThreadContext *tc, MVMString *str, MVMint64
     }
     return 0;
 }
+
+/* Gets the mask of MVM_CCLASS_* bits for the character classes a codepoint
+ * is in. The codepoint must be in the range 0 to 0x10FFFF. */
+static MVMuint16 MVM_codepoint_to_cclass_mask(MVMint32 codepoint) {
+    return cclass_stage3[
+        cclass_stage2[cclass_stage1[codepoint >> 12]][(codepoint >> 6) & 0x3F]
+    ][codepoint & 0x3F];
+}
 static MVMint32 MVM_codepoint_to_row_index(MVMThreadContext *tc, MVMint32 codepoint) {
 
     MVMint32 plane = codepoint >> 16;
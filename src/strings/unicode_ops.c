@@ -58,6 +58,34 @@ MVMint64 MVM_unicode_codepoint_has_property_value(MVMThreadContext *tc, MVMCodep
         codepoint, property_code) == property_value_code ? 1 : 0;
 }
 
+/* Gets the mask of MVM_CCLASS_* bits for the character classes a codepoint
+ * is in. Codepoints past the end of Unicode are only printing. */
+MVMuint16 MVM_unicode_codepoint_cclass_mask(MVMThreadContext *tc, MVMCodepoint32 codepoint) {
+    if (codepoint < 0)
+        MVM_exception_throw_adhoc(tc, "Negative character fed to cclass: '%d'", codepoint);
+    if (codepoint > 0x10FFFF)
+        return MVM_CCLASS_PRINTING;
+    return MVM_codepoint_to_cclass_mask(codepoint);
+}
+
+/* Gets the character class masks of a run of codepoints at once, so that
+ * scans over a string needn't make a call per codepoint. Returns how many
+ * were done, which is fewer than asked for if a negative codepoint (which
+ * is in no class, and an error to ask about) was reached. */
+MVMint64 MVM_unicode_codepoints_cclass_masks(MVMThreadContext *tc, const MVMCodepoint32 *codepoints, MVMuint16 *masks, MVMint64 count) {
+    MVMint64 i;
+    for (i = 0; i < count; i++) {
+        MVMCodepoint32 codepoint = codepoints[i];
+        if ((MVMuint32)codepoint <= 0x10FFFF)
+            masks[i] = MVM_codepoint_to_cclass_mask(codepoint);
+        else if (codepoint > 0)
+            masks[i] = MVM_CCLASS_PRINTING;
+        else
+            break;
+    }
+    return i;
+}
+
 MVMCodepoint32 MVM_unicode_get_case_change(MVMThreadContext *tc, MVMCodepoint32 codepoint, MVMint32 case_) {
     MVMint32 changes_index = MVM_unicode_get_property_int(tc,
         codepoint, MVM_UNICODE_PROPERTY_CASE_CHANGE_INDEX);
@@ -1,4 +1,7 @@
 #include "moar.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 /* The below section has an MIT-style license, included here.
 
@@ -183,38 +186,113 @@ static void *utf8_encode(void *bytes, MVMCodepoint32 cp)
 
  /* end not_gerd section */
 
-#define UTF8_MAXINC (32 * 1024 * 1024)
-/* Decodes the specified number of bytes of utf8 into an NFG string, creating
- * a result of the specified type. The type must have the MVMString REPR.
- * Only bring in the raw codepoints for now. */
-MVMString * MVM_string_utf8_decode(MVMThreadContext *tc, MVMObject *result_type, const char *utf8, size_t bytes) {
+/* Finds how many bytes at the start of a buffer are ASCII. On x86-64 (and
+ * any other target with SSE2 enabled), 16 bytes are checked at a time; the
+ * top bits of each byte are gathered into a mask, which is zero for an
+ * all-ASCII block. Elsewhere, 8 bytes are checked at a time in a 64-bit
+ * word. */
+size_t MVM_string_ascii_prefix(const MVMuint8 *bytes, size_t length) {
+    size_t i = 0;
+#ifdef __SSE2__
+    while (i + 16 <= length) {
+        int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(bytes + i)));
+        if (mask) {
+            while (!(mask & 1)) {
+                mask >>= 1;
+                i++;
+            }
+            return i;
+        }
+        i += 16;
+    }
+#else
+    while (i + 8 <= length) {
+        MVMuint64 word;
+        memcpy(&word, bytes + i, 8);
+        if (word & 0x8080808080808080ULL)
+            break;
+        i += 8;
+    }
+#endif
+    while (i < length && bytes[i] < 0x80)
+        i++;
+    return i;
+}
+
+/* Checks if some input is well-formed UTF-8, so that decoding it won't
+ * throw. */
+MVMint32 MVM_string_utf8_valid(const char *utf8_chars, size_t bytes) {
+    const MVMuint8 *utf8  = (const MVMuint8 *)utf8_chars;
+    MVMint32        state = UTF8_ACCEPT;
+    MVMCodepoint32  codepoint;
+    while (bytes) {
+        if (state == UTF8_ACCEPT && *utf8 < 0x80) {
+            size_t run = MVM_string_ascii_prefix(utf8, bytes);
+            utf8  += run;
+            bytes -= run;
+            continue;
+        }
+        if (decode_utf8_byte(&state, &codepoint, *utf8) == UTF8_REJECT)
+            return 0;
+        utf8++;
+        bytes--;
+    }
+    return state == UTF8_ACCEPT;
+}
+
+/* Checks for a UTF-8 BOM at the start of some input. */
+#define HAS_BOM(utf8, bytes) ((bytes) >= 3 && (MVMuint8)(utf8)[0] == 0xEF \
+    && (MVMuint8)(utf8)[1] == 0xBB && (MVMuint8)(utf8)[2] == 0xBF)
+
+/* Decodes UTF-8 into an NFG string. Runs of ASCII are widened in bulk, and
+ * only the rest goes through the decoder. If compact is set, input that is
+ * all ASCII becomes an 8-bit string, copied straight over. */
+static MVMString * decode_utf8(MVMThreadContext *tc, MVMObject *result_type, const char *utf8_chars, size_t bytes, MVMint32 compact) {
     MVMString *result = (MVMString *)REPR(result_type)->allocate(tc, STABLE(result_type));
+    const MVMuint8 *utf8 = (const MVMuint8 *)utf8_chars;
     MVMint32 count = 0;
     MVMCodepoint32 codepoint;
     MVMint32 line_ending = 0;
     MVMint32 state = 0;
-    MVMint32 bufsize = bytes;
-    MVMint32 *buffer = malloc(sizeof(MVMint32) * bufsize);
+    MVMint32 *buffer;
     size_t orig_bytes;
-    const char *orig_utf8;
+    const MVMuint8 *orig_utf8;
+    size_t run, i;
     MVMint32 line;
     MVMint32 col;
 
-    if (bytes >= 3 && utf8[0] == 0xEF && utf8[1] == 0xBB && utf8[0xBF]) {
-        /* disregard UTF-8 BOM if it's present */
-        utf8 += 3; bytes -= 3;
-    }
     orig_bytes = bytes;
     orig_utf8 = utf8;
 
-    for (; bytes; ++utf8, --bytes) {
+    /* If it's all ASCII, there's nothing to decode. */
+    run = MVM_string_ascii_prefix(utf8, bytes);
+    if (run == bytes && compact) {
+        result->body.uint8s = malloc(bytes ? bytes : 1);
+        memcpy(result->body.uint8s, utf8, bytes);
+        result->body.flags  = MVM_STRING_TYPE_UINT8;
+        result->body.graphs = bytes;
+        result->body.codes  = bytes;
+        return result;
+    }
+
+    /* Every codepoint takes at least a byte, so there can't be more of them
+     * than there are bytes. */
+    buffer = malloc(sizeof(MVMint32) * bytes);
+
+    while (bytes) {
+        /* Between codepoints, take any run of ASCII in one go. */
+        if (state == UTF8_ACCEPT && *utf8 < 0x80) {
+            run = MVM_string_ascii_prefix(utf8, bytes);
+            for (i = 0; i < run; i++)
+                buffer[count + i] = utf8[i];
+            count += run;
+            utf8  += run;
+            bytes -= run;
+            continue;
+        }
+
         switch(decode_utf8_byte(&state, &codepoint, *utf8)) {
         case UTF8_ACCEPT: /* got a codepoint */
-            if (count == bufsize) { /* if the buffer's full make a bigger one */
-                buffer = realloc(buffer, sizeof(MVMint32) * (
-                    bufsize >= UTF8_MAXINC ? (bufsize += UTF8_MAXINC) : (bufsize *= 2)
-                ));
-            }
             buffer[count++] = codepoint;
             break;
         case UTF8_REJECT:
@@ -243,23 +321,26 @@ MVMString * MVM_string_utf8_decode(MVMThreadContext *tc, MVMObject *result_type,
                         col++;
                     break;
                 case UTF8_REJECT:
+                    free(buffer);
                     MVM_exception_throw_adhoc(tc, "Malformed UTF-8 at line %u col %u", line, col);
                 }
             }
+            free(buffer);
             MVM_exception_throw_adhoc(tc, "Concurrent modification of UTF-8 input buffer!");
             break;
         }
+        ++utf8; --bytes;
     }
-    if (state != UTF8_ACCEPT)
+    if (state != UTF8_ACCEPT) {
+        free(buffer);
         MVM_exception_throw_adhoc(tc, "Malformed termination of UTF-8 string");
+    }
 
     /* just keep the same buffer as the MVMString's buffer.  Later
      * we can add heuristics to resize it if we have enough free
      * memory */
-    if (bufsize - count > 4) {
+    if (orig_bytes - count > 4)
         buffer = realloc(buffer, count * sizeof(MVMint32));
-        bufsize = count;
-    }
     result->body.int32s = buffer;
 
     /* XXX set codes */
@@ -269,6 +350,42 @@ MVMString * MVM_string_utf8_decode(MVMThreadContext *tc, MVMObject *result_type,
     return result;
 }
 
+/* Decodes the specified number of bytes of utf8 into an NFG string, creating
+ * a result of the specified type. The type must have the MVMString REPR.
+ * Only bring in the raw codepoints for now. A leading BOM is skipped. The
+ * result is always 32-bit, so it can be shared between threads and used as
+ * a hash key without being widened in place. */
+MVMString * MVM_string_utf8_decode(MVMThreadContext *tc, MVMObject *result_type, const char *utf8, size_t bytes) {
+    if (HAS_BOM(utf8, bytes)) {
+        /* disregard UTF-8 BOM if it's present */
+        utf8 += 3; bytes -= 3;
+    }
+    return decode_utf8(tc, result_type, utf8, bytes, 0);
+}
+
+/* As MVM_string_utf8_decode, but leaves a BOM in place; for decoding from
+ * somewhere other than the start of the input. */
+MVMString * MVM_string_utf8_decode_nobom(MVMThreadContext *tc, MVMObject *result_type, const char *utf8, size_t bytes) {
+    return decode_utf8(tc, result_type, utf8, bytes, 0);
+}
+
+/* As MVM_string_utf8_decode, but input that is all ASCII becomes an 8-bit
+ * string. Flattening one (as hashing does) widens it in place, which isn't
+ * thread-safe, so this is only for strings fresh from I/O that belong to
+ * the caller, never for ones shared from the start, like those of a
+ * compilation unit. */
+MVMString * MVM_string_utf8_decode_compact(MVMThreadContext *tc, MVMObject *result_type, const char *utf8, size_t bytes) {
+    if (HAS_BOM(utf8, bytes)) {
+        utf8 += 3; bytes -= 3;
+    }
+    return decode_utf8(tc, result_type, utf8, bytes, 1);
+}
+
+/* As MVM_string_utf8_decode_compact, but leaves a BOM in place. */
+MVMString * MVM_string_utf8_decode_compact_nobom(MVMThreadContext *tc, MVMObject *result_type, const char *utf8, size_t bytes) {
+    return decode_utf8(tc, result_type, utf8, bytes, 1);
+}
+
 /* Decodes using a decodestream. Decodes as far as it can with the input
  * buffers, or until a stopper is reached. */
 void MVM_string_utf8_decodestream(MVMThreadContext *tc, MVMDecodeStream *ds,
@@ -293,6 +410,8 @@ void MVM_string_utf8_decodestream(MVMThreadContext *tc, MVMDecodeStream *ds,
 
     /* Rough starting-size estimate is number of bytes in the head buffer. */
     bufsize = ds->bytes_head->length;
+    if (bufsize < 16)
+        bufsize = 16;
     buffer = malloc(bufsize * sizeof(MVMCodepoint32));
 
     /* Decode each of the buffers. */
@@ -302,6 +421,42 @@ void MVM_string_utf8_decodestream(MVMThreadContext *tc, MVMDecodeStream *ds,
         MVMint32  pos   = cur_bytes == ds->bytes_head ? ds->bytes_head_pos : 0;
         char     *bytes = cur_bytes->bytes;
         while (pos < cur_bytes->length) {
+            /* Between codepoints, take any run of ASCII in one go, up to
+             * where a stopper says to end. */
+            if (state == UTF8_ACCEPT && (MVMuint8)bytes[pos] < 0x80) {
+                MVMint32 run = (MVMint32)MVM_string_ascii_prefix((MVMuint8 *)bytes + pos,
+                    cur_bytes->length - pos);
+                if (stopper_chars && run > *stopper_chars - total)
+                    run = *stopper_chars - total;
+                if (stopper_sep && *stopper_sep < 0x80) {
+                    char *sep = memchr(bytes + pos, *stopper_sep, run);
+                    if (sep) {
+                        run     = (MVMint32)(sep - (bytes + pos)) + 1;
+                        stopped = 1;
+                    }
+                }
+                while (run) {
+                    MVMint32 i, n;
+                    if (count == bufsize) {
+                        MVM_string_decodestream_add_chars(tc, ds, buffer, bufsize);
+                        buffer = malloc(bufsize * sizeof(MVMCodepoint32));
+                        count = 0;
+                    }
+                    n = bufsize - count < run ? bufsize - count : run;
+                    for (i = 0; i < n; i++)
+                        buffer[count + i] = (MVMuint8)bytes[pos + i];
+                    count += n;
+                    pos   += n;
+                    total += n;
+                    run   -= n;
+                }
+                last_accept_bytes = cur_bytes;
+                last_accept_pos = pos;
+                if (stopped || (stopper_chars && *stopper_chars == total))
+                    goto done;
+                continue;
+            }
+
             switch(decode_utf8_byte(&state, &codepoint, bytes[pos++])) {
             case UTF8_ACCEPT:
                 if (count == bufsize) {
@@ -337,14 +492,16 @@ void MVM_string_utf8_decodestream(MVMThreadContext *tc, MVMDecodeStream *ds,
     MVM_string_decodestream_discard_to(tc, ds, last_accept_bytes, last_accept_pos);
 }
 
-/* Encodes the specified string to UTF-8. */
+/* Encodes the specified string to UTF-8. The string is walked a flat piece
+ * at a time; in 8-bit pieces, runs of ASCII are copied straight over. */
 MVMuint8 * MVM_string_utf8_encode_substr(MVMThreadContext *tc,
         MVMString *str, MVMuint64 *output_size, MVMint64 start, MVMint64 length) {
     /* XXX This is terribly wrong when we get to doing NFG properly too. One graph may
      * expand to loads of codepoints and overflow the buffer. */
     MVMuint8 *result;
     MVMuint8 *arr;
-    size_t i = start;
+    MVMStrandIter iter;
+    MVMint64 pos = start;
     MVMStringIndex strgraphs = NUM_GRAPHS(str);
 
     if (length == -1)
@@ -360,15 +517,42 @@ MVMuint8 * MVM_string_utf8_encode_substr(MVMThreadContext *tc,
     result = malloc(sizeof(MVMint32) * length + 2);
     arr = result;
 
-    memset(result, 0, sizeof(MVMint32) * length + 2);
-    while (i < length && (arr = utf8_encode(arr, MVM_string_get_codepoint_at_nocheck(tc, str, i++))));
-    if (!arr)
-        MVM_exception_throw_adhoc(tc,
-            "Error encoding UTF-8 string near grapheme position %d with codepoint %d",
-                i - 1, MVM_string_get_codepoint_at_nocheck(tc, str, i-1));
+    MVM_string_strand_iter_init(tc, &iter, str, (MVMStringIndex)start, (MVMStringIndex)length);
+    while (MVM_string_strand_iter_next(tc, &iter)) {
+        MVMStringIndex i = 0;
+        if (IS_8BIT(iter.string)) {
+            MVMCodepoint8 *cps = iter.string->body.uint8s + iter.start;
+            while (i < iter.length) {
+                size_t run = MVM_string_ascii_prefix(cps + i, iter.length - i);
+                memcpy(arr, cps + i, run);
+                arr += run;
+                i   += run;
+                if (i < iter.length)
+                    arr = utf8_encode(arr, cps[i++]);
+            }
+        }
+        else {
+            MVMCodepoint32 *cps = iter.string->body.int32s + iter.start;
+            for (; i < iter.length; i++) {
+                MVMuint8 *next = utf8_encode(arr, cps[i]);
+                if (!next) {
+                    free(result);
+                    MVM_exception_throw_adhoc(tc,
+                        "Error encoding UTF-8 string near grapheme position %d with codepoint %d",
+                            (int)(pos + i), cps[i]);
+                }
+                arr = next;
+            }
+        }
+        pos += iter.length;
+    }
+
+    /* Some callers use the result as a C string, so terminate it; the
+     * padding leaves room for that. */
+    *arr = 0;
 
     if (output_size)
-        *output_size = (MVMuint64)(arr ? arr - result : 0);
+        *output_size = (MVMuint64)(arr - result);
 
     return result;
 }
@@ -1,4 +1,9 @@
+size_t MVM_string_ascii_prefix(const MVMuint8 *bytes, size_t length);
+MVMint32 MVM_string_utf8_valid(const char *utf8, size_t bytes);
 MVM_PUBLIC MVMString * MVM_string_utf8_decode(MVMThreadContext *tc, MVMObject *result_type, const char *utf8, size_t bytes);
+MVM_PUBLIC MVMString * MVM_string_utf8_decode_nobom(MVMThreadContext *tc, MVMObject *result_type, const char *utf8, size_t bytes);
+MVM_PUBLIC MVMString * MVM_string_utf8_decode_compact(MVMThreadContext *tc, MVMObject *result_type, const char *utf8, size_t bytes);
+MVM_PUBLIC MVMString * MVM_string_utf8_decode_compact_nobom(MVMThreadContext *tc, MVMObject *result_type, const char *utf8, size_t bytes);
 MVM_PUBLIC void MVM_string_utf8_decodestream(MVMThreadContext *tc, MVMDecodeStream *ds, MVMint32 *stopper_chars, MVMint32 *stopper_sep);
 MVM_PUBLIC MVMuint8 * MVM_string_utf8_encode_substr(MVMThreadContext *tc,
         MVMString *str, MVMuint64 *output_size, MVMint64 start, MVMint64 length);
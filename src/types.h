@@ -3,16 +3,24 @@
 typedef struct MVMActiveHandler MVMActiveHandler;
 typedef struct MVMArgInfo MVMArgInfo;
 typedef struct MVMArgProcContext MVMArgProcContext;
+typedef struct MVMArgsPlan MVMArgsPlan;
 typedef struct MVMArray MVMArray;
 typedef struct MVMArrayBody MVMArrayBody;
+typedef struct MVMArrayMapping MVMArrayMapping;
 typedef struct MVMArrayREPRData MVMArrayREPRData;
+typedef struct MVMAsyncCompletion MVMAsyncCompletion;
+typedef struct MVMAsyncTask MVMAsyncTask;
+typedef struct MVMAsyncTodo MVMAsyncTodo;
 typedef struct MVMAttributeIdentifier MVMAttributeIdentifier;
 typedef struct MVMBoolificationSpec MVMBoolificationSpec;
 typedef struct MVMBootTypes MVMBootTypes;
 typedef struct MVMBytecodeAnnotation MVMBytecodeAnnotation;
+typedef struct MVMBytecodeCache MVMBytecodeCache;
 typedef struct MVMCallCapture MVMCallCapture;
 typedef struct MVMCallCaptureBody MVMCallCaptureBody;
 typedef struct MVMCallsite MVMCallsite;
+typedef struct MVMCallStackBlock MVMCallStackBlock;
+typedef struct MVMCallStackRegion MVMCallStackRegion;
 typedef struct MVMCFunction MVMCFunction;
 typedef struct MVMCFunctionBody MVMCFunctionBody;
 typedef struct MVMCode MVMCode;
@@ -20,6 +28,10 @@ typedef struct MVMCodeBody MVMCodeBody;
 typedef struct MVMCollectable MVMCollectable;
 typedef struct MVMCompUnit MVMCompUnit;
 typedef struct MVMCompUnitBody MVMCompUnitBody;
+typedef struct MVMConcBlockingQueue MVMConcBlockingQueue;
+typedef struct MVMConcBlockingQueueBody MVMConcBlockingQueueBody;
+typedef struct MVMConcBlockingQueueNode MVMConcBlockingQueueNode;
+typedef struct MVMConcBlockingQueueShared MVMConcBlockingQueueShared;
 typedef struct MVMConcatState MVMConcatState;
 typedef struct MVMContainerConfigurer MVMContainerConfigurer;
 typedef struct MVMContainerSpec MVMContainerSpec;
@@ -27,9 +39,12 @@ typedef struct MVMContainerRegistry MVMContainerRegistry;
 typedef struct MVMContext MVMContext;
 typedef struct MVMContextBody MVMContextBody;
 typedef struct MVMContinuationTag MVMContinuationTag;
+typedef struct MVMDeserializeWorklist MVMDeserializeWorklist;
 typedef struct MVMDLLRegistry MVMDLLRegistry;
 typedef struct MVMDLLSym MVMDLLSym;
 typedef struct MVMDLLSymBody MVMDLLSymBody;
+typedef struct MVMDynlexCacheEntry MVMDynlexCacheEntry;
+typedef struct MVMEventLoop MVMEventLoop;
 typedef struct MVMException MVMException;
 typedef struct MVMExceptionBody MVMExceptionBody;
 typedef struct MVMExtOpRecord MVMExtOpRecord;
@@ -40,13 +55,17 @@ typedef struct MVMFrameHandler MVMFrameHandler;
 typedef struct MVMGen2Allocator MVMGen2Allocator;
 typedef struct MVMGen2SizeClass MVMGen2SizeClass;
 typedef struct MVMGCPassedWork MVMGCPassedWork;
+typedef struct MVMGCStealStack MVMGCStealStack;
 typedef struct MVMGCWorklist MVMGCWorklist;
+typedef struct MVMGCSafepointFree MVMGCSafepointFree;
+typedef struct MVMGen2Slot MVMGen2Slot;
 typedef struct MVMHash MVMHash;
 typedef struct MVMHashAttrStore MVMHashAttrStore;
 typedef struct MVMHashAttrStoreBody MVMHashAttrStoreBody;
 typedef struct MVMHashBody MVMHashBody;
 typedef struct MVMHashEntry MVMHashEntry;
 typedef struct MVMHLLConfig MVMHLLConfig;
+typedef struct MVMIOMappable MVMIOMappable;
 typedef struct MVMIntConstCache MVMIntConstCache;
 typedef struct MVMInstance MVMInstance;
 typedef struct MVMInvocationSpec MVMInvocationSpec;
@@ -56,6 +75,7 @@ typedef struct MVMKnowHOWAttributeREPR MVMKnowHOWAttributeREPR;
 typedef struct MVMKnowHOWAttributeREPRBody MVMKnowHOWAttributeREPRBody;
 typedef struct MVMKnowHOWREPR MVMKnowHOWREPR;
 typedef struct MVMKnowHOWREPRBody MVMKnowHOWREPRBody;
+typedef struct MVMLexicalCacheEntry MVMLexicalCacheEntry;
 typedef struct MVMLexicalRegistry MVMLexicalRegistry;
 typedef struct MVMLexotic MVMLexotic;
 typedef struct MVMLexoticBody MVMLexoticBody;
@@ -65,7 +85,8 @@ typedef struct MVMNFABody MVMNFABody;
 typedef struct MVMNFAStateInfo MVMNFAStateInfo;
 typedef struct MVMMultiCache MVMMultiCache;
 typedef struct MVMMultiCacheBody MVMMultiCacheBody;
-typedef struct MVMMultiArityCache MVMMultiArityCache;
+typedef struct MVMMultiCacheEntry MVMMultiCacheEntry;
+typedef struct MVMMultiCacheTable MVMMultiCacheTable;
 typedef struct MVMContinuation MVMContinuation;
 typedef struct MVMContinuationBody MVMContinuationBody;
 typedef struct MVMObject MVMObject;
@@ -100,11 +121,15 @@ typedef struct MVMSerializationContextBody MVMSerializationContextBody;
 typedef struct MVMSerializationReader MVMSerializationReader;
 typedef struct MVMSerializationRoot MVMSerializationRoot;
 typedef struct MVMSerializationWriter MVMSerializationWriter;
+typedef struct MVMSpeshICEntry MVMSpeshICEntry;
+typedef struct MVMSpeshSite MVMSpeshSite;
+typedef struct MVMJitCode MVMJitCode;
 typedef struct MVMSTable MVMSTable;
 typedef struct MVMStaticFrame MVMStaticFrame;
 typedef struct MVMStaticFrameBody MVMStaticFrameBody;
 typedef struct MVMStorageSpec MVMStorageSpec;
 typedef struct MVMStrand MVMStrand;
+typedef struct MVMStrandIter MVMStrandIter;
 typedef struct MVMString MVMString;
 typedef struct MVMStringBody MVMStringBody;
 typedef struct MVMStringConsts MVMStringConsts;
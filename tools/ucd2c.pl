@@ -42,6 +42,29 @@ my %is_subtype = (
     }
 );
 my $gc_alias_checkers = [];
+# The character classes the regex engine asks about, and their bits in the
+# masks of the cclass tables; these must match MVM_CCLASS_* in
+# src/strings/ops.h.
+my %cclass_bits = (
+    UPPERCASE    => 1,
+    LOWERCASE    => 2,
+    ALPHABETIC   => 4,
+    NUMERIC      => 8,
+    HEXADECIMAL  => 16,
+    WHITESPACE   => 32,
+    PRINTING     => 64,
+    BLANK        => 256,
+    CONTROL      => 512,
+    PUNCTUATION  => 1024,
+    ALPHANUMERIC => 2048,
+    NEWLINE      => 4096,
+    WORD         => 8192,
+);
+# The cclass tables are in three stages: codepoint bits above these two
+# pick a block of indexes, the middle bits pick a block of masks from it,
+# and the low bits pick the mask.
+my $cclass_index_bits = 6;
+my $cclass_mask_bits = 6;
 
 sub progress($);
 sub main {
@@ -109,6 +132,7 @@ sub main {
     emit_bitfield($first_point);
     $extents = emit_codepoints_and_planes($first_point);
     emit_case_changes($first_point);
+    emit_cclass_tables($first_point);
     emit_codepoint_row_lookup($extents);
     emit_property_value_lookup($allocated_properties);
     emit_names_hash_builder();
@@ -632,6 +656,105 @@ sub emit_case_changes {
     $db_sections->{BBB_case_changes} = $out;
 }
 
+sub cclass_mask {
+    # work out the character classes a codepoint is in, as a mask; this
+    # must agree with MVM_string_is_cclass, including its ASCII shortcuts
+    my ($code, $point) = @_;
+    my $gc = $point
+        ? $enumerated_properties->{General_Category}->{keys}->[$point->{General_Category} // 0]
+        : 'Cn';
+    my $letter = $code <= ord('z')
+        ? ($code >= ord('a') || $code >= ord('A') && $code <= ord('Z'))
+        : $gc =~ /^L[ultmo]$/;
+    my $digit = $code >= ord('0') && $code <= ord('9') || $gc eq 'Nd';
+    my $mask = 0;
+    $mask |= $cclass_bits{UPPERCASE} if $gc eq 'Lu';
+    $mask |= $cclass_bits{LOWERCASE} if $gc eq 'Ll';
+    $mask |= $cclass_bits{ALPHABETIC} if $letter;
+    $mask |= $cclass_bits{NUMERIC} if $digit;
+    $mask |= $cclass_bits{HEXADECIMAL} if $point && $point->{ASCII_Hex_Digit};
+    $mask |= $cclass_bits{WHITESPACE} if $code <= ord('~')
+        ? $code == ord(' ') || $code >= 9 && $code <= 13
+        : $point && $point->{White_Space};
+    $mask |= $cclass_bits{PRINTING} if $code >= 32;
+    $mask |= $cclass_bits{BLANK} if $code == 9 || $gc eq 'Zs';
+    $mask |= $cclass_bits{CONTROL} if $code < 32 || $code >= 127 && $code < 160;
+    $mask |= $cclass_bits{PUNCTUATION} if $gc =~ /^P[cdseifo]$/;
+    $mask |= $cclass_bits{ALPHANUMERIC} if $letter || $digit;
+    $mask |= $cclass_bits{NEWLINE} if $code == 10 || $code == 13 || $code == 0x85 || $gc eq 'Zl';
+    $mask |= $cclass_bits{WORD} if $letter || $digit || $code == ord('_');
+    $mask
+}
+
+sub emit_cclass_tables {
+    # a mask of the character classes of every codepoint, split into blocks
+    # with the duplicates shared, so a lookup is three loads and no branches
+    my $point = shift;
+    my @masks;
+    for my $code (0 .. 0x10FFFF) {
+        $point = $point->{next_point} while $point && $point->{code} < $code;
+        push @masks, cclass_mask($code,
+            $point && $point->{code} == $code ? $point : undef);
+    }
+    my $mask_size = 2 ** $cclass_mask_bits;
+    my $index_size = 2 ** $cclass_index_bits;
+    my (@stage1, @stage2, @stage3, %stage2_seen, %stage3_seen);
+    for (my $high = 0; $high < 0x110000; $high += $index_size * $mask_size) {
+        my @indexes;
+        for (my $low = $high; $low < $high + $index_size * $mask_size; $low += $mask_size) {
+            my $block = join ',', @masks[$low .. $low + $mask_size - 1];
+            unless (exists $stage3_seen{$block}) {
+                $stage3_seen{$block} = scalar @stage3;
+                push @stage3, $block;
+            }
+            push @indexes, $stage3_seen{$block};
+        }
+        my $block = join ',', @indexes;
+        unless (exists $stage2_seen{$block}) {
+            $stage2_seen{$block} = scalar @stage2;
+            push @stage2, $block;
+        }
+        push @stage1, $stage2_seen{$block};
+    }
+    my $stage1_type = @stage2 <= 256 ? 'MVMuint8' : 'MVMuint16';
+    my $stage2_type = @stage3 <= 256 ? 'MVMuint8' : 'MVMuint16';
+    my $emit_blocks = sub {
+        my $i = 0;
+        join ",\n    ", map {
+            "/*".$i++."*/{".stack_lines([ split ',' ], ",", ",\n    ", 0, $wrap_to_columns)."}"
+        } @_;
+    };
+    my $stage1_count = scalar @stage1;
+    my $stage2_count = scalar @stage2;
+    my $stage3_count = scalar @stage3;
+    my $bytes = $stage1_count * ($stage1_type eq 'MVMuint8' ? 1 : 2)
+        + $stage2_count * $index_size * ($stage2_type eq 'MVMuint8' ? 1 : 2)
+        + $stage3_count * $mask_size * 2;
+    print "\nCompressed cclass masks into ".thousands($bytes)." bytes of tables.\n";
+    $estimated_total_bytes += $bytes;
+    $total_bytes_saved += 0x110000 * 2 - $bytes;
+    my $mask_shift = $cclass_mask_bits;
+    my $index_shift = $cclass_index_bits + $cclass_mask_bits;
+    my $mask_low = sprintf "0x%X", $mask_size - 1;
+    my $index_low = sprintf "0x%X", $index_size - 1;
+    $db_sections->{BBB_cclass_tables} =
+        "static const $stage1_type cclass_stage1[$stage1_count] = {\n    ".
+            stack_lines(\@stage1, ",", ",\n    ", 0, $wrap_to_columns).
+            "\n};\n".
+        "static const $stage2_type cclass_stage2[$stage2_count][$index_size] = {\n    ".
+            $emit_blocks->(@stage2)."\n};\n".
+        "static const MVMuint16 cclass_stage3[$stage3_count][$mask_size] = {\n    ".
+            $emit_blocks->(@stage3)."\n};";
+    $db_sections->{cclass_lookup} = "
+/* Gets the mask of MVM_CCLASS_* bits for the character classes a codepoint
+ * is in. The codepoint must be in the range 0 to 0x10FFFF. */
+static MVMuint16 MVM_codepoint_to_cclass_mask(MVMint32 codepoint) {
+    return cclass_stage3[
+        cclass_stage2[cclass_stage1[codepoint >> $index_shift]][(codepoint >> $mask_shift) & $index_low]
+    ][codepoint & $mask_low];
+}";
+}
+
 sub emit_bitfield {
     my $point = shift;
     my $wide = $point->{bitfield_width};